@@ -1695,7 +1695,17 @@ typedef enum MDBX_copy_flags {
 
   /** Silently overwrite the target file, if it exists, instead of returning an error
    * \see mdbx_txn_copy2pathname() \see mdbx_env_copy() */
-  MDBX_CP_OVERWRITE = 64u
+  MDBX_CP_OVERWRITE = 64u,
+
+  /** Walk the named tables in parallel by several threads during copy with
+   * compactification \ref MDBX_CP_COMPACT.
+   *
+   * Each table gets a range of pages in the destination reserved in advance,
+   * so the result is the same as for the serial copy. Has no effect without
+   * \ref MDBX_CP_COMPACT, with \ref MDBX_CP_THROTTLE_MVCC, for a write
+   * transaction, or if the destination is a pipe/socket. The number of threads is limited by the
+   * `MDBX_ENVCOPY_THREADS` build option. */
+  MDBX_CP_PARALLEL = 128u
 
 } MDBX_copy_flags_t;
 DEFINE_ENUM_FLAG_OPERATORS(MDBX_copy_flags)
@@ -2411,7 +2421,25 @@ typedef enum MDBX_option {
   /** \brief Задаёт в % ограничение резервирования места на вложенных страницах.
    *
    * min 0, max 100% (65535), default = 4.2% (2753) */
-  MDBX_opt_subpage_reserve_limit
+  MDBX_opt_subpage_reserve_limit,
+
+  /** \brief Включает сбор гистограмм задержек и задаёт период прореживания
+   * замеров для \ref mdbx_env_latency_hist().
+   *
+   * \details Ноль отключает сбор, а ненулевое значение N (округляемое вверх
+   * до степени двойки) включает замер каждой N-ой операции чтения, т.е. старта
+   * читающей транзакции, \ref mdbx_get() и позиционирования курсора.
+   * Ожидание блокировки пишущих транзакций замеряется всегда. Каждый замер
+   * стоит порядка двух обращений к часам и двух системных вызовов для
+   * подсчета page-faults, поэтому для удержания накладных расходов в пределах
+   * 1-2% рекомендуется период от 64 и выше.
+   *
+   * Опция действует только в пределах текущего процесса и доступна только
+   * если libmdbx собрана с опцией `MDBX_ENABLE_LATENCY_HIST=1`, иначе
+   * установка ненулевого значения вернёт \ref MDBX_ENOSYS.
+   *
+   * min 0 (отключено), max 2^30, default = 0 */
+  MDBX_opt_latency_sampling
 } MDBX_option_t;
 
 /** \brief Sets the value of a extra runtime options for an environment.
@@ -2753,6 +2781,179 @@ LIBMDBX_API int mdbx_env_copy2fd(MDBX_env *env, mdbx_filehandle_t fd, MDBX_copy_
  * \returns A non-zero error value on failure and 0 on success. */
 LIBMDBX_API int mdbx_txn_copy2fd(MDBX_txn *txn, mdbx_filehandle_t fd, MDBX_copy_flags_t flags);
 
+/** \brief Write an incremental (delta) copy of an environment, i.e. only the
+ * pages changed since the given transaction, to the specified file descriptor.
+ * \ingroup c_extra
+ *
+ * The delta contains pages of the last MVCC-snapshot which were written by
+ * transactions newer than `since_txnid`, as well as new meta-pages, and could
+ * be applied by \ref mdbx_env_apply_delta() to a copy made as-is (i.e.
+ * without \ref MDBX_CP_COMPACT) at the `since_txnid` transaction or later.
+ * Subtrees unchanged since `since_txnid` are skipped entirely without reading
+ * its pages, so the cost is proportional to the amount of changes.
+ * \see mdbx_env_copy2fd()
+ *
+ * \note This call can trigger significant file size growth if run in
+ *       parallel with write transactions, because it employs a read-only
+ *       transaction. See long-lived transactions under \ref restrictions
+ *       section.
+ *
+ * \param [in] env          An environment handle returned by
+ *                          mdbx_env_create(). It must have already been
+ *                          opened successfully.
+ * \param [in] since_txnid  The transaction ID of a base copy, for instance
+ *                          the \ref MDBX_envinfo::mi_recent_txnid at the time
+ *                          of the previous backup. Zero means all pages.
+ * \param [in] fd           The file descriptor to write the delta to, which
+ *                          could be a pipe or socket.
+ *
+ * \returns A non-zero error value on failure and 0 on success,
+ *          some possible errors are:
+ * \retval MDBX_EINVAL   The `since_txnid` is newer than the current snapshot. */
+LIBMDBX_API int mdbx_env_copy_delta(MDBX_env *env, uint64_t since_txnid, mdbx_filehandle_t fd);
+
+/** \brief Apply a delta made by \ref mdbx_env_copy_delta() to a copy of the
+ * environment at the specified path.
+ * \ingroup c_extra
+ *
+ * The target must not be used by any process during the operation,
+ * otherwise the locking error is returned.
+ * The meta-pages of the target are overwritten by a stub at first and
+ * are written after all pages, so on failure the target is left unusable
+ * like an incomplete copy.
+ *
+ * \note On Windows the \ref mdbx_env_apply_deltaW() is recommended to use.
+ *
+ * \param [in] pathname  The pathname of the target environment, i.e. of a
+ *                       directory or of the data file (\ref MDBX_NOSUBDIR).
+ * \param [in] delta_fd  The file descriptor to read the delta from, which
+ *                       could be a pipe or socket.
+ *
+ * \returns A non-zero error value on failure and 0 on success,
+ *          some possible errors are:
+ * \retval MDBX_INVALID       The delta is malformed or truncated.
+ * \retval MDBX_INCOMPATIBLE  The target is a copy of another database,
+ *                            or it is older than the base of the delta,
+ *                            or it is newer than the delta itself. */
+LIBMDBX_API int mdbx_env_apply_delta(const char *pathname, mdbx_filehandle_t delta_fd);
+
+#if defined(_WIN32) || defined(_WIN64) || defined(DOXYGEN)
+/** \copydoc mdbx_env_apply_delta()
+ * \ingroup c_extra
+ * \note Available only on Windows.
+ * \see mdbx_env_apply_delta() */
+LIBMDBX_API int mdbx_env_apply_deltaW(const wchar_t *pathname, mdbx_filehandle_t delta_fd);
+#define mdbx_env_apply_deltaT(pathname, delta_fd) mdbx_env_apply_deltaW(pathname, delta_fd)
+#else
+#define mdbx_env_apply_deltaT(pathname, delta_fd) mdbx_env_apply_delta(pathname, delta_fd)
+#endif /* Windows */
+
+/** \brief A callback function for page-shipping replication,
+ * i.e. for receiving the deltas of committed transactions.
+ * \ingroup c_extra
+ * \see mdbx_env_set_pageship()
+ * \see mdbx_env_follow()
+ *
+ * After each commit of a write transaction the delta between the previously
+ * shipped MVCC-snapshot and the committed one is passed to the callback by
+ * portions in the format of \ref mdbx_env_copy_delta(), and then the callback
+ * is called once again with `NULL` and zero to notify about end of the delta.
+ * The callback is called from the thread which commits the transaction while
+ * the write lock is still held, so it should just write the data to a pipe,
+ * socket or a file without waiting for the follower.
+ *
+ * \param [in] env    An environment handle.
+ * \param [in] txnid  The transaction ID of the shipped snapshot.
+ * \param [in] data   A portion of the delta, or `NULL` at end of the delta.
+ * \param [in] bytes  A size of the portion, or zero at end of the delta.
+ *
+ * \returns Zero on success, otherwise the error which will be returned
+ *          by \ref mdbx_env_get_pageship_status(). */
+typedef int(MDBX_pageship_func)(const MDBX_env *env, uint64_t txnid, const void *data,
+                                size_t bytes) MDBX_CXX17_NOEXCEPT;
+
+/** \brief Sets a callback for page-shipping replication to a follower.
+ * \ingroup c_extra
+ *
+ * The current MVCC-snapshot becomes the base of the stream of deltas, and
+ * the last shipped snapshot is retained until the next shipping, so pages
+ * of it are never reused by a writer. Therefore a follower which is at the
+ * base snapshot can apply the deltas by \ref mdbx_env_follow() while its
+ * readers use the current snapshot.
+ *
+ * The delta includes changes made by all processes since the last shipping,
+ * but the callback is called only by the process which has set it.
+ * If the callback fails, then the transaction is committed anyway and
+ * \ref mdbx_txn_commit_ex() succeeds, the error is returned by
+ * \ref mdbx_env_get_pageship_status(), and the next delta will be made
+ * since the same base. Setting the callback again restarts the stream.
+ *
+ * \param [in] env   An environment handle returned by \ref mdbx_env_create()
+ *                   and opened in read-write mode.
+ * \param [in] func  A \ref MDBX_pageship_func function or NULL to disable.
+ *
+ * \returns A non-zero error value on failure and 0 on success. */
+LIBMDBX_API int mdbx_env_set_pageship(MDBX_env *env, MDBX_pageship_func *func);
+
+/** \brief Gets the current page-shipping callback.
+ * \ingroup c_extra
+ * \see mdbx_env_set_pageship()
+ *
+ * \returns A \ref MDBX_pageship_func function or NULL if disabled
+ *          or something wrong. */
+MDBX_NOTHROW_PURE_FUNCTION LIBMDBX_API MDBX_pageship_func *mdbx_env_get_pageship(const MDBX_env *env);
+
+/** \brief Gets the status of the last page-shipping.
+ * \ingroup c_extra
+ * \see mdbx_env_set_pageship()
+ *
+ * Since a transaction is committed regardless of a failure of shipping,
+ * the failure is reported by this function rather than by
+ * \ref mdbx_txn_commit_ex(). The status is reset by the next successful
+ * shipping, as well as by \ref mdbx_env_set_pageship().
+ *
+ * \param [in] env  An environment handle returned by \ref mdbx_env_create().
+ *
+ * \returns \ref MDBX_SUCCESS if the last committed write transaction
+ *          was shipped, otherwise the error of the callback or of making
+ *          the delta. */
+LIBMDBX_API int mdbx_env_get_pageship_status(const MDBX_env *env);
+
+/** \brief Applies a delta to an opened follower environment.
+ * \ingroup c_extra
+ * \see mdbx_env_set_pageship()
+ *
+ * Unlike \ref mdbx_env_apply_delta() the follower remains usable by readers
+ * during the operation. The pages of the delta are written in-place, and then
+ * the follower advances to the snapshot of the delta by the regular atomic
+ * update of a meta-page, likewise for a commit of a write transaction.
+ * Readers of snapshots older than the current one are handled like in case of
+ * \ref MDBX_MAP_FULL, i.e. by the \ref MDBX_hsr_func callback if set.
+ * A delta which was already applied is skipped.
+ *
+ * \note The pages of a delta don't overlap ones of the base snapshot only for
+ *       the deltas made by \ref MDBX_pageship_func. Otherwise, as well as if the
+ *       follower is newer than the base of the delta, there should be no readers
+ *       of the current snapshot.
+ *
+ * \param [in] env       An environment handle returned by
+ *                       \ref mdbx_env_create() and opened in read-write mode
+ *                       at a copy made as-is of the source database.
+ * \param [in] delta_fd  The file descriptor to read a delta from, which
+ *                       could be a pipe or socket.
+ *
+ * \returns A non-zero error value on failure and 0 on success,
+ *          some possible errors are:
+ * \retval MDBX_ENODATA       End of the stream is reached.
+ * \retval MDBX_BUSY          There are readers of older snapshots, nothing
+ *                            was read from the stream if the follower is
+ *                            at the base of the delta.
+ * \retval MDBX_INVALID       The delta is malformed or truncated.
+ * \retval MDBX_INCOMPATIBLE  The follower is a copy of another database,
+ *                            or it is older than the base of the delta,
+ *                            or it is newer than the delta itself. */
+LIBMDBX_API int mdbx_env_follow(MDBX_env *env, mdbx_filehandle_t delta_fd);
+
 /** \brief Statistics for a table in the environment
  * \ingroup c_statinfo
  * \see mdbx_env_stat_ex() \see mdbx_dbi_stat() */
@@ -2880,6 +3081,17 @@ struct MDBX_envinfo {
   struct {
     uint64_t x, y;
   } mi_dxbid;
+
+  /** Contention statistics of the write transaction lock.
+   * \details Accumulated over the current multi-process session like the
+   * \ref mi_pgop_stat. Not collected on Windows, i.e. always zeroed. */
+  struct {
+    uint64_t acquisitions;        /**< Number of the lock acquisitions */
+    uint64_t contended;           /**< Number of acquisitions with waiting */
+    uint64_t wait_seconds16dot16; /**< Total waiting time in 1/65536 of second */
+    uint32_t waiters;             /**< Current number of waiting threads */
+    uint32_t max_waiters;         /**< Peak number of waiting threads */
+  } mi_wrt_lock;
 };
 #ifndef __cplusplus
 /** \ingroup c_statinfo */
@@ -2914,6 +3126,72 @@ MDBX_DEPRECATED LIBMDBX_INLINE_API(int, mdbx_env_info, (const MDBX_env *env, MDB
   return mdbx_env_info_ex(env, NULL, info, bytes);
 }
 
+/** \brief Kinds of operations with latency histograms.
+ * \ingroup c_statinfo
+ * \see mdbx_env_latency_hist() \see MDBX_opt_latency_sampling */
+typedef enum MDBX_latency_kind {
+  /** Start or renew of a read-only transaction. */
+  MDBX_LATENCY_READ_BEGIN,
+  /** Lookups by \ref mdbx_get(), \ref mdbx_get_ex() and \ref mdbx_get_equal_or_great(). */
+  MDBX_LATENCY_GET,
+  /** Positioning of cursors by a key via \ref mdbx_cursor_get(). */
+  MDBX_LATENCY_SEEK,
+  /** Any of the above sampled operations, during which the process incurred
+   * major page fault(s), i.e. was waiting for a disk read. */
+  MDBX_LATENCY_FAULTED,
+  /** Waiting for the write transaction lock, including zero waits.
+   * Not collected on Windows. */
+  MDBX_LATENCY_WRITE_LOCK,
+  MDBX_LATENCY_KINDS
+} MDBX_latency_kind_t;
+
+/** \brief Number of buckets in \ref MDBX_latency_hist.
+ * \ingroup c_statinfo */
+#define MDBX_LATENCY_BUCKETS 40
+
+/** \brief Log2 histogram of operation latencies.
+ * \ingroup c_statinfo
+ * \see mdbx_env_latency_hist() */
+struct MDBX_latency_hist {
+  uint64_t count;    /**< Number of measured operations */
+  uint64_t total_ns; /**< Total duration of measured operations in nanoseconds */
+  /** The bucket `i` counts durations in range `[2^i, 2^(i+1))` nanoseconds,
+   * the zero bucket also includes zero durations and the last one includes
+   * all longer durations. */
+  uint64_t buckets[MDBX_LATENCY_BUCKETS];
+};
+#ifndef __cplusplus
+/** \ingroup c_statinfo */
+typedef struct MDBX_latency_hist MDBX_latency_hist;
+#endif
+
+/** \brief Retrieve the latency histogram of a kind of operations.
+ * \ingroup c_statinfo
+ *
+ * Unlike \ref MDBX_commit_latency which covers only commits of write
+ * transactions, these histograms allow to investigate the tail latency of
+ * reading. Histograms are collected only if libmdbx was built with
+ * `MDBX_ENABLE_LATENCY_HIST=1` and enabled at runtime by the
+ * \ref MDBX_opt_latency_sampling option. Note that the layout of the LCK
+ * differs for such builds, so all processes working with a database
+ * simultaneously should use the same build option.
+ *
+ * \param [in] env        An environment handle returned by \ref mdbx_env_create().
+ * \param [in] kind       A kind of operations, one of \ref MDBX_latency_kind_t.
+ * \param [in] aggregate  If true, then the histogram aggregated over all
+ *                        processes of the current multi-process session
+ *                        (like the \ref MDBX_envinfo::mi_pgop_stat) will be
+ *                        returned, otherwise for the current process only.
+ * \param [out] hist      The address of an \ref MDBX_latency_hist structure.
+ * \param [in] bytes      The size of \ref MDBX_latency_hist.
+ *
+ * \returns A non-zero error value on failure and 0 on success,
+ *          some possible errors are:
+ * \retval MDBX_ENOSYS   Histograms are not supported by the build.
+ * \retval MDBX_EINVAL   An invalid parameter was specified. */
+LIBMDBX_API int mdbx_env_latency_hist(const MDBX_env *env, MDBX_latency_kind_t kind, bool aggregate,
+                                      MDBX_latency_hist *hist, size_t bytes);
+
 /** \brief Flush the environment data buffers to disk.
  * \ingroup c_extra
  *
@@ -4417,6 +4695,94 @@ LIBMDBX_API int mdbx_txn_unpark(MDBX_txn *txn, bool restart_if_ousted);
  * \retval MDBX_EINVAL           Transaction handle is NULL. */
 LIBMDBX_API int mdbx_txn_renew(MDBX_txn *txn);
 
+/** \brief Opaque structure for a shared read snapshot.
+ * \ingroup c_transactions
+ *
+ * Разделяемый MVCC-снимок удерживается одним слотом в таблице читателей
+ * и может одновременно использоваться множеством потоков для порождения
+ * легковесных читающих транзакций-представлений посредством
+ * \ref mdbx_snapshot_begin(). Такие транзакции не занимают слотов в таблице
+ * читателей, что устраняет их перерасход при параллельной обработке
+ * запросов пулом потоков.
+ *
+ * \see mdbx_snapshot_acquire()
+ * \see mdbx_snapshot_release() */
+typedef struct MDBX_snapshot MDBX_snapshot;
+
+/** \brief Захватывает разделяемый MVCC-снимок последних данных.
+ * \ingroup c_transactions
+ *
+ * Функция запускает скрытую читающую транзакцию, которая не привязана
+ * к потоку и удерживает снимок до освобождения последней ссылки на него.
+ * Созданный снимок имеет одну ссылку, которая должна быть освобождена
+ * посредством \ref mdbx_snapshot_release().
+ *
+ * \note Разделяемый снимок удерживает переработку MVCC-снимков так же,
+ * как и любая другая читающая транзакция, поэтому его не следует удерживать
+ * долго без необходимости.
+ *
+ * \param [in] env        Экземпляр среды.
+ * \param [out] snapshot  Адрес для возврата указателя на снимок.
+ *
+ * \returns Ненулевое значение кода ошибки, либо 0 при успешном выполнении.
+ * Некоторые возможные ошибки:
+ * \retval MDBX_READERS_FULL  Таблица читателей заполнена.
+ * \retval MDBX_ENOMEM        Недостаточно памяти.
+ * \retval MDBX_EINVAL        Передан нулевой указатель. */
+LIBMDBX_API int mdbx_snapshot_acquire(MDBX_env *env, MDBX_snapshot **snapshot);
+
+/** \brief Захватывает дополнительную ссылку на разделяемый снимок.
+ * \ingroup c_transactions
+ *
+ * Функция потокобезопасна и может вызываться из любого потока.
+ *
+ * \returns Ненулевое значение кода ошибки, либо 0 при успешном выполнении. */
+LIBMDBX_API int mdbx_snapshot_retain(MDBX_snapshot *snapshot);
+
+/** \brief Освобождает ссылку на разделяемый снимок.
+ * \ingroup c_transactions
+ *
+ * При освобождении последней ссылки освобождается и слот в таблице
+ * читателей, а сам снимок уничтожается. Каждая активная транзакция-представление
+ * также удерживает ссылку на снимок, поэтому снимок может быть освобождён
+ * до завершения порождённых от него транзакций.
+ *
+ * Функция потокобезопасна и может вызываться из любого потока.
+ *
+ * \returns Ненулевое значение кода ошибки, либо 0 при успешном выполнении. */
+LIBMDBX_API int mdbx_snapshot_release(MDBX_snapshot *snapshot);
+
+/** \brief Возвращает номер транзакции (MVCC-снимка) разделяемого снимка.
+ * \ingroup c_transactions
+ *
+ * \returns Номер транзакции, либо 0 в случае ошибки. */
+LIBMDBX_API uint64_t mdbx_snapshot_id(const MDBX_snapshot *snapshot);
+
+/** \brief Запускает читающую транзакцию-представление разделяемого снимка.
+ * \ingroup c_transactions
+ *
+ * Транзакция-представление видит данные разделяемого снимка, не занимает слота
+ * в таблице читателей и удерживает ссылку на снимок до своего завершения или
+ * сброса. Работа с транзакцией-представлением выполняется посредством
+ * обычных функций API, в том числе курсоров, а завершается посредством
+ * \ref mdbx_txn_abort(), \ref mdbx_txn_commit() или \ref mdbx_txn_reset().
+ * Парковка транзакций-представлений не поддерживается.
+ *
+ * После сброса посредством \ref mdbx_txn_reset() транзакция-представление может
+ * быть перезапущена посредством \ref mdbx_txn_renew() как обычная читающая
+ * транзакция, либо повторно использована для другого снимка.
+ *
+ * \param [in] snapshot       Разделяемый снимок.
+ * \param [in,out] in_out_txn Адрес указателя на транзакцию. Если по адресу
+ *                            находится ненулевой указатель на читающую
+ *                            транзакцию, то она будет сброшена и повторно
+ *                            использована, иначе будет создан новый экземпляр.
+ * \param [in] context        Указатель на контекст пользователя,
+ *                            см. \ref mdbx_txn_set_userctx().
+ *
+ * \returns Ненулевое значение кода ошибки, либо 0 при успешном выполнении. */
+LIBMDBX_API int mdbx_snapshot_begin(MDBX_snapshot *snapshot, MDBX_txn **in_out_txn, void *context);
+
 /** \brief The fours integers markers (aka "canary") associated with the
  * environment.
  * \ingroup c_crud
@@ -4738,6 +5104,62 @@ MDBX_NOTHROW_PURE_FUNCTION LIBMDBX_API int64_t mdbx_int64_from_key(const MDBX_va
  * \retval MDBX_EINVAL   An invalid parameter was specified. */
 LIBMDBX_API int mdbx_dbi_stat(const MDBX_txn *txn, MDBX_dbi dbi, MDBX_stat *stat, size_t bytes);
 
+/** \brief Per-table counters of operations.
+ * \ingroup c_statinfo
+ * \see mdbx_dbi_opstat()
+ *
+ * \details The counters are accumulated by the environment instance (i.e.
+ * within the current process) since the table handle was opened, including
+ * operations of aborted transactions and failed calls. The counters are
+ * updated by atomic instructions, therefore threads which concurrently operate
+ * with the same table contend for a cache line.
+ *
+ * The counters are collected only if libmdbx was built with
+ * `MDBX_ENABLE_DBI_OPSTAT=1` (disabled by default), otherwise all of ones are
+ * zero. */
+struct MDBX_dbi_opstat {
+  uint64_t gets;  /**< Lookups by \ref mdbx_get(), \ref mdbx_get_ex() and \ref mdbx_get_equal_or_great() */
+  uint64_t puts;  /**< Inserts and updates by \ref mdbx_put(), \ref mdbx_cursor_put() and \ref mdbx_replace() */
+  uint64_t dels;  /**< Deletions by \ref mdbx_del(), \ref mdbx_cursor_del() and \ref mdbx_replace() */
+  uint64_t seeks; /**< Positioning of cursors by a key by \ref mdbx_cursor_get() */
+  uint64_t steps; /**< Moves of cursors relative to current position or to the first/last item
+                       by \ref mdbx_cursor_get() */
+  uint64_t newly; /**< Quantity of a new pages allocated, including large/overflow ones */
+  uint64_t cow;   /**< Quantity of pages copied for update (copy-on-write) */
+  uint64_t split; /**< Page splits */
+  uint64_t merge; /**< Page merges */
+  uint64_t large; /**< Quantity of large/overflow pages allocated for long values */
+};
+#ifndef __cplusplus
+/** \ingroup c_statinfo */
+typedef struct MDBX_dbi_opstat MDBX_dbi_opstat;
+#endif
+
+/** \brief Retrieve the counters of operations for a table.
+ * \ingroup c_statinfo
+ *
+ * Unlike \ref MDBX_envinfo::mi_pgop_stat which is aggregated for the whole
+ * environment, these counters allow to find out which table(s) cause reads
+ * and write amplification. The page-level counters (`newly`, `cow`, `split`,
+ * `merge`, `large`) also include the internal operations with the GC for
+ * \ref FREE_DBI and with records of named tables for \ref MAIN_DBI.
+ *
+ * \param [in] txn     A transaction handle returned by \ref mdbx_txn_begin().
+ * \param [in] dbi     A table handle returned by \ref mdbx_dbi_open().
+ * \param [out] stat   The address of an \ref MDBX_dbi_opstat structure where
+ *                     the counters will be copied.
+ * \param [in] bytes   The size of \ref MDBX_dbi_opstat.
+ * \param [in] reset   Subtract the copied values from the counters, i.e. reset
+ *                     them without losing concurrent increments.
+ *
+ * \returns A non-zero error value on failure and 0 on success,
+ *          some possible errors are:
+ * \retval MDBX_THREAD_MISMATCH  Given transaction is not owned
+ *                               by current thread.
+ * \retval MDBX_BAD_DBI  The table handle is invalid.
+ * \retval MDBX_EINVAL   An invalid parameter was specified. */
+LIBMDBX_API int mdbx_dbi_opstat(const MDBX_txn *txn, MDBX_dbi dbi, MDBX_dbi_opstat *stat, size_t bytes, bool reset);
+
 /** \brief Retrieve depth (bitmask) information of nested dupsort (multi-value)
  * B+trees for given table.
  * \ingroup c_statinfo
@@ -6434,7 +6856,19 @@ typedef enum MDBX_chk_flags {
   /** Игнорировать порядок ключей и записей.
    * \note Требуется при проверке унаследованных БД созданных с использованием
    * нестандартных (пользовательских) функций сравнения ключей или значений. */
-  MDBX_CHK_IGNORE_ORDER = 8
+  MDBX_CHK_IGNORE_ORDER = 8,
+
+  /** Проверять таблицы параллельно в несколько потоков.
+   *
+   * Обход страниц и просмотр записей именованных таблиц распределяется между
+   * потоками, количество которых ограничивается опцией сборки
+   * `MDBX_ENVCHK_THREADS`. Информация о ходе проверки и найденных проблемах
+   * накапливается отдельно для каждой таблицы и передаётся через функции
+   * обратного вызова в исходном порядке таблиц из вызвавшего потока.
+   * При этом не передаются строки, детализация которых превышает уровень
+   * текущего контекста проверки, а просмотр записей выполняется
+   * последовательно, если задана функция обратного вызова `table_handle_kv`. */
+  MDBX_CHK_PARALLEL = 16
 } MDBX_chk_flags_t;
 DEFINE_ENUM_FLAG_OPERATORS(MDBX_chk_flags)
 
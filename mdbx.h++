@@ -62,6 +62,9 @@
 #include <climits>     // for CHAR_BIT
 #include <cstring>     // for std::strlen, str:memcmp
 #include <exception>   // for std::exception_ptr
+#include <future>      // for std::promise<>, std::future<>
+#include <iterator>    // for std::input_iterator_tag
+#include <memory>      // for std::unique_ptr<>
 #include <ostream>     // for std::ostream
 #include <sstream>     // for std::ostringstream
 #include <stdexcept>   // for std::invalid_argument
@@ -103,10 +106,20 @@
 #include <filesystem>
 #endif
 
+#if defined(__cpp_lib_ranges) && __cpp_lib_ranges >= 201911L
+#include <ranges>
+#endif
+
 #if defined(__cpp_lib_span) && __cpp_lib_span >= 202002L
 #include <span>
 #endif
 
+#if defined(__cpp_impl_coroutine) && __cpp_impl_coroutine >= 201902L && defined(__has_include)
+#if __has_include(<coroutine>)
+#include <coroutine>
+#endif
+#endif /* __cpp_impl_coroutine */
+
 #if !defined(_MSC_VER) || defined(__clang__)
 /* adequate compilers */
 #define MDBX_EXTERN_API_TEMPLATE(API_ATTRIBUTES, API_TYPENAME) extern template class API_ATTRIBUTES API_TYPENAME
@@ -179,6 +192,13 @@
 #define MDBX_CXX20_CONSTEXPR inline
 #endif /* MDBX_CXX20_CONSTEXPR */
 
+/** Workaround for old compilers and libraries without C++20 `std::bit_cast()`. */
+#if defined(DOXYGEN) || (defined(__cpp_lib_bit_cast) && __cpp_lib_bit_cast >= 201806L)
+#define MDBX_CXX20_BITCAST_CONSTEXPR constexpr
+#else
+#define MDBX_CXX20_BITCAST_CONSTEXPR inline
+#endif /* MDBX_CXX20_BITCAST_CONSTEXPR */
+
 #if CONSTEXPR_ENUM_FLAGS_OPERATIONS || defined(DOXYGEN)
 #define MDBX_CXX01_CONSTEXPR_ENUM MDBX_CXX01_CONSTEXPR
 #define MDBX_CXX11_CONSTEXPR_ENUM MDBX_CXX11_CONSTEXPR
@@ -369,6 +389,8 @@ class txn;
 class txn_managed;
 class cursor;
 class cursor_managed;
+class cursor_range;
+class write_queue;
 
 /// \brief Default buffer.
 using default_buffer = buffer<default_allocator, default_capacity_policy>;
@@ -2610,57 +2632,92 @@ public:
 
   //----------------------------------------------------------------------------
 
-  template <size_t SIZE> static buffer key_from(const char (&text)[SIZE], bool make_reference = true) {
-    return buffer(::mdbx::slice(text), make_reference);
+  template <size_t SIZE>
+  static buffer key_from(const char (&text)[SIZE], bool make_reference = true,
+                         const allocator_type &allocator = allocator_type()) {
+    return buffer(::mdbx::slice(text), make_reference, allocator);
   }
 
 #if defined(DOXYGEN) || (defined(__cpp_lib_string_view) && __cpp_lib_string_view >= 201606L)
   template <class CHAR, class T>
-  static buffer key_from(const ::std::basic_string_view<CHAR, T> &src, bool make_reference = false) {
-    return buffer(src, make_reference);
+  static buffer key_from(const ::std::basic_string_view<CHAR, T> &src, bool make_reference = false,
+                         const allocator_type &allocator = allocator_type()) {
+    return buffer(src, make_reference, allocator);
   }
 #endif /* __cpp_lib_string_view >= 201606L */
 
-  static buffer key_from(const char *src, bool make_reference = false) { return buffer(src, make_reference); }
+  static buffer key_from(const char *src, bool make_reference = false,
+                         const allocator_type &allocator = allocator_type()) {
+    return buffer(src, make_reference, allocator);
+  }
 
   template <class CHAR, class T, class A>
-  static buffer key_from(const ::std::basic_string<CHAR, T, A> &src, bool make_reference = false) {
-    return buffer(src, make_reference);
+  static buffer key_from(const ::std::basic_string<CHAR, T, A> &src, bool make_reference = false,
+                         const allocator_type &allocator = allocator_type()) {
+    return buffer(::mdbx::slice(src), make_reference, allocator);
   }
 
   static buffer key_from(silo &&src) noexcept { return buffer(::std::move(src)); }
 
-  static buffer key_from_double(const double ieee754_64bit) { return wrap(::mdbx_key_from_double(ieee754_64bit)); }
+  static buffer key_from_double(const double ieee754_64bit, const allocator_type &allocator = allocator_type()) {
+    return wrap(::mdbx_key_from_double(ieee754_64bit), false, allocator);
+  }
 
-  static buffer key_from(const double ieee754_64bit) { return key_from_double(ieee754_64bit); }
+  static buffer key_from(const double ieee754_64bit, const allocator_type &allocator = allocator_type()) {
+    return key_from_double(ieee754_64bit, allocator);
+  }
 
-  static buffer key_from(const double *ieee754_64bit) { return wrap(::mdbx_key_from_ptrdouble(ieee754_64bit)); }
+  static buffer key_from(const double *ieee754_64bit, const allocator_type &allocator = allocator_type()) {
+    return wrap(::mdbx_key_from_ptrdouble(ieee754_64bit), false, allocator);
+  }
 
-  static buffer key_from_u64(const uint64_t unsigned_int64) { return wrap(unsigned_int64); }
+  static buffer key_from_u64(const uint64_t unsigned_int64, const allocator_type &allocator = allocator_type()) {
+    return wrap(unsigned_int64, false, allocator);
+  }
 
-  static buffer key_from(const uint64_t unsigned_int64) { return key_from_u64(unsigned_int64); }
+  static buffer key_from(const uint64_t unsigned_int64, const allocator_type &allocator = allocator_type()) {
+    return key_from_u64(unsigned_int64, allocator);
+  }
 
-  static buffer key_from_i64(const int64_t signed_int64) { return wrap(::mdbx_key_from_int64(signed_int64)); }
+  static buffer key_from_i64(const int64_t signed_int64, const allocator_type &allocator = allocator_type()) {
+    return wrap(::mdbx_key_from_int64(signed_int64), false, allocator);
+  }
 
-  static buffer key_from(const int64_t signed_int64) { return key_from_i64(signed_int64); }
+  static buffer key_from(const int64_t signed_int64, const allocator_type &allocator = allocator_type()) {
+    return key_from_i64(signed_int64, allocator);
+  }
 
-  static buffer key_from_jsonInteger(const int64_t json_integer) {
-    return wrap(::mdbx_key_from_jsonInteger(json_integer));
+  static buffer key_from_jsonInteger(const int64_t json_integer, const allocator_type &allocator = allocator_type()) {
+    return wrap(::mdbx_key_from_jsonInteger(json_integer), false, allocator);
   }
 
-  static buffer key_from_float(const float ieee754_32bit) { return wrap(::mdbx_key_from_float(ieee754_32bit)); }
+  static buffer key_from_float(const float ieee754_32bit, const allocator_type &allocator = allocator_type()) {
+    return wrap(::mdbx_key_from_float(ieee754_32bit), false, allocator);
+  }
 
-  static buffer key_from(const float ieee754_32bit) { return key_from_float(ieee754_32bit); }
+  static buffer key_from(const float ieee754_32bit, const allocator_type &allocator = allocator_type()) {
+    return key_from_float(ieee754_32bit, allocator);
+  }
 
-  static buffer key_from(const float *ieee754_32bit) { return wrap(::mdbx_key_from_ptrfloat(ieee754_32bit)); }
+  static buffer key_from(const float *ieee754_32bit, const allocator_type &allocator = allocator_type()) {
+    return wrap(::mdbx_key_from_ptrfloat(ieee754_32bit), false, allocator);
+  }
 
-  static buffer key_from_u32(const uint32_t unsigned_int32) { return wrap(unsigned_int32); }
+  static buffer key_from_u32(const uint32_t unsigned_int32, const allocator_type &allocator = allocator_type()) {
+    return wrap(unsigned_int32, false, allocator);
+  }
 
-  static buffer key_from(const uint32_t unsigned_int32) { return key_from_u32(unsigned_int32); }
+  static buffer key_from(const uint32_t unsigned_int32, const allocator_type &allocator = allocator_type()) {
+    return key_from_u32(unsigned_int32, allocator);
+  }
 
-  static buffer key_from_i32(const int32_t signed_int32) { return wrap(::mdbx_key_from_int32(signed_int32)); }
+  static buffer key_from_i32(const int32_t signed_int32, const allocator_type &allocator = allocator_type()) {
+    return wrap(::mdbx_key_from_int32(signed_int32), false, allocator);
+  }
 
-  static buffer key_from(const int32_t signed_int32) { return key_from_i32(signed_int32); }
+  static buffer key_from(const int32_t signed_int32, const allocator_type &allocator = allocator_type()) {
+    return key_from_i32(signed_int32, allocator);
+  }
 };
 
 template <class ALLOCATOR, class CAPACITY_POLICY, MDBX_CXX20_CONCEPT(MutableByteProducer, PRODUCER)>
@@ -3799,6 +3856,12 @@ public:
   /// \brief Opens cursor for specified key-value map handle.
   inline cursor_managed open_cursor(map_handle map) const;
 
+  /// \brief Opens cursor and returns a view of key-value pairs within
+  /// `[from, to)` range of keys.
+  /// \see cursor::range()
+  inline cursor_range scan(map_handle map, const slice &from = slice::invalid(), const slice &to = slice::invalid(),
+                           bool backward = false) const;
+
   /// \brief Unbind or close all cursors.
   inline size_t release_all_cursors(bool unbind) const;
 
@@ -3921,6 +3984,10 @@ public:
   using map_stat = ::MDBX_stat;
   /// \brief Returns statistics for a table.
   inline map_stat get_map_stat(map_handle map) const;
+  using map_opstat = ::MDBX_dbi_opstat;
+  /// \brief Returns the counters of operations for a table.
+  /// \see ::mdbx_dbi_opstat()
+  inline map_opstat get_map_opstat(map_handle map, bool reset = false) const;
   /// \brief Returns depth (bitmask) information of nested dupsort (multi-value)
   /// B+trees for given table.
   inline uint32_t get_tree_deepmask(map_handle map) const;
@@ -4068,19 +4135,29 @@ class LIBMDBX_API_TYPE txn_managed : public txn {
   using inherited = txn;
   friend class env;
   friend class txn;
+  /* the scratch arena, which is created on demand and released at the end
+   * of transaction, see scratch_allocator() */
+  struct scratch;
+  scratch *scratch_{nullptr};
+  void release_scratch() noexcept;
   /// delegated constructor for RAII
   MDBX_CXX11_CONSTEXPR txn_managed(MDBX_txn *ptr) noexcept : inherited(ptr) {}
 
 public:
   MDBX_CXX11_CONSTEXPR txn_managed() noexcept = default;
-  txn_managed(txn_managed &&) = default;
+  txn_managed(txn_managed &&other) noexcept : inherited(::std::move(other)), scratch_(other.scratch_) {
+    other.scratch_ = nullptr;
+  }
   txn_managed &operator=(txn_managed &&other) noexcept {
     if (MDBX_UNLIKELY(handle_))
       MDBX_CXX20_UNLIKELY {
         assert(handle_ != other.handle_);
         abort();
       }
+    release_scratch();
     inherited::operator=(std::move(other));
+    scratch_ = other.scratch_;
+    other.scratch_ = nullptr;
     return *this;
   }
   txn_managed(const txn_managed &) = delete;
@@ -4118,6 +4195,34 @@ public:
     commit(&result);
     return result;
   }
+
+#if defined(DOXYGEN) ||                                                                                                \
+    (defined(__cpp_lib_memory_resource) && __cpp_lib_memory_resource >= 201603L && _GLIBCXX_USE_CXX11_ABI)
+  /// \brief Returns the scratch arena of the transaction.
+  ///
+  /// The arena is a monotonic (i.e. bump) memory resource, which is created
+  /// on the first demand and released at the end of the transaction,
+  /// i.e. by commit, abort or destruction. So the short-lived buffers and
+  /// strings allocated from the arena cost almost nothing, but must not be
+  /// used after the transaction ends, just like slices of the data inside
+  /// the database.
+  ///
+  /// The arena takes the blocks from the current default memory resource
+  /// (see `std::pmr::get_default_resource()`), except the first small one
+  /// which is embedded into the arena itself.
+  /// \see scratch_allocator()
+  ::std::pmr::memory_resource *scratch_resource();
+
+  /// \brief Returns the allocator of the scratch arena of the transaction.
+  /// \details For instance:
+  /// \code
+  ///  auto value = mdbx::default_buffer(txn.get(map, key), txn.scratch_allocator());
+  ///  auto hex = value.slice().as_hex_string(false, 0, txn.scratch_allocator());
+  ///  auto key = mdbx::default_buffer::key_from(name, false, txn.scratch_allocator());
+  /// \endcode
+  /// \see scratch_resource()
+  polymorphic_allocator scratch_allocator() { return polymorphic_allocator(scratch_resource()); }
+#endif /* __cpp_lib_memory_resource >= 201603L */
 };
 
 /// \brief Unmanaged cursor.
@@ -4281,6 +4386,17 @@ public:
     return scan(std::move(predicate), backward ? last : first, backward ? previous : next);
   }
 
+  /// \brief Returns a view of key-value pairs within `[from, to)` range of
+  /// keys, either in ascending or descending order.
+  /// \details The \ref slice::invalid() for any of the bounds means that the
+  /// range is unbounded on this side. The cursor is moved during iteration
+  /// over the view, so it should not be used otherwise meanwhile.
+  /// \see cursor_range
+  inline cursor_range range(const slice &from, const slice &to, bool backward = false);
+
+  /// \brief Returns a view of all key-value pairs.
+  inline cursor_range range(bool backward = false);
+
   template <typename CALLABLE_PREDICATE>
   bool scan_from(CALLABLE_PREDICATE predicate, slice &from, move_operation start = key_greater_or_equal,
                  move_operation turn = next) {
@@ -4563,6 +4679,736 @@ public:
   ~cursor_managed() noexcept { ::mdbx_cursor_close(handle_); }
 };
 
+/// \brief A single-pass view of key-value pairs within a range of keys.
+///
+/// The pairs are fetched ahead by blocks, i.e. through the
+/// \ref mdbx_cursor_get_batch() for forward iteration over non-multivalue
+/// maps, or by stepping the cursor immediately via C API without per-item
+/// exception checks in other cases. The bounds are checked once per block
+/// unless the range ends within it. The iterators provide \ref pair of
+/// slices pointing to the data inside the database without any
+/// allocations, so ones are valid until the transaction ends or the data
+/// changes.
+///
+/// The view satisfies the `std::ranges::input_range` and `std::ranges::view`
+/// concepts when C++20 ranges are available, and could be used by the
+/// range-based `for` loop in any case.
+///
+/// \see cursor::range()
+/// \see txn::scan()
+class cursor_range
+#if defined(__cpp_lib_ranges) && __cpp_lib_ranges >= 201911L
+    : public ::std::ranges::view_base
+#endif /* __cpp_lib_ranges */
+{
+  friend class cursor;
+  friend class txn;
+  template <typename, typename, class, bool> friend class table;
+  enum : size_t {
+    /* number of slices per block, i.e. keys and values */
+    block_size = 2 * 64
+  };
+
+  MDBX_cursor *handle_{nullptr};
+  /* a cursor to be closed, when the view was created by txn::scan() */
+  MDBX_cursor *owned_{nullptr};
+  slice from_, to_;
+  bool backward_{false}, batched_{false}, started_{false}, finished_{false};
+  size_t head_{0}, tail_{0};
+  MDBX_val block_[block_size];
+
+  cursor_range(MDBX_cursor *handle, const slice &from, const slice &to, bool backward) noexcept
+      : handle_(handle), from_(from), to_(to), backward_(backward) {}
+  inline bool out_of_range(const MDBX_val &key) const;
+  inline bool fetch();
+
+public:
+  /// \brief Input iterator over the \ref cursor_range.
+  class iterator {
+    friend class cursor_range;
+    cursor_range *range_{nullptr};
+    MDBX_CXX11_CONSTEXPR iterator(cursor_range *range) noexcept : range_(range) {}
+    bool at_end() const noexcept { return !range_ || range_->head_ >= range_->tail_; }
+
+  public:
+    using iterator_category = ::std::input_iterator_tag;
+    using value_type = pair;
+    using difference_type = ::std::ptrdiff_t;
+    using pointer = void;
+    using reference = pair;
+
+    MDBX_CXX11_CONSTEXPR iterator() noexcept = default;
+    reference operator*() const {
+      assert(!at_end());
+      return pair(range_->block_[range_->head_], range_->block_[range_->head_ + 1]);
+    }
+    iterator &operator++() {
+      assert(!at_end());
+      range_->head_ += 2;
+      range_->fetch();
+      return *this;
+    }
+    iterator operator++(int) {
+      iterator prev(*this);
+      ++*this;
+      return prev;
+    }
+    friend bool operator==(const iterator &a, const iterator &b) noexcept { return a.at_end() == b.at_end(); }
+    friend bool operator!=(const iterator &a, const iterator &b) noexcept { return a.at_end() != b.at_end(); }
+  };
+
+  cursor_range() noexcept = default;
+  inline cursor_range(cursor_range &&other) noexcept;
+  inline cursor_range &operator=(cursor_range &&other) noexcept;
+  cursor_range(const cursor_range &) = delete;
+  cursor_range &operator=(const cursor_range &) = delete;
+  ~cursor_range() noexcept { ::mdbx_cursor_close(owned_); }
+
+  /// \brief Starts the iteration, i.e. positions the cursor at the first
+  /// pair of the range and fetches the first block.
+  iterator begin() {
+    fetch();
+    return iterator(this);
+  }
+  iterator end() noexcept { return iterator(); }
+  /// \brief Checks whether no pairs left.
+  bool empty() { return !fetch(); }
+};
+
+//------------------------------------------------------------------------------
+
+/// \brief Order-preserving transformations of numbers into unsigned integer
+/// keys, i.e. the inline counterparts of \ref mdbx_key_from_double(),
+/// \ref mdbx_key_from_jsonInteger() and so on.
+///
+/// The resulting keys are suitable for \ref key_mode::ordinal and
+/// \ref value_mode::multi_ordinal, since ones are compared as unsigned
+/// integers in the same order as the source numbers.
+/// \ingroup cxx_data
+namespace key_transform {
+
+MDBX_CXX11_CONSTEXPR uint64_t from_int64(int64_t value) noexcept {
+  return uint64_t(value) + UINT64_C(0x8000000000000000);
+}
+MDBX_CXX11_CONSTEXPR int64_t to_int64(uint64_t key) noexcept { return int64_t(key - UINT64_C(0x8000000000000000)); }
+
+MDBX_CXX11_CONSTEXPR uint32_t from_int32(int32_t value) noexcept { return uint32_t(value) + UINT32_C(0x80000000); }
+MDBX_CXX11_CONSTEXPR int32_t to_int32(uint32_t key) noexcept { return int32_t(key - UINT32_C(0x80000000)); }
+
+/// \brief Transforms bits of IEEE754 binary64 number into an ordinal key.
+MDBX_CXX11_CONSTEXPR uint64_t from_ieee754_64bit(uint64_t bits) noexcept {
+  return (bits & UINT64_C(0x8000000000000000)) ? ~bits : bits | UINT64_C(0x8000000000000000);
+}
+MDBX_CXX11_CONSTEXPR uint64_t to_ieee754_64bit(uint64_t key) noexcept {
+  return (key & UINT64_C(0x8000000000000000)) ? key ^ UINT64_C(0x8000000000000000) : ~key;
+}
+
+/// \brief Transforms bits of IEEE754 binary32 number into an ordinal key.
+MDBX_CXX11_CONSTEXPR uint32_t from_ieee754_32bit(uint32_t bits) noexcept {
+  return (bits & UINT32_C(0x80000000)) ? ~bits : bits | UINT32_C(0x80000000);
+}
+MDBX_CXX11_CONSTEXPR uint32_t to_ieee754_32bit(uint32_t key) noexcept {
+  return (key & UINT32_C(0x80000000)) ? key ^ UINT32_C(0x80000000) : ~key;
+}
+
+#if defined(__cpp_lib_bit_cast) && __cpp_lib_bit_cast >= 201806L
+template <typename TO, typename FROM> constexpr TO bit_cast(const FROM &from) noexcept {
+  return ::std::bit_cast<TO>(from);
+}
+#else
+template <typename TO, typename FROM> inline TO bit_cast(const FROM &from) noexcept {
+  static_assert(sizeof(TO) == sizeof(FROM), "Must be the same size");
+  TO to;
+  ::std::memcpy(&to, &from, sizeof(to));
+  return to;
+}
+#endif /* __cpp_lib_bit_cast */
+
+/// \brief The same as \ref mdbx_key_from_double(), but inline.
+MDBX_CXX20_BITCAST_CONSTEXPR uint64_t from_double(double value) noexcept {
+  static_assert(sizeof(double) == sizeof(uint64_t), "Unexpected size of double");
+  return from_ieee754_64bit(bit_cast<uint64_t>(value));
+}
+/// \brief The same as \ref mdbx_double_from_key(), but inline.
+MDBX_CXX20_BITCAST_CONSTEXPR double to_double(uint64_t key) noexcept {
+  return bit_cast<double>(to_ieee754_64bit(key));
+}
+
+/// \brief The same as \ref mdbx_key_from_float(), but inline.
+MDBX_CXX20_BITCAST_CONSTEXPR uint32_t from_float(float value) noexcept {
+  static_assert(sizeof(float) == sizeof(uint32_t), "Unexpected size of float");
+  return from_ieee754_32bit(bit_cast<uint32_t>(value));
+}
+/// \brief The same as \ref mdbx_float_from_key(), but inline.
+MDBX_CXX20_BITCAST_CONSTEXPR float to_float(uint32_t key) noexcept { return bit_cast<float>(to_ieee754_32bit(key)); }
+
+/// \brief The same as \ref mdbx_key_from_jsonInteger(), but inline.
+/// \details Rounding of an integer to the nearest double is performed by the
+/// compiler or FPU, which is an exact equivalent of the rounding done by
+/// \ref mdbx_key_from_jsonInteger() under the default rounding mode.
+MDBX_CXX20_BITCAST_CONSTEXPR uint64_t from_json_integer(int64_t value) noexcept { return from_double(double(value)); }
+/// \brief The same as \ref mdbx_jsonInteger_from_key(), but inline.
+MDBX_CXX20_BITCAST_CONSTEXPR int64_t to_json_integer(uint64_t key) noexcept {
+  const double value = to_double(key);
+  if (MDBX_UNLIKELY(!(value >= -9223372036854775808.0 && value < 9223372036854775808.0)))
+    /* saturation for out of range and NaN */
+    return (key < UINT64_C(0x8000000000000000)) ? INT64_MIN : INT64_MAX;
+  return int64_t(value);
+}
+
+} // namespace key_transform
+
+/// \brief Read-only zero-copy view of a trivially copyable object stored
+/// within a database.
+/// \ingroup cxx_data
+///
+/// Refers to the data inside the database without copying, so it is valid
+/// until the transaction ends or the data changes. Since data inside the
+/// database are not aligned in general, the \ref get() makes a copy of the
+/// object, but the \ref address() provides a direct access when alignment
+/// permits it.
+template <typename T> class pod_view {
+  static_assert(::std::is_trivially_copyable<T>::value, "Must be a trivially copyable type!");
+  slice bytes_;
+
+public:
+  MDBX_CXX11_CONSTEXPR pod_view() noexcept = default;
+  explicit pod_view(const slice &bytes) : bytes_(bytes) {
+    if (MDBX_UNLIKELY(bytes.length() != sizeof(T)))
+      MDBX_CXX20_UNLIKELY throw_bad_value_size();
+  }
+
+  /// \brief Returns a slice of the object representation.
+  MDBX_CXX11_CONSTEXPR const slice &bytes() const noexcept { return bytes_; }
+  /// \brief Returns the address of the object representation.
+  MDBX_CXX11_CONSTEXPR const void *data() const noexcept { return bytes_.data(); }
+  /// \brief Checks whether the object is properly aligned for direct access.
+  bool is_aligned() const noexcept { return reinterpret_cast<uintptr_t>(bytes_.data()) % alignof(T) == 0; }
+  /// \brief Returns the pointer to the object inside the database or
+  /// `nullptr` if one is not properly aligned.
+  const T *address() const noexcept { return is_aligned() ? static_cast<const T *>(bytes_.data()) : nullptr; }
+  /// \brief Returns a copy of the object.
+  T get() const noexcept {
+    T result;
+    ::std::memcpy(&result, bytes_.data(), sizeof(T));
+    return result;
+  }
+  operator T() const noexcept { return get(); }
+};
+
+/// \brief Codecs of keys and values for \ref table, which are chosen at
+/// compile time from the type.
+/// \ingroup cxx_data
+///
+/// Each codec provides:
+///  - `storage` type of a scratch space to encode an item into;
+///  - `decoded` type of a decoded item, which may refers to the data
+///    inside the database, for instance \ref pod_view or `std::string_view`;
+///  - `keys()` the \ref key_mode for the encoded keys;
+///  - `multivalues()` the \ref value_mode for the encoded values
+///    of a multi-value table;
+///  - `encode(item, storage)` returns a slice of the encoded item, which
+///    refers either to the item itself or to the storage;
+///  - `decode(slice)` returns a decoded item.
+///
+/// Specialize the \ref codec or provide another set of codecs through the
+/// `CODECS` parameter of the \ref table to support other types.
+template <typename T, typename ENABLE = void> struct codec {
+  static_assert(sizeof(T) != sizeof(T), "No codec for the type, please specialize the mdbx::codec<> template");
+};
+
+/// \brief Unsigned integers are stored as ordinal 32- or 64-bit keys and
+/// values.
+template <typename T>
+struct codec<T, typename ::std::enable_if<::std::is_integral<T>::value && ::std::is_unsigned<T>::value>::type> {
+  using storage = typename ::std::conditional<(sizeof(T) > 4), uint64_t, uint32_t>::type;
+  using decoded = T;
+  static MDBX_CXX11_CONSTEXPR ::mdbx::key_mode keys() noexcept { return ::mdbx::key_mode::ordinal; }
+  static MDBX_CXX11_CONSTEXPR value_mode multivalues() noexcept { return value_mode::multi_ordinal; }
+  static slice encode(const T &item, storage &buf) noexcept {
+    buf = storage(item);
+    return slice(&buf, sizeof(buf));
+  }
+  static decoded decode(const slice &data) { return decoded(data.as_pod<storage>()); }
+};
+
+/// \brief Signed integers are biased by \ref key_transform::from_int64()
+/// or \ref key_transform::from_int32() to be stored as ordinal keys and
+/// values.
+template <typename T>
+struct codec<T, typename ::std::enable_if<::std::is_integral<T>::value && ::std::is_signed<T>::value>::type> {
+  using storage = typename ::std::conditional<(sizeof(T) > 4), uint64_t, uint32_t>::type;
+  using decoded = T;
+  static MDBX_CXX11_CONSTEXPR ::mdbx::key_mode keys() noexcept { return ::mdbx::key_mode::ordinal; }
+  static MDBX_CXX11_CONSTEXPR value_mode multivalues() noexcept { return value_mode::multi_ordinal; }
+  static slice encode(const T &item, storage &buf) noexcept {
+    buf = (sizeof(T) > 4) ? storage(key_transform::from_int64(item)) : storage(key_transform::from_int32(int32_t(item)));
+    return slice(&buf, sizeof(buf));
+  }
+  static decoded decode(const slice &data) {
+    return (sizeof(T) > 4) ? decoded(key_transform::to_int64(data.as_pod<storage>()))
+                           : decoded(key_transform::to_int32(uint32_t(data.as_pod<storage>())));
+  }
+};
+
+/// \brief Floating point numbers are transformed by
+/// \ref key_transform::from_double() or \ref key_transform::from_float() to
+/// be stored as ordinal keys and values.
+template <typename T>
+struct codec<T, typename ::std::enable_if<::std::is_same<T, double>::value || ::std::is_same<T, float>::value>::type> {
+  using storage = typename ::std::conditional<::std::is_same<T, double>::value, uint64_t, uint32_t>::type;
+  using decoded = T;
+  static MDBX_CXX11_CONSTEXPR ::mdbx::key_mode keys() noexcept { return ::mdbx::key_mode::ordinal; }
+  static MDBX_CXX11_CONSTEXPR value_mode multivalues() noexcept { return value_mode::multi_ordinal; }
+  static slice encode(const T &item, storage &buf) noexcept {
+    buf = (sizeof(T) > 4) ? storage(key_transform::from_double(item))
+                          : storage(key_transform::from_float(float(item)));
+    return slice(&buf, sizeof(buf));
+  }
+  static decoded decode(const slice &data) {
+    return (sizeof(T) > 4) ? decoded(key_transform::to_double(data.as_pod<storage>()))
+                           : decoded(key_transform::to_float(uint32_t(data.as_pod<storage>())));
+  }
+};
+
+/// \brief Enumerations are stored as the underlying integer type.
+template <typename T> struct codec<T, typename ::std::enable_if<::std::is_enum<T>::value>::type> {
+  using underlying = codec<typename ::std::underlying_type<T>::type>;
+  using storage = typename underlying::storage;
+  using decoded = T;
+  static MDBX_CXX11_CONSTEXPR ::mdbx::key_mode keys() noexcept { return underlying::keys(); }
+  static MDBX_CXX11_CONSTEXPR value_mode multivalues() noexcept { return underlying::multivalues(); }
+  static slice encode(const T &item, storage &buf) noexcept {
+    return underlying::encode(typename ::std::underlying_type<T>::type(item), buf);
+  }
+  static decoded decode(const slice &data) { return decoded(underlying::decode(data)); }
+};
+
+/// \brief Trivially copyable classes are stored as is, i.e. compared
+/// lexicographically by bytes as keys, and decoded into a zero-copy
+/// \ref pod_view.
+template <typename T>
+struct codec<T, typename ::std::enable_if<::std::is_class<T>::value && ::std::is_trivially_copyable<T>::value>::type> {
+  struct storage {};
+  using decoded = pod_view<T>;
+  static MDBX_CXX11_CONSTEXPR ::mdbx::key_mode keys() noexcept { return ::mdbx::key_mode::usual; }
+  static MDBX_CXX11_CONSTEXPR value_mode multivalues() noexcept { return value_mode::multi_samelength; }
+  static slice encode(const T &item, storage &) noexcept { return slice(&item, sizeof(T)); }
+  static decoded decode(const slice &data) { return decoded(data); }
+};
+
+/// \brief Slices are stored as is and decoded without copying.
+template <> struct codec<slice, void> {
+  struct storage {};
+  using decoded = slice;
+  static MDBX_CXX11_CONSTEXPR ::mdbx::key_mode keys() noexcept { return ::mdbx::key_mode::usual; }
+  static MDBX_CXX11_CONSTEXPR value_mode multivalues() noexcept { return value_mode::multi; }
+  static slice encode(const slice &item, storage &) noexcept { return item; }
+  static decoded decode(const slice &data) noexcept { return data; }
+};
+
+#if defined(__cpp_lib_string_view) && __cpp_lib_string_view >= 201606L
+/// \brief String views are stored as is and decoded without copying.
+template <class CHAR, class T> struct codec<::std::basic_string_view<CHAR, T>, void> {
+  static_assert(sizeof(CHAR) == 1, "Must be single byte characters");
+  struct storage {};
+  using decoded = ::std::basic_string_view<CHAR, T>;
+  static MDBX_CXX11_CONSTEXPR ::mdbx::key_mode keys() noexcept { return ::mdbx::key_mode::usual; }
+  static MDBX_CXX11_CONSTEXPR value_mode multivalues() noexcept { return value_mode::multi; }
+  static slice encode(const decoded &item, storage &) noexcept { return slice(item); }
+  static decoded decode(const slice &data) noexcept { return data.string_view<CHAR, T>(); }
+};
+#endif /* __cpp_lib_string_view >= 201606L */
+
+/// \brief Strings are stored as is, but decoded with copying.
+template <class CHAR, class T, class A> struct codec<::std::basic_string<CHAR, T, A>, void> {
+  static_assert(sizeof(CHAR) == 1, "Must be single byte characters");
+  struct storage {};
+  using decoded = ::std::basic_string<CHAR, T, A>;
+  static MDBX_CXX11_CONSTEXPR ::mdbx::key_mode keys() noexcept { return ::mdbx::key_mode::usual; }
+  static MDBX_CXX11_CONSTEXPR value_mode multivalues() noexcept { return value_mode::multi; }
+  static slice encode(const decoded &item, storage &) noexcept { return slice(item.data(), item.length()); }
+  static decoded decode(const slice &data) { return data.as_string<CHAR, T, A>(); }
+};
+
+/// \brief The default set of codecs for \ref table.
+/// \ingroup cxx_data
+struct default_codecs {
+  template <typename T> using of = codec<T>;
+};
+
+/// \brief Typed table, i.e. a \ref map_handle with compile-time chosen
+/// key and value codecs.
+/// \ingroup cxx_api
+///
+/// The key and value modes, i.e. the `MDBX_INTEGERKEY`, `MDBX_DUPFIXED`,
+/// `MDBX_INTEGERDUP` and related flags, are chosen at compile time from the
+/// key and value types by the codecs. So integers and floating point numbers
+/// are compared by the fast integer comparators, and trivially copyable
+/// values are returned as zero-copy views into the database.
+///
+/// The table is a lightweight handle like the \ref map_handle, it may be
+/// copied freely and used with any transaction of the same environment.
+///
+/// \tparam KEY The type of keys.
+/// \tparam VALUE The type of values.
+/// \tparam CODECS The set of codecs, see \ref default_codecs.
+/// \tparam MULTIVALUE Whether a key may have multiple sorted values,
+/// see \ref multi_table.
+template <typename KEY, typename VALUE, class CODECS = default_codecs, bool MULTIVALUE = false> class table {
+public:
+  using key_type = KEY;
+  using mapped_type = VALUE;
+  using key_codec = typename CODECS::template of<KEY>;
+  using value_codec = typename CODECS::template of<VALUE>;
+  using decoded_key = typename key_codec::decoded;
+  using decoded_value = typename value_codec::decoded;
+  using value_type = ::std::pair<decoded_key, decoded_value>;
+
+  /// \brief Returns the key mode chosen for the key type.
+  static MDBX_CXX11_CONSTEXPR ::mdbx::key_mode keys() noexcept { return key_codec::keys(); }
+  /// \brief Returns the value mode chosen for the value type.
+  static MDBX_CXX11_CONSTEXPR ::mdbx::value_mode values() noexcept {
+    return MULTIVALUE ? value_codec::multivalues() : ::mdbx::value_mode::single;
+  }
+
+  /// \brief The view of decoded key-value pairs, see \ref cursor_range.
+  class range;
+
+  MDBX_CXX11_CONSTEXPR table() noexcept = default;
+  MDBX_CXX11_CONSTEXPR explicit table(map_handle map) noexcept : map_(map) {}
+
+  /// \brief Opens an existing table, the flags of which must be compatible
+  /// with the key and value types.
+  static table open(const txn &txn, const char *name) { return table(txn.open_map(name, keys(), values())); }
+  static table open(const txn &txn, const ::std::string &name) { return open(txn, name.c_str()); }
+  /// \brief Opens or creates the table.
+  static table create(txn &txn, const char *name) { return table(txn.create_map(name, keys(), values())); }
+  static table create(txn &txn, const ::std::string &name) { return create(txn, name.c_str()); }
+
+  MDBX_CXX11_CONSTEXPR map_handle map() const noexcept { return map_; }
+  MDBX_CXX11_CONSTEXPR operator map_handle() const noexcept { return map_; }
+
+  /// \brief Returns the value, or the first one for multi-value table, for
+  /// the key or throws an exception if the key is absent.
+  decoded_value get(const txn &txn, const KEY &key) const {
+    typename key_codec::storage k;
+    return value_codec::decode(txn.get(map_, key_codec::encode(key, k)));
+  }
+  /// \brief Returns the value, or the first one for multi-value table, for
+  /// the key or the `if_absent` if the key is absent.
+  decoded_value get(const txn &txn, const KEY &key, const decoded_value &if_absent) const {
+    typename key_codec::storage k;
+    const slice value = txn.get(map_, key_codec::encode(key, k), slice::invalid());
+    return value.is_valid() ? value_codec::decode(value) : if_absent;
+  }
+  /// \brief Checks whether the key is present.
+  bool contains(const txn &txn, const KEY &key) const {
+    typename key_codec::storage k;
+    return txn.get(map_, key_codec::encode(key, k), slice::invalid()).is_valid();
+  }
+  /// \brief Returns the number of items.
+  size_t size(const txn &txn) const { return size_t(txn.get_map_stat(map_).ms_entries); }
+
+  void insert(txn &txn, const KEY &key, const VALUE &value) {
+    typename key_codec::storage k;
+    typename value_codec::storage v;
+    txn.insert(map_, key_codec::encode(key, k), value_codec::encode(value, v));
+  }
+  /// \brief Inserts the pair and returns `true`, or returns `false` if the
+  /// key (or the pair for multi-value table) is already present.
+  bool try_insert(txn &txn, const KEY &key, const VALUE &value) {
+    typename key_codec::storage k;
+    typename value_codec::storage v;
+    return txn.try_insert(map_, key_codec::encode(key, k), value_codec::encode(value, v)).done;
+  }
+  void upsert(txn &txn, const KEY &key, const VALUE &value) {
+    typename key_codec::storage k;
+    typename value_codec::storage v;
+    txn.upsert(map_, key_codec::encode(key, k), value_codec::encode(value, v));
+  }
+  void update(txn &txn, const KEY &key, const VALUE &value) {
+    typename key_codec::storage k;
+    typename value_codec::storage v;
+    txn.update(map_, key_codec::encode(key, k), value_codec::encode(value, v));
+  }
+  bool try_update(txn &txn, const KEY &key, const VALUE &value) {
+    typename key_codec::storage k;
+    typename value_codec::storage v;
+    return txn.try_update(map_, key_codec::encode(key, k), value_codec::encode(value, v));
+  }
+  /// \brief Removes the key with all its values.
+  bool erase(txn &txn, const KEY &key) {
+    typename key_codec::storage k;
+    return txn.erase(map_, key_codec::encode(key, k));
+  }
+  /// \brief Removes the pair.
+  bool erase(txn &txn, const KEY &key, const VALUE &value) {
+    typename key_codec::storage k;
+    typename value_codec::storage v;
+    return txn.erase(map_, key_codec::encode(key, k), value_codec::encode(value, v));
+  }
+  /// \brief Removes all items.
+  void clear(txn &txn) { txn.clear_map(map_); }
+
+  /// \brief Returns a view of all decoded pairs in key order, see
+  /// \ref txn::scan().
+  inline range scan(const txn &txn, bool backward = false) const;
+  /// \brief Returns a view of decoded pairs with keys in the `[from, to)`
+  /// interval, see \ref txn::scan().
+  inline range scan(const txn &txn, const KEY &from, const KEY &to, bool backward = false) const;
+  /// \brief Returns a view of decoded pairs with keys starting from the
+  /// `from` up to the end of the table.
+  inline range scan_from(const txn &txn, const KEY &from) const;
+
+private:
+  map_handle map_;
+};
+
+/// \brief Typed table with multiple sorted values for each key.
+/// \ingroup cxx_api
+template <typename KEY, typename VALUE, class CODECS = default_codecs>
+using multi_table = table<KEY, VALUE, CODECS, true>;
+
+template <typename KEY, typename VALUE, class CODECS, bool MULTIVALUE>
+class table<KEY, VALUE, CODECS, MULTIVALUE>::range
+#if defined(__cpp_lib_ranges) && __cpp_lib_ranges >= 201911L
+    : public ::std::ranges::view_base
+#endif /* __cpp_lib_ranges */
+{
+  friend class table;
+  /* the encoded bounds, which cursor_range may refer to */
+  typename key_codec::storage from_, to_;
+  cursor_range raw_;
+
+  /* re-points bounds of the cursor_range to own storage after a move */
+  void rebind(const range &other) noexcept {
+    if (raw_.from_.data() == static_cast<const void *>(&other.from_))
+      raw_.from_.iov_base = &from_;
+    if (raw_.to_.data() == static_cast<const void *>(&other.to_))
+      raw_.to_.iov_base = &to_;
+  }
+
+public:
+  /// \brief Input iterator over the decoded pairs.
+  class iterator {
+    friend class range;
+    cursor_range::iterator raw_;
+    explicit iterator(const cursor_range::iterator &raw) noexcept : raw_(raw) {}
+
+  public:
+    using iterator_category = ::std::input_iterator_tag;
+    using value_type = typename table::value_type;
+    using difference_type = ::std::ptrdiff_t;
+    using pointer = void;
+    using reference = value_type;
+
+    iterator() noexcept = default;
+    reference operator*() const {
+      const pair item = *raw_;
+      return value_type(key_codec::decode(item.key), value_codec::decode(item.value));
+    }
+    iterator &operator++() {
+      ++raw_;
+      return *this;
+    }
+    iterator operator++(int) {
+      iterator prev(*this);
+      ++raw_;
+      return prev;
+    }
+    friend bool operator==(const iterator &a, const iterator &b) noexcept { return a.raw_ == b.raw_; }
+    friend bool operator!=(const iterator &a, const iterator &b) noexcept { return a.raw_ != b.raw_; }
+  };
+
+  range() noexcept = default;
+  range(range &&other) noexcept : from_(other.from_), to_(other.to_), raw_(::std::move(other.raw_)) { rebind(other); }
+  range &operator=(range &&other) noexcept {
+    from_ = other.from_;
+    to_ = other.to_;
+    raw_ = ::std::move(other.raw_);
+    rebind(other);
+    return *this;
+  }
+  range(const range &) = delete;
+  range &operator=(const range &) = delete;
+
+  iterator begin() { return iterator(raw_.begin()); }
+  iterator end() noexcept { return iterator(); }
+  /// \brief Checks whether no pairs left.
+  bool empty() { return raw_.empty(); }
+};
+
+//------------------------------------------------------------------------------
+
+/// \brief Queue of write closures executed by a dedicated writer thread.
+/// \ingroup cxx_api
+///
+/// Write transactions are serialized by the writer lock, which blocks the
+/// thread that acquires it. The queue moves this wait out of the request
+/// processing threads: the closures are executed by the own writer thread of
+/// the queue, and the submitters are notified after the commit through a
+/// `std::future<>` or by resuming the awaiting C++20 coroutine.
+///
+/// The queue is executor-agnostic, i.e. coroutines are resumed on the writer
+/// thread after the commit and the durable sync (if requested). So a
+/// coroutine should hop back to its executor, if it is going to do more than
+/// a little work.
+///
+/// When the \ref options::max_batch is greater than one, several pending
+/// closures are executed within the same transaction and committed together
+/// (i.e. group commit). In such case a closure that throws an exception does
+/// not affect others, but the other closures of the batch are executed
+/// again within a new transaction, so the closures should have no side
+/// effects except the changes of the database.
+///
+/// \code
+///  mdbx::write_queue queue(env, mdbx::write_queue::options(64, true));
+///  ...
+///  auto count = co_await queue.async_write([&](mdbx::txn &txn) {
+///    txn.upsert(map, key, value);
+///    return txn.get_map_stat(map).ms_entries;
+///  });
+/// \endcode
+class LIBMDBX_API_TYPE write_queue {
+public:
+  /// \brief Options of the \ref write_queue.
+  struct options {
+    /// \brief The maximum number of closures committed by one transaction.
+    size_t max_batch{1};
+    /// \brief Whether to flush the data to disk after each commit
+    /// regardless of the \ref env::durability mode.
+    bool durable{false};
+    MDBX_CXX11_CONSTEXPR options() noexcept {}
+    MDBX_CXX11_CONSTEXPR options(size_t max_batch, bool durable = false) noexcept
+        : max_batch(max_batch), durable(durable) {}
+  };
+
+  /// \brief Base of the write closure, which could be used to submit work
+  /// without the `std::future<>` or coroutines.
+  class LIBMDBX_API_TYPE job {
+    friend class write_queue;
+    job *next_{nullptr};
+
+  protected:
+    /// \brief The exception thrown by the closure, by the commit or by the
+    /// queue itself, either null if succeeded.
+    ::std::exception_ptr failure_;
+    /// \brief Executes the closure within the write transaction.
+    /// \details May be called more than once in case of the group commit.
+    virtual void execute(txn &) = 0;
+    /// \brief Is called by the writer thread after the transaction is
+    /// committed or failed. The job object may be destroyed from here.
+    virtual void complete() noexcept = 0;
+
+  public:
+    job() noexcept = default;
+    job(const job &) = delete;
+    job &operator=(const job &) = delete;
+    virtual ~job() noexcept;
+  };
+
+private:
+  struct state;
+  state *state_;
+  void worker() noexcept;
+  void run(job *batch) noexcept;
+
+  template <typename RESULT> struct outcome {
+    ::std::unique_ptr<RESULT> value_;
+    template <typename FUNC> void execute(FUNC &func, txn &txn) { value_.reset(new RESULT(func(txn))); }
+    RESULT take() { return ::std::move(*value_); }
+    void fulfill(::std::promise<RESULT> &promise) { promise.set_value(take()); }
+  };
+
+  template <typename FUNC>
+  using result_of = typename ::std::decay<decltype(::std::declval<typename ::std::decay<FUNC>::type &>()(
+      ::std::declval<txn &>()))>::type;
+
+  template <typename FUNC> class future_job : public job {
+    FUNC func_;
+    outcome<result_of<FUNC>> outcome_;
+    ::std::promise<result_of<FUNC>> promise_;
+    void execute(txn &txn) override { outcome_.execute(func_, txn); }
+    void complete() noexcept override {
+      if (failure_)
+        promise_.set_exception(failure_);
+      else
+        outcome_.fulfill(promise_);
+      delete this;
+    }
+
+  public:
+    template <typename ARG> explicit future_job(ARG &&func) : func_(::std::forward<ARG>(func)) {}
+    ::std::future<result_of<FUNC>> get_future() { return promise_.get_future(); }
+  };
+
+public:
+  /// \brief Starts the writer thread of the queue.
+  write_queue(const ::mdbx::env &env, const options &params = options());
+  write_queue(const write_queue &) = delete;
+  write_queue &operator=(const write_queue &) = delete;
+  /// \brief Stops the queue, see \ref stop().
+  ~write_queue() noexcept;
+
+  /// \brief Stops accepting new closures, waits for the pending ones to be
+  /// committed and then stops the writer thread.
+  void stop() noexcept;
+
+  /// \brief Submits the job, which will be completed by the writer thread,
+  /// or immediately if the queue is stopped.
+  void submit(job *job) noexcept;
+
+  /// \brief Submits the closure and returns a future to get its result
+  /// after the commit.
+  template <typename FUNC> ::std::future<result_of<FUNC>> write(FUNC &&func) {
+    using closure = typename ::std::decay<FUNC>::type;
+    future_job<closure> *const job = new future_job<closure>(::std::forward<FUNC>(func));
+    auto future = job->get_future();
+    submit(job);
+    return future;
+  }
+
+#if defined(DOXYGEN) || (defined(__cpp_lib_coroutine) && __cpp_lib_coroutine >= 201902L)
+  /// \brief Awaitable of the closure submitted by \ref async_write().
+  template <typename FUNC> class awaitable : public job {
+    friend class write_queue;
+    write_queue &queue_;
+    FUNC func_;
+    outcome<result_of<FUNC>> outcome_;
+    ::std::coroutine_handle<> awaiting_;
+    template <typename ARG> awaitable(write_queue &queue, ARG &&func) : queue_(queue), func_(::std::forward<ARG>(func)) {}
+    void execute(txn &txn) override { outcome_.execute(func_, txn); }
+    void complete() noexcept override { awaiting_.resume(); }
+
+  public:
+    bool await_ready() const noexcept { return false; }
+    void await_suspend(::std::coroutine_handle<> awaiting) noexcept {
+      awaiting_ = awaiting;
+      queue_.submit(this);
+    }
+    result_of<FUNC> await_resume() {
+      if (failure_)
+        ::std::rethrow_exception(failure_);
+      return outcome_.take();
+    }
+  };
+
+  /// \brief Submits the closure and suspends the awaiting coroutine until
+  /// the commit, then returns the result of the closure or rethrows an
+  /// exception.
+  template <typename FUNC> awaitable<typename ::std::decay<FUNC>::type> async_write(FUNC &&func) {
+    return awaitable<typename ::std::decay<FUNC>::type>(*this, ::std::forward<FUNC>(func));
+  }
+#endif /* __cpp_lib_coroutine */
+};
+
+template <> struct write_queue::outcome<void> {
+  template <typename FUNC> void execute(FUNC &func, txn &txn) { func(txn); }
+  void take() noexcept {}
+  void fulfill(::std::promise<void> &promise) { promise.set_value(); }
+};
+
 //------------------------------------------------------------------------------
 
 LIBMDBX_API ::std::ostream &operator<<(::std::ostream &, const slice &);
@@ -5703,6 +6549,12 @@ inline txn::map_stat txn::get_map_stat(map_handle map) const {
   return r;
 }
 
+inline txn::map_opstat txn::get_map_opstat(map_handle map, bool reset) const {
+  txn::map_opstat r;
+  error::success_or_throw(::mdbx_dbi_opstat(handle_, map.dbi, &r, sizeof(r), reset));
+  return r;
+}
+
 inline uint32_t txn::get_tree_deepmask(map_handle map) const {
   uint32_t r;
   error::success_or_throw(::mdbx_dbi_dupsort_depthmask(handle_, map.dbi, &r));
@@ -6318,6 +7170,145 @@ inline size_t cursor::put_multiple_samelength(const slice &key, const size_t val
   return args[1].iov_len /* done item count */;
 }
 
+inline cursor_range cursor::range(const slice &from, const slice &to, bool backward) {
+  return cursor_range(handle_, from, to, backward);
+}
+
+inline cursor_range cursor::range(bool backward) { return range(slice::invalid(), slice::invalid(), backward); }
+
+inline cursor_range txn::scan(map_handle map, const slice &from, const slice &to, bool backward) const {
+  cursor_range view(open_cursor(map).withdraw_handle(), from, to, backward);
+  view.owned_ = view.handle_;
+  return view;
+}
+
+inline cursor_range::cursor_range(cursor_range &&other) noexcept
+    : handle_(other.handle_), owned_(other.owned_), from_(other.from_), to_(other.to_), backward_(other.backward_),
+      batched_(other.batched_), started_(other.started_), finished_(other.finished_), head_(other.head_),
+      tail_(other.tail_) {
+  ::std::copy(other.block_ + head_, other.block_ + tail_, block_ + head_);
+  other.handle_ = other.owned_ = nullptr;
+  other.finished_ = true;
+  other.head_ = other.tail_ = 0;
+}
+
+inline cursor_range &cursor_range::operator=(cursor_range &&other) noexcept {
+  if (MDBX_LIKELY(this != &other)) {
+    ::mdbx_cursor_close(owned_);
+    handle_ = other.handle_;
+    owned_ = other.owned_;
+    from_ = other.from_;
+    to_ = other.to_;
+    backward_ = other.backward_;
+    batched_ = other.batched_;
+    started_ = other.started_;
+    finished_ = other.finished_;
+    head_ = other.head_;
+    tail_ = other.tail_;
+    ::std::copy(other.block_ + head_, other.block_ + tail_, block_ + head_);
+    other.handle_ = other.owned_ = nullptr;
+    other.finished_ = true;
+    other.head_ = other.tail_ = 0;
+  }
+  return *this;
+}
+
+inline bool cursor_range::out_of_range(const MDBX_val &key) const {
+  const MDBX_txn *const txn = ::mdbx_cursor_txn(handle_);
+  const MDBX_dbi dbi = ::mdbx_cursor_dbi(handle_);
+  return backward_ ? ::mdbx_cmp(txn, dbi, &key, &from_) < 0 : ::mdbx_cmp(txn, dbi, &key, &to_) >= 0;
+}
+
+inline bool cursor_range::fetch() {
+  if (MDBX_LIKELY(head_ < tail_))
+    return true;
+  head_ = tail_ = 0;
+  if (finished_)
+    return false;
+
+  size_t count = 0;
+  int err = MDBX_SUCCESS;
+  if (MDBX_UNLIKELY(!started_)) {
+    started_ = true;
+    unsigned flags, state;
+    error::success_or_throw(::mdbx_dbi_flags_ex(::mdbx_cursor_txn(handle_), ::mdbx_cursor_dbi(handle_), &flags, &state));
+    /* the mdbx_cursor_get_batch() supports only forward direction for non-dupsort maps */
+    batched_ = !backward_ && (flags & MDBX_DUPSORT) == 0;
+    const slice &start = backward_ ? to_ : from_;
+    block_[0] = start;
+    err = ::mdbx_cursor_get(handle_, &block_[0], &block_[1],
+                            backward_ ? (start.is_valid() ? MDBX_TO_KEY_LESSER_THAN : MDBX_LAST)
+                                      : (start.is_valid() ? MDBX_SET_RANGE : MDBX_FIRST));
+    /* the batch is fetched starting from the current cursor position */
+    if (err == MDBX_SUCCESS && !batched_)
+      count = 2;
+  }
+
+  if (MDBX_LIKELY(err == MDBX_SUCCESS)) {
+    if (batched_)
+      err = ::mdbx_cursor_get_batch(handle_, &count, block_, block_size, MDBX_NEXT);
+    else {
+      const MDBX_cursor_op step = backward_ ? MDBX_PREV : MDBX_NEXT;
+      while (count < block_size &&
+             (err = ::mdbx_cursor_get(handle_, &block_[count], &block_[count + 1], step)) == MDBX_SUCCESS)
+        count += 2;
+    }
+  }
+
+  switch (err) {
+  case MDBX_SUCCESS:
+    MDBX_CXX20_LIKELY break;
+  case MDBX_RESULT_TRUE /* the last batch */:
+  case MDBX_NOTFOUND:
+  case MDBX_ENODATA:
+    finished_ = true;
+    break;
+  default:
+    MDBX_CXX20_UNLIKELY error::throw_exception(err);
+  }
+
+  if (count && (backward_ ? from_ : to_).is_valid() && out_of_range(block_[count - 2])) {
+    /* keys are ordered, so search for the first one beyond the range */
+    size_t lo = 0, hi = count / 2 - 1;
+    while (lo < hi) {
+      const size_t middle = (lo + hi) / 2;
+      if (out_of_range(block_[middle * 2]))
+        hi = middle;
+      else
+        lo = middle + 1;
+    }
+    count = lo * 2;
+    finished_ = true;
+  }
+
+  tail_ = count;
+  return head_ < tail_;
+}
+
+template <typename KEY, typename VALUE, class CODECS, bool MULTIVALUE>
+inline typename table<KEY, VALUE, CODECS, MULTIVALUE>::range
+table<KEY, VALUE, CODECS, MULTIVALUE>::scan(const txn &txn, bool backward) const {
+  range view;
+  view.raw_ = txn.scan(map_, slice::invalid(), slice::invalid(), backward);
+  return view;
+}
+
+template <typename KEY, typename VALUE, class CODECS, bool MULTIVALUE>
+inline typename table<KEY, VALUE, CODECS, MULTIVALUE>::range
+table<KEY, VALUE, CODECS, MULTIVALUE>::scan(const txn &txn, const KEY &from, const KEY &to, bool backward) const {
+  range view;
+  view.raw_ = txn.scan(map_, key_codec::encode(from, view.from_), key_codec::encode(to, view.to_), backward);
+  return view;
+}
+
+template <typename KEY, typename VALUE, class CODECS, bool MULTIVALUE>
+inline typename table<KEY, VALUE, CODECS, MULTIVALUE>::range
+table<KEY, VALUE, CODECS, MULTIVALUE>::scan_from(const txn &txn, const KEY &from) const {
+  range view;
+  view.raw_ = txn.scan(map_, key_codec::encode(from, view.from_), slice::invalid(), false);
+  return view;
+}
+
 /// end cxx_api @}
 } // namespace mdbx
 
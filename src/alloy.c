@@ -30,6 +30,7 @@
 #include "global.c"
 #include "lck-posix.c"
 #include "lck-windows.c"
+#include "latency.c"
 #include "lck.c"
 #include "logging_and_debug.c"
 #include "meta.c"
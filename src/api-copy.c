@@ -5,6 +5,27 @@
 
 #include "internals.h"
 
+/* Отложенное копирование именованной таблицы при MDBX_CP_PARALLEL.
+ * Под таблицу заранее резервируется диапазон страниц по её статистике,
+ * а так как при обходе корень выводится последним, то его номер известен
+ * сразу и может быть записан в узел MainDB до копирования самой таблицы. */
+typedef struct compacting_job {
+  tree_t tree;
+  pgno_t first, npages;
+} copy_job_t;
+
+typedef struct compacting_parallel {
+  osal_fastmutex_t mutex;
+  copy_job_t *jobs;
+  size_t count, allocated, next;
+  volatile int error;
+} copy_parallel_t;
+
+/* номера страниц назначения у заданий не пересекаются, что позволяет
+ * строго упорядочить задания одинакового размера */
+#define COPY_JOB_CMP(a, b) ((a).npages > (b).npages || ((a).npages == (b).npages && (a).first < (b).first))
+SORT_IMPL(copy_job_sort, false, copy_job_t, COPY_JOB_CMP)
+
 typedef struct compacting_context {
   MDBX_env *env;
   MDBX_txn *txn;
@@ -19,6 +40,12 @@ typedef struct compacting_context {
    * to fail the copy.  Not mutex-protected, expects atomic int. */
   volatile int error;
   mdbx_filehandle_t fd;
+  /* Positional mode: single buffer, written by osal_pwrite() at write_offset
+   * without the writer thread. */
+  bool positional;
+  uint64_t write_offset;
+  /* Named tables are deferred to the parallel walkers, if non-null. */
+  copy_parallel_t *defer;
 } ctx_t;
 
 __cold static int compacting_walk_tree(ctx_t *ctx, tree_t *tree);
@@ -76,6 +103,18 @@ bailout:
 
 /* Give buffer and/or MDBX_EOF to writer thread, await unused buffer. */
 __cold static int compacting_toggle_write_buffers(ctx_t *ctx) {
+  if (ctx->positional) {
+    const size_t bytes = ctx->write_len[0];
+    ctx->write_len[0] = 0;
+    if (bytes && !ctx->error) {
+      int err = osal_pwrite(ctx->fd, ctx->write_buf[0], bytes, ctx->write_offset);
+      if (unlikely(err != MDBX_SUCCESS))
+        ctx->error = err;
+    }
+    ctx->write_offset += bytes;
+    return ctx->error;
+  }
+
   osal_condpair_lock(&ctx->condpair);
   eASSERT(ctx->env, ctx->head - ctx->tail < 2 || ctx->error);
   ctx->head += 1;
@@ -141,6 +180,13 @@ static int compacting_put_page(ctx_t *ctx, const page_t *mp, const size_t head_b
 
   const pgno_t pgno = ctx->first_unallocated;
   ctx->first_unallocated += npages;
+  if (ctx->positional && ctx->write_offset + ctx->write_len[0] != pgno2bytes(ctx->env, pgno)) {
+    /* pages are not contiguous, i.e. a range of another table was skipped */
+    int err = compacting_toggle_write_buffers(ctx);
+    if (unlikely(err != MDBX_SUCCESS))
+      return err;
+    ctx->write_offset = pgno2bytes(ctx->env, pgno);
+  }
   int err = compacting_put_bytes(ctx, mp, head_bytes, pgno, npages);
   if (unlikely(err != MDBX_SUCCESS))
     return err;
@@ -150,6 +196,35 @@ static int compacting_put_page(ctx_t *ctx, const page_t *mp, const size_t head_b
   return compacting_put_bytes(ctx, ptr_disp(mp, ctx->env->ps - tail_bytes), tail_bytes, 0, 0);
 }
 
+__cold static int compacting_defer_tree(ctx_t *ctx, tree_t *tree) {
+  if (unlikely(tree->root == P_INVALID))
+    return MDBX_SUCCESS; /* empty db */
+
+  const pgno_t npages = tree->branch_pages + tree->leaf_pages + tree->large_pages;
+  if (unlikely(npages < 1 || npages > MAX_PAGENO - ctx->first_unallocated))
+    return MDBX_RESULT_TRUE /* inconsistent statistics, fallback to serial copy */;
+
+  copy_parallel_t *const shared = ctx->defer;
+  if (shared->count == shared->allocated) {
+    const size_t wanna = shared->allocated ? shared->allocated * 2 : 64;
+    copy_job_t *const jobs = osal_realloc(shared->jobs, wanna * sizeof(copy_job_t));
+    if (unlikely(!jobs))
+      return MDBX_ENOMEM;
+    shared->jobs = jobs;
+    shared->allocated = wanna;
+  }
+
+  if (!tree->mod_txnid)
+    tree->mod_txnid = ctx->txn->txnid;
+  copy_job_t *const job = &shared->jobs[shared->count++];
+  job->tree = *tree;
+  job->first = ctx->first_unallocated;
+  job->npages = npages;
+  ctx->first_unallocated += npages;
+  tree->root = ctx->first_unallocated - 1;
+  return MDBX_SUCCESS;
+}
+
 __cold static int compacting_walk(ctx_t *ctx, MDBX_cursor *mc, pgno_t *const parent_pgno, txnid_t parent_txnid) {
   mc->top = 0;
   mc->ki[0] = 0;
@@ -169,6 +244,8 @@ __cold static int compacting_walk(ctx_t *ctx, MDBX_cursor *mc, pgno_t *const par
 
   void *ptr = buf;
   for (intptr_t i = 0; i <= mc->top; i++) {
+    if (i < mc->top || !(mc->flags & z_inner))
+      walk_prefetch(ctx->txn, mc->pg[i]);
     page_copy(ptr, mc->pg[i], ctx->env->ps);
     mc->pg[i] = ptr;
     ptr = ptr_disp(ptr, ctx->env->ps);
@@ -229,7 +306,7 @@ __cold static int compacting_walk(ctx_t *ctx, MDBX_cursor *mc, pgno_t *const par
               cursor_couple_t *couple = container_of(mc, cursor_couple_t, outer);
               nested = &couple->inner.nested_tree;
               memcpy(nested, node_data(node), sizeof(tree_t));
-              rc = compacting_walk_tree(ctx, nested);
+              rc = ctx->defer ? compacting_defer_tree(ctx, nested) : compacting_walk_tree(ctx, nested);
             }
             if (unlikely(rc != MDBX_SUCCESS))
               goto bailout;
@@ -245,6 +322,8 @@ __cold static int compacting_walk(ctx_t *ctx, MDBX_cursor *mc, pgno_t *const par
           rc = page_get(mc, node_pgno(node), &mp, mp->txnid);
           if (unlikely(rc != MDBX_SUCCESS))
             goto bailout;
+          if (!is_leaf(mp) || !(mc->flags & z_inner))
+            walk_prefetch(ctx->txn, mp);
           mc->top += 1;
           if (unlikely(mc->top >= deep_limit)) {
             rc = MDBX_CURSOR_FULL;
@@ -307,6 +386,114 @@ __cold static int compacting_walk_tree(ctx_t *ctx, tree_t *tree) {
   return compacting_walk(ctx, &couple.outer, &tree->root, tree->mod_txnid);
 }
 
+typedef struct compacting_walker {
+  ctx_t ctx;
+  copy_parallel_t *shared;
+  osal_thread_t thread;
+  int err;
+} walker_t;
+
+__cold static int compacting_walker_loop(walker_t *walker) {
+  ctx_t *const ctx = &walker->ctx;
+  copy_parallel_t *const shared = walker->shared;
+  for (;;) {
+    copy_job_t *job = nullptr;
+    int err = osal_fastmutex_acquire(&shared->mutex);
+    if (unlikely(err != MDBX_SUCCESS))
+      return err;
+    if (shared->next < shared->count && !shared->error)
+      job = &shared->jobs[shared->next++];
+    osal_fastmutex_release(&shared->mutex);
+    if (!job)
+      return MDBX_SUCCESS;
+
+    ctx->first_unallocated = job->first;
+    err = compacting_walk_tree(ctx, &job->tree);
+    if (likely(err == MDBX_SUCCESS) && ctx->write_len[0])
+      err = compacting_toggle_write_buffers(ctx);
+    if (likely(err == MDBX_SUCCESS) &&
+        unlikely(ctx->first_unallocated != job->first + job->npages || job->tree.root != ctx->first_unallocated - 1))
+      err = MDBX_RESULT_TRUE /* inconsistent statistics, fallback to serial copy */;
+    if (unlikely(err != MDBX_SUCCESS)) {
+      if (!shared->error)
+        shared->error = err;
+      return err;
+    }
+  }
+}
+
+__cold static THREAD_RESULT THREAD_CALL compacting_walker_thread(void *arg) {
+  walker_t *const walker = arg;
+  walker->err = compacting_walker_loop(walker);
+  return (THREAD_RESULT)0;
+}
+
+/* Parallel compacting copy: MainDB is walked by the calling thread while named
+ * tables are deferred with preassigned pages ranges, then such tables are
+ * walked by several threads each of which writes its own pages by
+ * osal_pwrite(). Returns MDBX_RESULT_TRUE if a serial copy should be done
+ * instead, since the tables statistics doesn't match its content. */
+__cold static int compacting_parallel(ctx_t *ctx, meta_t *meta) {
+  copy_parallel_t shared;
+  memset(&shared, 0, sizeof(shared));
+  int rc = osal_fastmutex_init(&shared.mutex);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return rc;
+
+  ctx->positional = true;
+  ctx->write_offset = pgno2bytes(ctx->env, ctx->first_unallocated);
+  ctx->defer = &shared;
+  rc = compacting_walk_tree(ctx, &meta->trees.main);
+  if (likely(rc == MDBX_SUCCESS) && ctx->write_len[0])
+    rc = compacting_toggle_write_buffers(ctx);
+  ctx->defer = nullptr;
+
+  const size_t n = (shared.count < MDBX_ENVCOPY_THREADS) ? shared.count : MDBX_ENVCOPY_THREADS;
+  walker_t *const walkers = (rc == MDBX_SUCCESS && n) ? osal_calloc(n, sizeof(walker_t)) : nullptr;
+  if (likely(rc == MDBX_SUCCESS) && n && unlikely(!walkers))
+    rc = MDBX_ENOMEM;
+  if (walkers) {
+    /* the biggest tables first for better balance */
+    copy_job_sort(shared.jobs, shared.jobs + shared.count);
+
+    size_t started = 1;
+    walkers[0].ctx = *ctx;
+    walkers[0].shared = &shared;
+    for (; started < n; ++started) {
+      walker_t *const walker = &walkers[started];
+      walker->shared = &shared;
+      walker->ctx.env = ctx->env;
+      walker->ctx.txn = ctx->txn;
+      walker->ctx.flags = ctx->flags;
+      walker->ctx.fd = ctx->fd;
+      walker->ctx.positional = true;
+      if (osal_memalign_alloc(globals.sys_pagesize, MDBX_ENVCOPY_WRITEBUF, (void **)&walker->ctx.write_buf[0]) !=
+          MDBX_SUCCESS)
+        break;
+      if (osal_thread_create(&walker->thread, compacting_walker_thread, walker) != MDBX_SUCCESS) {
+        osal_memalign_free(walker->ctx.write_buf[0]);
+        break;
+      }
+    }
+
+    /* the calling thread is a walker too */
+    rc = compacting_walker_loop(&walkers[0]);
+    for (size_t i = 1; i < started; ++i) {
+      int err = osal_thread_join(walkers[i].thread);
+      if (err == MDBX_SUCCESS)
+        err = walkers[i].err;
+      if (rc == MDBX_SUCCESS || rc == MDBX_RESULT_TRUE)
+        rc = err ? err : rc;
+      osal_memalign_free(walkers[i].ctx.write_buf[0]);
+    }
+    osal_free(walkers);
+  }
+
+  osal_free(shared.jobs);
+  osal_fastmutex_destroy(&shared.mutex);
+  return rc;
+}
+
 __cold static void compacting_fixup_meta(MDBX_env *env, meta_t *meta) {
   eASSERT(env, meta->trees.gc.mod_txnid || meta->trees.gc.root == P_INVALID);
   eASSERT(env, meta->trees.main.mod_txnid || meta->trees.main.root == P_INVALID);
@@ -418,9 +605,26 @@ __cold static int copy_with_compacting(MDBX_env *env, MDBX_txn *txn, mdbx_fileha
     ctx.txn = txn;
     ctx.flags = flags;
 
+    /* a write txn is not eligible since the dirty-list lookups aren't thread-safe */
+    if ((flags & MDBX_CP_PARALLEL) && !dest_is_pipe && (flags & MDBX_CP_THROTTLE_MVCC) == 0 &&
+        (txn->flags & MDBX_TXN_RDONLY) != 0 && MDBX_ENVCOPY_THREADS > 1) {
+      rc = compacting_parallel(&ctx, meta);
+      if (rc == MDBX_RESULT_TRUE) {
+        NOTICE("%s, fallback to serial compacting copy", "the source DB has inconsistent tables statistics");
+        meta->trees.main = txn->dbs[MAIN_DBI];
+        ctx.first_unallocated = NUM_METAS;
+        ctx.positional = false;
+        ctx.write_len[0] = 0;
+        ctx.error = MDBX_SUCCESS;
+        rc = osal_ftruncate(fd, pgno2bytes(env, NUM_METAS));
+        if (likely(rc == MDBX_SUCCESS))
+          rc = osal_fseek(fd, pgno2bytes(env, NUM_METAS));
+      }
+    }
+
     osal_thread_t thread;
-    int thread_err = osal_thread_create(&thread, compacting_write_thread, &ctx);
-    if (likely(thread_err == MDBX_SUCCESS)) {
+    int thread_err = ctx.positional ? MDBX_SUCCESS : osal_thread_create(&thread, compacting_write_thread, &ctx);
+    if (!ctx.positional && likely(thread_err == MDBX_SUCCESS)) {
       if (dest_is_pipe) {
         if (!meta->trees.main.mod_txnid)
           meta->trees.main.mod_txnid = txn->txnid;
@@ -437,30 +641,30 @@ __cold static int copy_with_compacting(MDBX_env *env, MDBX_txn *txn, mdbx_fileha
         /* toggle to flush non-empty buffers */
         compacting_toggle_write_buffers(&ctx);
 
-      if (likely(rc == MDBX_SUCCESS) && unlikely(meta->geometry.first_unallocated != ctx.first_unallocated)) {
-        if (ctx.first_unallocated > meta->geometry.first_unallocated) {
-          ERROR("the source DB %s: post-compactification used pages %" PRIaPGNO " %c expected %" PRIaPGNO,
-                "has double-used pages or other corruption", ctx.first_unallocated, '>',
-                meta->geometry.first_unallocated);
-          rc = MDBX_CORRUPTED; /* corrupted DB */
-        }
-        if (ctx.first_unallocated < meta->geometry.first_unallocated) {
-          WARNING("the source DB %s: post-compactification used pages %" PRIaPGNO " %c expected %" PRIaPGNO,
-                  "has page leak(s)", ctx.first_unallocated, '<', meta->geometry.first_unallocated);
-          if (dest_is_pipe)
-            /* the root within already written meta-pages is wrong */
-            rc = MDBX_CORRUPTED;
-        }
-        /* fixup meta */
-        meta->geometry.first_unallocated = ctx.first_unallocated;
-      }
-
       /* toggle with empty buffers to exit thread's loop */
       eASSERT(env, (ctx.write_len[ctx.head & 1]) == 0);
       compacting_toggle_write_buffers(&ctx);
       thread_err = osal_thread_join(thread);
       eASSERT(env, (ctx.tail == ctx.head && ctx.write_len[ctx.head & 1] == 0) || ctx.error);
-      osal_condpair_destroy(&ctx.condpair);
+    }
+    osal_condpair_destroy(&ctx.condpair);
+
+    if (likely(rc == MDBX_SUCCESS) && unlikely(meta->geometry.first_unallocated != ctx.first_unallocated)) {
+      if (ctx.first_unallocated > meta->geometry.first_unallocated) {
+        ERROR("the source DB %s: post-compactification used pages %" PRIaPGNO " %c expected %" PRIaPGNO,
+              "has double-used pages or other corruption", ctx.first_unallocated, '>',
+              meta->geometry.first_unallocated);
+        rc = MDBX_CORRUPTED; /* corrupted DB */
+      }
+      if (ctx.first_unallocated < meta->geometry.first_unallocated) {
+        WARNING("the source DB %s: post-compactification used pages %" PRIaPGNO " %c expected %" PRIaPGNO,
+                "has page leak(s)", ctx.first_unallocated, '<', meta->geometry.first_unallocated);
+        if (dest_is_pipe)
+          /* the root within already written meta-pages is wrong */
+          rc = MDBX_CORRUPTED;
+      }
+      /* fixup meta */
+      meta->geometry.first_unallocated = ctx.first_unallocated;
     }
     if (unlikely(thread_err != MDBX_SUCCESS))
       return thread_err;
@@ -911,3 +1115,509 @@ __cold int mdbx_env_copyW(MDBX_env *env, const wchar_t *dest_path, MDBX_copy_fla
   mdbx_txn_abort(txn);
   return LOG_IFERR(rc);
 }
+
+//----------------------------------------------------------------------------
+
+/* Incremental (delta) copy, i.e. a stream of pages changed since a given txnid.
+ *
+ * Since pages are copied-on-write, any page has a txnid not less than ones of
+ * its children. So the walk skips a whole subtree if the txnid of its root is
+ * not newer than the given one, and the emitted pages together with pages
+ * unchanged since then form the snapshot. The stream is the delta_header_t
+ * followed by the chunks of pages, and is terminated by a chunk with zero pgno
+ * which contains the meta-pages. */
+
+#define DELTA_MAGIC UINT64_C(0x4D444258446C7461) /* "MDBXDlta" */
+
+typedef struct delta_header {
+  uint64_t magic;
+  uint32_t pagesize, reserved;
+  uint64_t since_txnid, txnid;
+  bin128_t dxbid;
+} delta_header_t;
+
+typedef struct delta_chunk {
+  pgno_t pgno, npages;
+} delta_chunk_t;
+
+typedef struct delta_context {
+  MDBX_env *env;
+  txnid_t since, txnid;
+  mdbx_filehandle_t fd;
+  MDBX_pageship_func *sink; /* if set, then used instead of the fd */
+  uint8_t *buffer;
+  size_t length;
+} delta_ctx_t;
+
+static int delta_flush(delta_ctx_t *ctx) {
+  int err = MDBX_SUCCESS;
+  if (ctx->length) {
+    err = ctx->sink ? ctx->sink(ctx->env, ctx->txnid, ctx->buffer, ctx->length)
+                    : osal_write(ctx->fd, ctx->buffer, ctx->length);
+    ctx->length = 0;
+  }
+  return err;
+}
+
+static int delta_put(delta_ctx_t *ctx, const void *src, size_t bytes) {
+  while (bytes) {
+    if (ctx->length == (size_t)MDBX_ENVCOPY_WRITEBUF) {
+      int err = delta_flush(ctx);
+      if (unlikely(err != MDBX_SUCCESS))
+        return err;
+    }
+    const size_t left = (size_t)MDBX_ENVCOPY_WRITEBUF - ctx->length;
+    const size_t chunk = (bytes < left) ? bytes : left;
+    /* copy to avoid EFAULT in case swapped-out */
+    memcpy(ctx->buffer + ctx->length, src, chunk);
+    ctx->length += chunk;
+    src = ptr_disp(src, chunk);
+    bytes -= chunk;
+  }
+  return MDBX_SUCCESS;
+}
+
+static int delta_put_chunk(delta_ctx_t *ctx, pgno_t pgno, pgno_t npages, const void *src) {
+  const delta_chunk_t chunk = {.pgno = pgno, .npages = npages};
+  int err = delta_put(ctx, &chunk, sizeof(chunk));
+  return likely(err == MDBX_SUCCESS) ? delta_put(ctx, src, pgno2bytes(ctx->env, npages)) : err;
+}
+
+__cold static int delta_walk_visitor(const size_t pgno, const unsigned npages, void *const user, const int deep,
+                                     const walk_tbl_t *table, const size_t page_size, const page_type_t page_type,
+                                     const MDBX_error_t err, const size_t nentries, const size_t payload_bytes,
+                                     const size_t header_bytes, const size_t unused_bytes, const size_t parent_pgno) {
+  (void)deep;
+  (void)table;
+  (void)page_size;
+  (void)nentries;
+  (void)payload_bytes;
+  (void)header_bytes;
+  (void)unused_bytes;
+  (void)parent_pgno;
+  if (unlikely(err != MDBX_SUCCESS))
+    return err;
+  if (npages == 0)
+    return MDBX_SUCCESS /* sub-page inside a leaf */;
+
+  delta_ctx_t *const ctx = user;
+  const page_t *const mp = pgno2page(ctx->env, pgno);
+  if (mp->txnid <= ctx->since)
+    /* the MDBX_RESULT_TRUE skips the children, but for a large page it would
+     * skip the rest of the leaf which holds the reference */
+    return (page_type == page_large) ? MDBX_SUCCESS : MDBX_RESULT_TRUE;
+  return delta_put_chunk(ctx, (pgno_t)pgno, npages, mp);
+}
+
+__cold static int delta_copy(MDBX_txn *txn, delta_ctx_t *ctx) {
+  if (unlikely(ctx->since > txn->txnid))
+    return MDBX_EINVAL;
+
+  MDBX_env *const env = txn->env;
+  ctx->txnid = txn->txnid;
+
+  delta_header_t header;
+  memset(&header, 0, sizeof(header));
+  header.magic = DELTA_MAGIC;
+  header.pagesize = env->ps;
+  header.since_txnid = ctx->since;
+  header.txnid = txn->txnid;
+  memcpy(&header.dxbid, &METAPAGE(env, 0)->dxbid, sizeof(header.dxbid));
+  int rc = delta_put(ctx, &header, sizeof(header));
+  if (likely(rc == MDBX_SUCCESS))
+    rc = walk_pages(txn, delta_walk_visitor, ctx, dont_check_keys_ordering);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return rc;
+
+  /* Meta-pages like for the compacting copy, but with the same GUID since
+   * the delta should be applicable to the result. */
+  void *const metas = osal_malloc(pgno2bytes(env, NUM_METAS));
+  if (unlikely(!metas))
+    return MDBX_ENOMEM;
+  meta_t *const meta = meta_init_triplet(env, metas);
+  memcpy(meta->magic_and_version, METAPAGE(env, 0)->magic_and_version, 8);
+  meta->geometry = txn->geo;
+  meta->trees.gc = txn->dbs[FREE_DBI];
+  meta->trees.main = txn->dbs[MAIN_DBI];
+  meta->canary = txn->canary;
+  meta_set_txnid(env, meta, txn->txnid);
+  for (size_t n = 0; n < NUM_METAS; ++n) {
+    meta_t *const model = page_meta(ptr_disp(metas, pgno2bytes(env, n)));
+    if (header.dxbid.x | header.dxbid.y)
+      memcpy(&model->dxbid, &header.dxbid, sizeof(model->dxbid));
+    meta_sign_as_steady(model);
+  }
+
+  rc = delta_put_chunk(ctx, 0, NUM_METAS, metas);
+  osal_free(metas);
+  return likely(rc == MDBX_SUCCESS) ? delta_flush(ctx) : rc;
+}
+
+static int delta_read_header(mdbx_filehandle_t delta_fd, delta_header_t *header) {
+  int rc = osal_read(delta_fd, header, sizeof(*header));
+  if (likely(rc == MDBX_SUCCESS) &&
+      unlikely(header->magic != DELTA_MAGIC || header->pagesize < MDBX_MIN_PAGESIZE ||
+               header->pagesize > MDBX_MAX_PAGESIZE || !is_powerof2(header->pagesize) ||
+               header->since_txnid > header->txnid)) {
+    ERROR("%s/%d: %s", "MDBX_INVALID", MDBX_INVALID, "invalid delta header");
+    rc = MDBX_INVALID;
+  }
+  return rc;
+}
+
+static bool delta_is_applicable(const delta_header_t *header, const meta_t *meta) {
+  return meta->pagesize == header->pagesize &&
+         ((header->dxbid.x | header->dxbid.y) == 0 || memcmp(&meta->dxbid, &header->dxbid, sizeof(header->dxbid)) == 0);
+}
+
+static size_t delta_buffer_size(const delta_header_t *header) {
+  const size_t meta_bytes = NUM_METAS * (size_t)header->pagesize;
+  return ((size_t)MDBX_ENVCOPY_WRITEBUF > meta_bytes) ? (size_t)MDBX_ENVCOPY_WRITEBUF
+                                                      : ceil_powerof2(meta_bytes, header->pagesize);
+}
+
+/* Reads the chunks of pages and writes them into the dxb_fd, then reads the
+ * meta-pages of the delta into the buffer. The env is given by a follower to
+ * flush pages written into a file through the mapping on incoherent systems. */
+static int delta_read_pages(const delta_header_t *header, mdbx_filehandle_t delta_fd, mdbx_filehandle_t dxb_fd,
+                            const MDBX_env *env, uint8_t *buffer, size_t buffer_size, size_t *npages) {
+  const size_t ps = header->pagesize, meta_bytes = NUM_METAS * ps;
+  int rc = MDBX_SUCCESS;
+  while (likely(rc == MDBX_SUCCESS)) {
+    delta_chunk_t chunk;
+    rc = osal_read(delta_fd, &chunk, sizeof(chunk));
+    if (unlikely(rc != MDBX_SUCCESS))
+      break;
+    if (chunk.pgno == 0) {
+      if (unlikely(chunk.npages != NUM_METAS)) {
+        rc = MDBX_INVALID;
+        break;
+      }
+      rc = osal_read(delta_fd, buffer, meta_bytes);
+      break;
+    }
+    if (unlikely(chunk.pgno < NUM_METAS || chunk.npages < 1 || chunk.npages > MAX_PAGENO + 1 - chunk.pgno)) {
+      rc = MDBX_INVALID;
+      break;
+    }
+
+    *npages += chunk.npages;
+    uint64_t offset = chunk.pgno * (uint64_t)ps;
+    for (uint64_t left = chunk.npages * (uint64_t)ps; rc == MDBX_SUCCESS && left;) {
+      const size_t bytes = (left < buffer_size) ? (size_t)left : buffer_size;
+      rc = osal_read(delta_fd, buffer, bytes);
+      if (likely(rc == MDBX_SUCCESS))
+        rc = osal_pwrite(dxb_fd, buffer, bytes, offset);
+      if (env && offset + bytes <= env->dxb_mmap.current)
+        osal_flush_incoherent_mmap(ptr_disp(env->dxb_mmap.base, offset), bytes, globals.sys_pagesize);
+      offset += bytes;
+      left -= bytes;
+    }
+  }
+  if (unlikely(rc != MDBX_SUCCESS)) {
+    if (rc == MDBX_INVALID)
+      ERROR("%s/%d: %s", "MDBX_INVALID", MDBX_INVALID, "invalid delta chunk");
+    return rc;
+  }
+
+  const meta_t *const head = page_meta(ptr_disp(buffer, (NUM_METAS - 1) * ps));
+  if (unlikely(constmeta_txnid(head) != header->txnid || head->pagesize != ps)) {
+    ERROR("%s/%d: %s", "MDBX_INVALID", MDBX_INVALID, "invalid delta meta-pages");
+    return MDBX_INVALID;
+  }
+  return MDBX_SUCCESS;
+}
+
+__cold int delta_apply(mdbx_filehandle_t dxb_fd, mdbx_filehandle_t delta_fd) {
+  delta_header_t header;
+  int rc = delta_read_header(delta_fd, &header);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return rc;
+
+  const size_t ps = header.pagesize, meta_bytes = NUM_METAS * ps;
+  const size_t buffer_size = delta_buffer_size(&header);
+  uint8_t *buffer = nullptr;
+  rc = osal_memalign_alloc(globals.sys_pagesize, buffer_size, (void **)&buffer);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return rc;
+
+  /* Check the target is a copy of the same DB not newer than the delta,
+   * but not older than the delta requires. */
+  rc = osal_pread(dxb_fd, buffer, meta_bytes, 0);
+  if (unlikely(rc != MDBX_SUCCESS))
+    goto bailout;
+  txnid_t base_txnid = 0;
+  for (size_t n = 0; n < NUM_METAS; ++n) {
+    const meta_t *const meta = page_meta(ptr_disp(buffer, n * ps));
+    if (!delta_is_applicable(&header, meta)) {
+      ERROR("%s/%d: %s", "MDBX_INCOMPATIBLE", MDBX_INCOMPATIBLE, "the delta is for another DB or page size");
+      rc = MDBX_INCOMPATIBLE;
+      goto bailout;
+    }
+    const txnid_t txnid = constmeta_txnid(meta);
+    if (SIGN_IS_STEADY(unaligned_peek_u64(4, meta->sign)) && txnid > base_txnid)
+      base_txnid = txnid;
+  }
+  if (unlikely(base_txnid < header.since_txnid || base_txnid > header.txnid)) {
+    ERROR("%s/%d: the delta is for txnid %" PRIaTXN " since %" PRIaTXN ", but the target is at %" PRIaTXN,
+          "MDBX_INCOMPATIBLE", MDBX_INCOMPATIBLE, header.txnid, header.since_txnid, base_txnid);
+    rc = MDBX_INCOMPATIBLE;
+    goto bailout;
+  }
+
+  /* Firstly write a stub to meta-pages.
+   * Now we sure to incomplete patching will not be used. */
+  memset(buffer, -1, meta_bytes);
+  rc = osal_pwrite(dxb_fd, buffer, meta_bytes, 0);
+  if (likely(rc == MDBX_SUCCESS))
+    rc = osal_fsync(dxb_fd, MDBX_SYNC_DATA);
+  size_t npages = 0;
+  if (likely(rc == MDBX_SUCCESS))
+    rc = delta_read_pages(&header, delta_fd, dxb_fd, nullptr, buffer, buffer_size, &npages);
+  if (unlikely(rc != MDBX_SUCCESS))
+    goto bailout;
+
+  const meta_t *const head = page_meta(ptr_disp(buffer, (NUM_METAS - 1) * ps));
+  uint64_t filesize = 0;
+  rc = osal_filesize(dxb_fd, &filesize);
+  if (likely(rc == MDBX_SUCCESS) && filesize < head->geometry.now * (uint64_t)ps)
+    rc = osal_fallocate(dxb_fd, head->geometry.now * (uint64_t)ps);
+  if (likely(rc == MDBX_SUCCESS))
+    rc = osal_fsync(dxb_fd, MDBX_SYNC_DATA | MDBX_SYNC_SIZE);
+
+  /* Write actual meta */
+  if (likely(rc == MDBX_SUCCESS))
+    rc = osal_pwrite(dxb_fd, buffer, meta_bytes, 0);
+  if (likely(rc == MDBX_SUCCESS))
+    rc = osal_fsync(dxb_fd, MDBX_SYNC_DATA | MDBX_SYNC_IODQ);
+
+bailout:
+  osal_memalign_free(buffer);
+  return rc;
+}
+
+__cold int mdbx_env_copy_delta(MDBX_env *env, uint64_t since_txnid, mdbx_filehandle_t fd) {
+  int rc = check_env(env, true);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return LOG_IFERR(rc);
+
+  uint8_t *buffer = nullptr;
+  rc = osal_memalign_alloc(globals.sys_pagesize, MDBX_ENVCOPY_WRITEBUF, (void **)&buffer);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return LOG_IFERR(rc);
+
+  MDBX_txn *txn = nullptr;
+  rc = mdbx_txn_begin(env, nullptr, MDBX_TXN_RDONLY, &txn);
+  if (likely(rc == MDBX_SUCCESS)) {
+    delta_ctx_t ctx = {.env = env, .since = since_txnid, .fd = fd, .buffer = buffer};
+    rc = delta_copy(txn, &ctx);
+    mdbx_txn_abort(txn);
+  }
+  osal_memalign_free(buffer);
+  return LOG_IFERR(rc);
+}
+
+//----------------------------------------------------------------------------
+
+/* Page-shipping replication, i.e. the stream of deltas between sequential
+ * snapshots, which is made after each commit and is applied by a follower.
+ *
+ * The last shipped snapshot is retained by a shared MDBX_snapshot, therefore
+ * pages of it are never reused until the next shipping. Thus the pages of a
+ * delta don't overlap ones of the base snapshot, and the follower is able to
+ * write them in-place while readers use the base snapshot, i.e. the current
+ * one of the follower. */
+
+__cold static int pageship_restart(MDBX_env *env, MDBX_pageship_func *func) {
+  MDBX_snapshot *base = nullptr;
+  if (func) {
+    int err = mdbx_snapshot_acquire(env, &base);
+    if (unlikely(err != MDBX_SUCCESS))
+      return err;
+  }
+  if (env->pageship.base)
+    txn_ro_snapshot_release(env->pageship.base);
+  env->pageship.base = base;
+  env->pageship.callback = func;
+  env->pageship.status = MDBX_SUCCESS;
+  return MDBX_SUCCESS;
+}
+
+__cold int pageship_commit(MDBX_env *env) {
+  MDBX_snapshot *const base = env->pageship.base;
+  MDBX_snapshot *next = nullptr;
+  int rc = mdbx_snapshot_acquire(env, &next);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return rc;
+  if (next->txn->txnid == base->txn->txnid) {
+    txn_ro_snapshot_release(next);
+    return MDBX_SUCCESS;
+  }
+
+  uint8_t *buffer = nullptr;
+  rc = osal_memalign_alloc(globals.sys_pagesize, MDBX_ENVCOPY_WRITEBUF, (void **)&buffer);
+  if (likely(rc == MDBX_SUCCESS)) {
+    delta_ctx_t ctx = {
+        .env = env, .since = base->txn->txnid, .sink = env->pageship.callback, .buffer = buffer};
+    rc = delta_copy(next->txn, &ctx);
+    osal_memalign_free(buffer);
+    if (likely(rc == MDBX_SUCCESS))
+      /* notify end of the delta */
+      rc = env->pageship.callback(env, next->txn->txnid, nullptr, 0);
+  }
+
+  /* on failure the base is kept, so the next delta will cover changes */
+  if (unlikely(rc != MDBX_SUCCESS)) {
+    txn_ro_snapshot_release(next);
+    return rc;
+  }
+  txn_ro_snapshot_release(base);
+  env->pageship.base = next;
+  return MDBX_SUCCESS;
+}
+
+__cold void pageship_stop(MDBX_env *env) {
+  if (env->pageship.base) {
+    txn_ro_snapshot_release(env->pageship.base);
+    env->pageship.base = nullptr;
+  }
+  env->pageship.callback = nullptr;
+  env->pageship.status = MDBX_SUCCESS;
+}
+
+__cold int mdbx_env_set_pageship(MDBX_env *env, MDBX_pageship_func *func) {
+  int rc = check_env(env, true);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return LOG_IFERR(rc);
+  if (unlikely(env->flags & MDBX_RDONLY))
+    return LOG_IFERR(MDBX_EACCESS);
+
+  if (env_owned_wrtxn(env))
+    return LOG_IFERR(pageship_restart(env, func));
+
+  rc = lck_txn_lock(env, false);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return LOG_IFERR(rc);
+  rc = pageship_restart(env, func);
+  lck_txn_unlock(env);
+  return LOG_IFERR(rc);
+}
+
+__cold MDBX_pageship_func *mdbx_env_get_pageship(const MDBX_env *env) {
+  return likely(env && env->signature.weak == env_signature) ? env->pageship.callback : nullptr;
+}
+
+__cold int mdbx_env_get_pageship_status(const MDBX_env *env) {
+  int rc = check_env(env, false);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return LOG_IFERR(rc);
+  return env->pageship.status;
+}
+
+/* Waits for readers of snapshots older than the given one by kicking them
+ * like in case of MDBX_MAP_FULL. */
+__cold static int follow_wait_readers(MDBX_env *env, const txnid_t threshold) {
+  for (txnid_t oldest; (oldest = mvcc_shapshot_oldest(env, threshold)) < threshold;)
+    if (!mvcc_kick_laggards(env, oldest))
+      return MDBX_BUSY;
+  return MDBX_SUCCESS;
+}
+
+__cold static int follow(MDBX_txn *txn, mdbx_filehandle_t delta_fd) {
+  MDBX_env *const env = txn->env;
+  const meta_ptr_t head = meta_recent(env, &txn->wr.troika);
+
+  /* Readers of the current snapshot are safe, but older ones should be
+   * finished before pages are overwritten. This is checked before reading
+   * the stream, so the MDBX_BUSY may be retried. */
+  int rc = follow_wait_readers(env, head.txnid);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return rc;
+
+  delta_header_t header;
+  rc = delta_read_header(delta_fd, &header);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return rc;
+  if (unlikely(!delta_is_applicable(&header, head.ptr_c))) {
+    ERROR("%s/%d: %s", "MDBX_INCOMPATIBLE", MDBX_INCOMPATIBLE, "the delta is for another DB or page size");
+    return MDBX_INCOMPATIBLE;
+  }
+  if (unlikely(head.txnid < header.since_txnid || head.txnid > header.txnid)) {
+    ERROR("%s/%d: the delta is for txnid %" PRIaTXN " since %" PRIaTXN ", but the follower is at %" PRIaTXN,
+          "MDBX_INCOMPATIBLE", MDBX_INCOMPATIBLE, header.txnid, header.since_txnid, head.txnid);
+    return MDBX_INCOMPATIBLE;
+  }
+  if (head.txnid > header.since_txnid && head.txnid < header.txnid) {
+    /* The pages of the delta may overlap ones of the current snapshot,
+     * e.g. for the first delta after the follower was copied. */
+    rc = follow_wait_readers(env, head.txnid + 1);
+    if (unlikely(rc != MDBX_SUCCESS))
+      return rc;
+  }
+
+  const size_t buffer_size = delta_buffer_size(&header);
+  uint8_t *buffer = nullptr;
+  rc = osal_memalign_alloc(globals.sys_pagesize, buffer_size, (void **)&buffer);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return rc;
+  size_t npages = 0;
+  rc = delta_read_pages(&header, delta_fd, env->lazy_fd, env, buffer, buffer_size, &npages);
+  if (unlikely(rc != MDBX_SUCCESS) || head.txnid == header.txnid /* already applied */)
+    goto bailout;
+
+  const meta_t *const model = page_meta(ptr_disp(buffer, pgno2bytes(env, NUM_METAS - 1)));
+  meta_t meta;
+  memcpy(meta.magic_and_version, head.ptr_c->magic_and_version, 8);
+  meta.reserve16 = head.ptr_c->reserve16;
+  meta.validator_id = head.ptr_c->validator_id;
+  meta.extra_pagehdr = head.ptr_c->extra_pagehdr;
+  memcpy(meta.pages_retired, head.ptr_c->pages_retired, 8);
+  meta.geometry = model->geometry;
+  meta.trees.gc = model->trees.gc;
+  meta.trees.main = model->trees.main;
+  meta.canary = model->canary;
+  memcpy(&meta.dxbid, &head.ptr_c->dxbid, sizeof(meta.dxbid));
+
+  /* the follower never shrinks, since it may be used by readers */
+  if (meta.geometry.now < txn->geo.now)
+    meta.geometry.now = txn->geo.now;
+  if (meta.geometry.upper < meta.geometry.now)
+    meta.geometry.upper = meta.geometry.now;
+  if (meta.geometry.now > txn->geo.now) {
+    rc = dxb_resize(env, meta.geometry.first_unallocated, meta.geometry.now, meta.geometry.upper, implicit_grow);
+    if (unlikely(rc != MDBX_SUCCESS))
+      goto bailout;
+  }
+
+  env->lck->unsynced_pages.weak += npages;
+  meta.unsafe_sign = DATASIGN_NONE;
+  meta_set_txnid(env, &meta, header.txnid);
+  rc = dxb_sync_locked(env, env->flags, &meta, &txn->wr.troika);
+  if (unlikely(rc != MDBX_SUCCESS)) {
+    env->flags |= ENV_FATAL_ERROR;
+    ERROR("follow: error %d", rc);
+  }
+
+bailout:
+  osal_memalign_free(buffer);
+  return rc;
+}
+
+__cold int mdbx_env_follow(MDBX_env *env, mdbx_filehandle_t delta_fd) {
+  int rc = check_env(env, true);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return LOG_IFERR(rc);
+  if (unlikely(env->flags & MDBX_RDONLY))
+    return LOG_IFERR(MDBX_EACCESS);
+
+  MDBX_txn *txn = nullptr;
+  rc = mdbx_txn_begin(env, nullptr, MDBX_TXN_READWRITE, &txn);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return LOG_IFERR(rc);
+
+  rc = follow(txn, delta_fd);
+  int err = mdbx_txn_abort(txn);
+  if (unlikely(err != MDBX_SUCCESS) && rc == MDBX_SUCCESS)
+    rc = err;
+  return LOG_IFERR(rc);
+}
@@ -470,12 +470,71 @@ int mdbx_cursor_eof(const MDBX_cursor *mc) {
   return is_eof(mc) ? MDBX_RESULT_TRUE : MDBX_RESULT_FALSE;
 }
 
+#if MDBX_ENABLE_DBI_OPSTAT || MDBX_ENABLE_LATENCY_HIST
+/* Классификация операций для статистики: позиционирование по ключу (seek),
+ * перемещение к соседним или крайним элементам (step), либо без перемещения. */
+typedef enum cursor_op_class { cursor_op_stay, cursor_op_seek, cursor_op_step } cursor_op_class_t;
+
+static inline cursor_op_class_t cursor_op_classify(MDBX_cursor_op op) {
+  switch (op) {
+  case MDBX_GET_CURRENT:
+  case MDBX_GET_MULTIPLE:
+    return cursor_op_stay;
+  case MDBX_GET_BOTH:
+  case MDBX_GET_BOTH_RANGE:
+  case MDBX_SET:
+  case MDBX_SET_KEY:
+  case MDBX_SET_RANGE:
+  case MDBX_SEEK_AND_GET_MULTIPLE:
+  case MDBX_SET_LOWERBOUND:
+  case MDBX_SET_UPPERBOUND:
+  case MDBX_TO_KEY_LESSER_THAN:
+  case MDBX_TO_KEY_LESSER_OR_EQUAL:
+  case MDBX_TO_KEY_EQUAL:
+  case MDBX_TO_KEY_GREATER_OR_EQUAL:
+  case MDBX_TO_KEY_GREATER_THAN:
+  case MDBX_TO_EXACT_KEY_VALUE_LESSER_THAN:
+  case MDBX_TO_EXACT_KEY_VALUE_LESSER_OR_EQUAL:
+  case MDBX_TO_EXACT_KEY_VALUE_EQUAL:
+  case MDBX_TO_EXACT_KEY_VALUE_GREATER_OR_EQUAL:
+  case MDBX_TO_EXACT_KEY_VALUE_GREATER_THAN:
+  case MDBX_TO_PAIR_LESSER_THAN:
+  case MDBX_TO_PAIR_LESSER_OR_EQUAL:
+  case MDBX_TO_PAIR_EQUAL:
+  case MDBX_TO_PAIR_GREATER_OR_EQUAL:
+  case MDBX_TO_PAIR_GREATER_THAN:
+    return cursor_op_seek;
+  default:
+    return cursor_op_step;
+  }
+}
+#endif /* MDBX_ENABLE_DBI_OPSTAT || MDBX_ENABLE_LATENCY_HIST */
+
 int mdbx_cursor_get(MDBX_cursor *mc, MDBX_val *key, MDBX_val *data, MDBX_cursor_op op) {
   int rc = cursor_check_ro(mc);
   if (unlikely(rc != MDBX_SUCCESS))
     return LOG_IFERR(rc);
 
-  return LOG_IFERR(cursor_ops(mc, key, data, op));
+#if MDBX_ENABLE_DBI_OPSTAT || MDBX_ENABLE_LATENCY_HIST
+  const cursor_op_class_t op_class = cursor_op_classify(op);
+#endif /* MDBX_ENABLE_DBI_OPSTAT || MDBX_ENABLE_LATENCY_HIST */
+#if MDBX_ENABLE_DBI_OPSTAT
+  if (op_class == cursor_op_seek)
+    opstat_add(&cursor_opstat(mc)->seeks, 1);
+  else if (op_class == cursor_op_step)
+    opstat_add(&cursor_opstat(mc)->steps, 1);
+#endif /* MDBX_ENABLE_DBI_OPSTAT */
+#if MDBX_ENABLE_LATENCY_HIST
+  latency_probe_t probe;
+  const bool sampled =
+      op_class == cursor_op_seek && latency_probe_begin(mc->txn->env, &mc->txn->latency_tick, &probe);
+#endif /* MDBX_ENABLE_LATENCY_HIST */
+  rc = cursor_ops(mc, key, data, op);
+#if MDBX_ENABLE_LATENCY_HIST
+  if (sampled)
+    latency_probe_end(mc->txn->env, &probe, MDBX_LATENCY_SEEK);
+#endif /* MDBX_ENABLE_LATENCY_HIST */
+  return LOG_IFERR(rc);
 }
 
 __hot static int scan_confinue(MDBX_cursor *mc, MDBX_predicate_func *predicate, void *context, void *arg, MDBX_val *key,
@@ -731,6 +790,9 @@ int mdbx_cursor_put(MDBX_cursor *mc, const MDBX_val *key, MDBX_val *data, MDBX_p
     data->iov_base = nullptr;
   }
 
+#if MDBX_ENABLE_DBI_OPSTAT
+  opstat_add(&cursor_opstat(mc)->puts, 1);
+#endif /* MDBX_ENABLE_DBI_OPSTAT */
   return LOG_IFERR(cursor_put_checklen(mc, key, data, flags));
 }
 
@@ -739,6 +801,9 @@ int mdbx_cursor_del(MDBX_cursor *mc, MDBX_put_flags_t flags) {
   if (unlikely(rc != MDBX_SUCCESS))
     return LOG_IFERR(rc);
 
+#if MDBX_ENABLE_DBI_OPSTAT
+  opstat_add(&cursor_opstat(mc)->dels, 1);
+#endif /* MDBX_ENABLE_DBI_OPSTAT */
   return LOG_IFERR(cursor_del(mc, flags));
 }
 
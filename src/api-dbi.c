@@ -258,6 +258,37 @@ __cold int mdbx_dbi_stat(const MDBX_txn *txn, MDBX_dbi dbi, MDBX_stat *dest, siz
   return MDBX_SUCCESS;
 }
 
+__cold int mdbx_dbi_opstat(const MDBX_txn *txn, MDBX_dbi dbi, MDBX_dbi_opstat *dest, size_t bytes, bool reset) {
+  int rc = check_txn(txn, MDBX_TXN_BLOCKED);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return LOG_IFERR(rc);
+
+  rc = dbi_check(txn, dbi);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return LOG_IFERR(rc);
+
+  if (unlikely(!dest || bytes != sizeof(MDBX_dbi_opstat)))
+    return LOG_IFERR(MDBX_EINVAL);
+
+#if MDBX_ENABLE_DBI_OPSTAT
+  dbi_opstat_t *const opstat = txn->env->dbi_opstat + dbi;
+  dest->gets = opstat_fetch(&opstat->gets, reset);
+  dest->puts = opstat_fetch(&opstat->puts, reset);
+  dest->dels = opstat_fetch(&opstat->dels, reset);
+  dest->seeks = opstat_fetch(&opstat->seeks, reset);
+  dest->steps = opstat_fetch(&opstat->steps, reset);
+  dest->newly = opstat_fetch(&opstat->newly, reset);
+  dest->cow = opstat_fetch(&opstat->cow, reset);
+  dest->split = opstat_fetch(&opstat->split, reset);
+  dest->merge = opstat_fetch(&opstat->merge, reset);
+  dest->large = opstat_fetch(&opstat->large, reset);
+#else
+  (void)reset;
+  memset(dest, 0, sizeof(*dest));
+#endif /* MDBX_ENABLE_DBI_OPSTAT */
+  return MDBX_SUCCESS;
+}
+
 __cold int mdbx_enumerate_tables(const MDBX_txn *txn, MDBX_table_enum_func *func, void *ctx) {
   if (unlikely(!func))
     return LOG_IFERR(MDBX_EINVAL);
@@ -289,17 +320,11 @@ __cold int mdbx_enumerate_tables(const MDBX_txn *txn, MDBX_table_enum_func *func
     const tree_t *tree = memcpy(&reside, node_data(node), sizeof(reside));
     const MDBX_val name = {node_key(node), node_ks(node)};
     const MDBX_env *const env = txn->env;
-    MDBX_dbi dbi = 0;
-    for (size_t i = CORE_DBS; i < env->n_dbi; ++i) {
-      if (i >= txn->n_dbi || !(env->dbs_flags[i] & DB_VALID))
-        continue;
-      if (env->kvs[MAIN_DBI].clc.k.cmp(&name, &env->kvs[i].name))
-        continue;
-
-      tree = dbi_dig(txn, i, &reside);
-      dbi = (MDBX_dbi)i;
-      break;
-    }
+    MDBX_dbi dbi = (MDBX_dbi)dbi_lookup(env, &name);
+    if (dbi && dbi < txn->n_dbi)
+      tree = dbi_dig(txn, dbi, &reside);
+    else
+      dbi = 0;
 
     MDBX_stat stat;
     stat_get(tree, &stat, sizeof(stat));
@@ -232,7 +232,7 @@ __cold int mdbx_env_create(MDBX_env **penv) {
     return LOG_IFERR(MDBX_ENOMEM);
 
   env->max_readers = DEFAULT_READERS;
-  env->max_dbi = env->n_dbi = CORE_DBS;
+  env->max_dbi = env->n_dbi = env->dbi_free_hint = CORE_DBS;
   env->lazy_fd = env->dsync_fd = env->fd4meta = env->lck_mmap.fd = INVALID_HANDLE_VALUE;
   env->stuck_meta = -1;
 
@@ -429,6 +429,54 @@ __cold int mdbx_env_deleteW(const wchar_t *pathname, MDBX_env_delete_mode_t mode
   return LOG_IFERR((err == MDBX_SUCCESS) ? rc : err);
 }
 
+__cold int mdbx_env_apply_delta(const char *pathname, mdbx_filehandle_t delta_fd) {
+#if defined(_WIN32) || defined(_WIN64)
+  wchar_t *pathnameW = nullptr;
+  int rc = osal_mb2w(pathname, &pathnameW);
+  if (likely(rc == MDBX_SUCCESS)) {
+    rc = mdbx_env_apply_deltaW(pathnameW, delta_fd);
+    osal_free(pathnameW);
+  }
+  return LOG_IFERR(rc);
+}
+
+__cold int mdbx_env_apply_deltaW(const wchar_t *pathname, mdbx_filehandle_t delta_fd) {
+#endif /* Windows */
+
+#ifdef __e2k__ /* https://bugs.mcst.ru/bugzilla/show_bug.cgi?id=6011 */
+  MDBX_env *const dummy_env = alloca(sizeof(MDBX_env));
+#else
+  MDBX_env dummy_env_silo, *const dummy_env = &dummy_env_silo;
+#endif
+  memset(dummy_env, 0, sizeof(*dummy_env));
+  dummy_env->flags = MDBX_EXCLUSIVE;
+  dummy_env->ps = (unsigned)mdbx_default_pagesize();
+
+  int err = env_handle_pathname(dummy_env, pathname, 0);
+  if (likely(err == MDBX_SUCCESS)) {
+    mdbx_filehandle_t clk_handle = INVALID_HANDLE_VALUE, dxb_handle = INVALID_HANDLE_VALUE;
+    err = osal_openfile(MDBX_OPEN_DELETE, dummy_env, dummy_env->pathname.lck, &clk_handle, 0);
+    err = (err == MDBX_ENOFILE) ? MDBX_SUCCESS : err;
+    if (err == MDBX_SUCCESS && clk_handle != INVALID_HANDLE_VALUE)
+      err = osal_lockfile(clk_handle, false);
+    if (err == MDBX_SUCCESS)
+      err = osal_openfile(MDBX_OPEN_DXB_LAZY, dummy_env, dummy_env->pathname.dxb, &dxb_handle, 0);
+    if (err == MDBX_SUCCESS)
+      err = osal_lockfile(dxb_handle, false);
+
+    if (err == MDBX_SUCCESS)
+      err = delta_apply(dxb_handle, delta_fd);
+
+    if (dxb_handle != INVALID_HANDLE_VALUE)
+      osal_closefile(dxb_handle);
+    if (clk_handle != INVALID_HANDLE_VALUE)
+      osal_closefile(clk_handle);
+  }
+
+  osal_free(dummy_env->pathname.buffer);
+  return LOG_IFERR(err);
+}
+
 __cold int mdbx_env_open(MDBX_env *env, const char *pathname, MDBX_env_flags_t flags, mdbx_mode_t mode) {
 #if defined(_WIN32) || defined(_WIN64)
   wchar_t *pathnameW = nullptr;
@@ -491,7 +539,18 @@ __cold int mdbx_env_openW(MDBX_env *env, const wchar_t *pathname, MDBX_env_flags
   env->kvs = osal_calloc(env->max_dbi, sizeof(env->kvs[0]));
   env->dbs_flags = osal_calloc(env->max_dbi, sizeof(env->dbs_flags[0]));
   env->dbi_seqs = osal_calloc(env->max_dbi, sizeof(env->dbi_seqs[0]));
-  if (unlikely(!(env->kvs && env->dbs_flags && env->dbi_seqs))) {
+#if MDBX_ENABLE_DBI_OPSTAT
+  env->dbi_opstat = osal_calloc(env->max_dbi, sizeof(env->dbi_opstat[0]));
+  if (unlikely(!env->dbi_opstat)) {
+    rc = MDBX_ENOMEM;
+    goto bailout;
+  }
+#endif /* MDBX_ENABLE_DBI_OPSTAT */
+  const size_t hash_bytes = dbi_hash_bytes(env->max_dbi);
+  env->dbi_hash = osal_calloc(1, hash_bytes);
+  env->dbi_hash_mask = (uint32_t)(hash_bytes / sizeof(env->dbi_hash[0]) - 1);
+  env->dbi_hash_deleted = 0;
+  if (unlikely(!(env->kvs && env->dbs_flags && env->dbi_seqs && env->dbi_hash))) {
     rc = MDBX_ENOMEM;
     goto bailout;
   }
@@ -630,6 +689,10 @@ __cold int mdbx_env_close_ex(MDBX_env *env, bool dont_sync) {
 #endif /* Windows */
   }
 
+  if ((env->flags & ENV_FATAL_ERROR) == 0)
+    /* release the last shipped snapshot, but not in a child after fork() */
+    pageship_stop(env);
+
   if (env->basal_txn && (MDBX_TXN_CHECKOWNER ? env->basal_txn->owner == osal_thread_self() : !!env->basal_txn->owner))
     lck_txn_unlock(env);
 
@@ -669,6 +732,7 @@ static int env_info_snap(const MDBX_env *env, const MDBX_txn *txn, MDBX_envinfo
   const size_t size_before_bootid = offsetof(MDBX_envinfo, mi_bootid);
   const size_t size_before_pgop_stat = offsetof(MDBX_envinfo, mi_pgop_stat);
   const size_t size_before_dxbid = offsetof(MDBX_envinfo, mi_dxbid);
+  const size_t size_before_wrt_lock = offsetof(MDBX_envinfo, mi_wrt_lock);
   if (unlikely(env->flags & ENV_FATAL_ERROR))
     return MDBX_PANIC;
 
@@ -779,6 +843,14 @@ static int env_info_snap(const MDBX_env *env, const MDBX_txn *txn, MDBX_envinfo
 #endif /* MDBX_ENABLE_PGOP_STAT*/
   }
 
+  if (likely(bytes > size_before_wrt_lock)) {
+    out->mi_wrt_lock.acquisitions = atomic_load64(&lck->wrt_stat.acquisitions, mo_Relaxed);
+    out->mi_wrt_lock.contended = atomic_load64(&lck->wrt_stat.contended, mo_Relaxed);
+    out->mi_wrt_lock.wait_seconds16dot16 = atomic_load64(&lck->wrt_stat.wait_time, mo_Relaxed);
+    out->mi_wrt_lock.waiters = atomic_load32(&lck->wrt_stat.waiters, mo_Relaxed);
+    out->mi_wrt_lock.max_waiters = atomic_load32(&lck->wrt_stat.max_waiters, mo_Relaxed);
+  }
+
   txnid_t overall_latter_reader_txnid = out->mi_recent_txnid;
   txnid_t self_latter_reader_txnid = overall_latter_reader_txnid;
   if (env->lck_mmap.lck) {
@@ -819,6 +891,29 @@ __cold int env_info(const MDBX_env *env, const MDBX_txn *txn, MDBX_envinfo *out,
   }
 }
 
+__cold int mdbx_env_latency_hist(const MDBX_env *env, MDBX_latency_kind_t kind, bool aggregate,
+                                 MDBX_latency_hist *hist, size_t bytes) {
+  if (unlikely(hist == nullptr || bytes != sizeof(MDBX_latency_hist) || (unsigned)kind >= MDBX_LATENCY_KINDS))
+    return LOG_IFERR(MDBX_EINVAL);
+  memset(hist, 0, sizeof(MDBX_latency_hist));
+
+  int err = check_env(env, true);
+  if (unlikely(err != MDBX_SUCCESS))
+    return LOG_IFERR(err);
+
+#if MDBX_ENABLE_LATENCY_HIST
+  const lat_hist_t *const from = aggregate ? &env->lck->latency[kind] : &env->latency.local[kind];
+  hist->count = atomic_load64(&from->count, mo_Relaxed);
+  hist->total_ns = atomic_load64(&from->total, mo_Relaxed);
+  for (size_t i = 0; i < MDBX_LATENCY_BUCKETS; ++i)
+    hist->buckets[i] = atomic_load64(&from->buckets[i], mo_Relaxed);
+  return MDBX_SUCCESS;
+#else
+  (void)aggregate;
+  return MDBX_ENOSYS;
+#endif /* MDBX_ENABLE_LATENCY_HIST */
+}
+
 __cold int mdbx_env_info_ex(const MDBX_env *env, const MDBX_txn *txn, MDBX_envinfo *arg, size_t bytes) {
   if (unlikely((env == nullptr && txn == nullptr) || arg == nullptr))
     return LOG_IFERR(MDBX_EINVAL);
@@ -826,8 +921,9 @@ __cold int mdbx_env_info_ex(const MDBX_env *env, const MDBX_txn *txn, MDBX_envin
   const size_t size_before_bootid = offsetof(MDBX_envinfo, mi_bootid);
   const size_t size_before_pgop_stat = offsetof(MDBX_envinfo, mi_pgop_stat);
   const size_t size_before_dxbid = offsetof(MDBX_envinfo, mi_dxbid);
+  const size_t size_before_wrt_lock = offsetof(MDBX_envinfo, mi_wrt_lock);
   if (unlikely(bytes != sizeof(MDBX_envinfo)) && bytes != size_before_bootid && bytes != size_before_pgop_stat &&
-      bytes != size_before_dxbid)
+      bytes != size_before_dxbid && bytes != size_before_wrt_lock)
     return LOG_IFERR(MDBX_EINVAL);
 
   if (txn) {
@@ -868,8 +964,9 @@ __cold int mdbx_preopen_snapinfoW(const wchar_t *pathname, MDBX_envinfo *out, si
   const size_t size_before_bootid = offsetof(MDBX_envinfo, mi_bootid);
   const size_t size_before_pgop_stat = offsetof(MDBX_envinfo, mi_pgop_stat);
   const size_t size_before_dxbid = offsetof(MDBX_envinfo, mi_dxbid);
+  const size_t size_before_wrt_lock = offsetof(MDBX_envinfo, mi_wrt_lock);
   if (unlikely(bytes != sizeof(MDBX_envinfo)) && bytes != size_before_bootid && bytes != size_before_pgop_stat &&
-      bytes != size_before_dxbid)
+      bytes != size_before_dxbid && bytes != size_before_wrt_lock)
     return LOG_IFERR(MDBX_EINVAL);
 
   memset(out, 0, bytes);
@@ -1361,13 +1458,9 @@ static int stat_acc(const MDBX_txn *txn, MDBX_stat *st, size_t bytes) {
 
         /* skip opened and already accounted */
         const MDBX_val name = {node_key(node), node_ks(node)};
-        TXN_FOREACH_DBI_USER(txn, dbi) {
-          if ((txn->dbi_state[dbi] & (DBI_VALID | DBI_STALE)) == DBI_VALID &&
-              env->kvs[MAIN_DBI].clc.k.cmp(&name, &env->kvs[dbi].name) == 0) {
-            node = nullptr;
-            break;
-          }
-        }
+        const size_t dbi = dbi_lookup(env, &name);
+        if (dbi && (dbi_state(txn, dbi) & (DBI_VALID | DBI_STALE)) == DBI_VALID)
+          node = nullptr;
 
         if (node) {
           tree_t db;
@@ -95,7 +95,7 @@ __cold int mdbx_thread_register(const MDBX_env *env) {
     return MDBX_RESULT_TRUE /* already registered */;
   }
 
-  return LOG_IFERR(mvcc_bind_slot((MDBX_env *)env).err);
+  return LOG_IFERR(mvcc_bind_slot((MDBX_env *)env, true).err);
 }
 
 __cold int mdbx_thread_unregister(const MDBX_env *env) {
@@ -125,7 +125,7 @@ __cold int mdbx_thread_unregister(const MDBX_env *env) {
     return LOG_IFERR(MDBX_BUSY) /* transaction is still active */;
 
   atomic_store32(&r->pid, 0, mo_Relaxed);
-  atomic_store32(&env->lck->rdt_refresh_flag, true, mo_AcquireRelease);
+  lck_rdt_changed(env->lck, r);
   thread_rthc_set(env->me_txkey, nullptr);
   return MDBX_SUCCESS;
 }
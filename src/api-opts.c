@@ -464,6 +464,20 @@ __cold int mdbx_env_set_option(MDBX_env *env, const MDBX_option_t option, uint64
     }
     break;
 
+  case MDBX_opt_latency_sampling:
+    if (value == /* default */ UINT64_MAX)
+      value = 0;
+#if MDBX_ENABLE_LATENCY_HIST
+    if (value > UINT32_C(1) << 30)
+      err = MDBX_EINVAL;
+    else
+      env->latency.period = value ? 1u << ceil_log2n((size_t)value) : 0;
+#else
+    if (value)
+      err = MDBX_ENOSYS;
+#endif /* MDBX_ENABLE_LATENCY_HIST */
+    break;
+
   default:
     return LOG_IFERR(MDBX_EINVAL);
   }
@@ -570,6 +584,14 @@ __cold int mdbx_env_get_option(const MDBX_env *env, const MDBX_option_t option,
     *pvalue = env->options.subpage.reserve_limit;
     break;
 
+  case MDBX_opt_latency_sampling:
+#if MDBX_ENABLE_LATENCY_HIST
+    *pvalue = env->latency.period;
+#else
+    *pvalue = 0;
+#endif /* MDBX_ENABLE_LATENCY_HIST */
+    break;
+
   default:
     return LOG_IFERR(MDBX_EINVAL);
   }
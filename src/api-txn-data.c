@@ -80,7 +80,19 @@ int mdbx_get(const MDBX_txn *txn, MDBX_dbi dbi, const MDBX_val *key, MDBX_val *d
   if (unlikely(rc != MDBX_SUCCESS))
     return LOG_IFERR(rc);
 
-  return LOG_IFERR(cursor_seek(&cx.outer, (MDBX_val *)key, data, MDBX_SET).err);
+#if MDBX_ENABLE_DBI_OPSTAT
+  opstat_add(&txn->env->dbi_opstat[dbi].gets, 1);
+#endif /* MDBX_ENABLE_DBI_OPSTAT */
+#if MDBX_ENABLE_LATENCY_HIST
+  latency_probe_t probe;
+  const bool sampled = latency_probe_begin(txn->env, &((MDBX_txn *)txn)->latency_tick, &probe);
+#endif /* MDBX_ENABLE_LATENCY_HIST */
+  rc = cursor_seek(&cx.outer, (MDBX_val *)key, data, MDBX_SET).err;
+#if MDBX_ENABLE_LATENCY_HIST
+  if (sampled)
+    latency_probe_end(txn->env, &probe, MDBX_LATENCY_GET);
+#endif /* MDBX_ENABLE_LATENCY_HIST */
+  return LOG_IFERR(rc);
 }
 
 int mdbx_get_equal_or_great(const MDBX_txn *txn, MDBX_dbi dbi, MDBX_val *key, MDBX_val *data) {
@@ -96,7 +108,19 @@ int mdbx_get_equal_or_great(const MDBX_txn *txn, MDBX_dbi dbi, MDBX_val *key, MD
   if (unlikely(rc != MDBX_SUCCESS))
     return LOG_IFERR(rc);
 
-  return LOG_IFERR(cursor_ops(&cx.outer, key, data, MDBX_SET_LOWERBOUND));
+#if MDBX_ENABLE_DBI_OPSTAT
+  opstat_add(&txn->env->dbi_opstat[dbi].gets, 1);
+#endif /* MDBX_ENABLE_DBI_OPSTAT */
+#if MDBX_ENABLE_LATENCY_HIST
+  latency_probe_t probe;
+  const bool sampled = latency_probe_begin(txn->env, &((MDBX_txn *)txn)->latency_tick, &probe);
+#endif /* MDBX_ENABLE_LATENCY_HIST */
+  rc = cursor_ops(&cx.outer, key, data, MDBX_SET_LOWERBOUND);
+#if MDBX_ENABLE_LATENCY_HIST
+  if (sampled)
+    latency_probe_end(txn->env, &probe, MDBX_LATENCY_GET);
+#endif /* MDBX_ENABLE_LATENCY_HIST */
+  return LOG_IFERR(rc);
 }
 
 int mdbx_get_ex(const MDBX_txn *txn, MDBX_dbi dbi, MDBX_val *key, MDBX_val *data, size_t *values_count) {
@@ -115,7 +139,18 @@ int mdbx_get_ex(const MDBX_txn *txn, MDBX_dbi dbi, MDBX_val *key, MDBX_val *data
   if (unlikely(rc != MDBX_SUCCESS))
     return LOG_IFERR(rc);
 
+#if MDBX_ENABLE_DBI_OPSTAT
+  opstat_add(&txn->env->dbi_opstat[dbi].gets, 1);
+#endif /* MDBX_ENABLE_DBI_OPSTAT */
+#if MDBX_ENABLE_LATENCY_HIST
+  latency_probe_t probe;
+  const bool sampled = latency_probe_begin(txn->env, &((MDBX_txn *)txn)->latency_tick, &probe);
+#endif /* MDBX_ENABLE_LATENCY_HIST */
   rc = cursor_seek(&cx.outer, key, data, MDBX_SET_KEY).err;
+#if MDBX_ENABLE_LATENCY_HIST
+  if (sampled)
+    latency_probe_end(txn->env, &probe, MDBX_LATENCY_GET);
+#endif /* MDBX_ENABLE_LATENCY_HIST */
   if (unlikely(rc != MDBX_SUCCESS)) {
     if (values_count)
       *values_count = 0;
@@ -227,6 +262,9 @@ int mdbx_del(MDBX_txn *txn, MDBX_dbi dbi, const MDBX_val *key, const MDBX_val *d
   if (unlikely(rc != MDBX_SUCCESS))
     return LOG_IFERR(rc);
 
+#if MDBX_ENABLE_DBI_OPSTAT
+  opstat_add(&txn->env->dbi_opstat[dbi].dels, 1);
+#endif /* MDBX_ENABLE_DBI_OPSTAT */
   MDBX_val proxy;
   MDBX_cursor_op op = MDBX_SET;
   unsigned flags = MDBX_ALLDUPS;
@@ -279,6 +317,9 @@ int mdbx_put(MDBX_txn *txn, MDBX_dbi dbi, const MDBX_val *key, MDBX_val *data, M
     data->iov_base = nullptr;
   }
 
+#if MDBX_ENABLE_DBI_OPSTAT
+  opstat_add(&txn->env->dbi_opstat[dbi].puts, 1);
+#endif /* MDBX_ENABLE_DBI_OPSTAT */
   cx.outer.next = txn->cursors[dbi];
   txn->cursors[dbi] = &cx.outer;
 
@@ -427,6 +468,12 @@ int mdbx_replace_ex(MDBX_txn *txn, MDBX_dbi dbi, const MDBX_val *key, MDBX_val *
     }
   }
 
+#if MDBX_ENABLE_DBI_OPSTAT
+  if (new_data)
+    opstat_add(&txn->env->dbi_opstat[dbi].puts, 1);
+  else
+    opstat_add(&txn->env->dbi_opstat[dbi].dels, 1);
+#endif /* MDBX_ENABLE_DBI_OPSTAT */
   if (likely(new_data))
     rc = cursor_put_checklen(&cx.outer, key, new_data, flags);
   else
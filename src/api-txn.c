@@ -112,6 +112,7 @@ int mdbx_txn_abort(MDBX_txn *txn) {
   }
 #endif /* MDBX_TXN_CHECKOWNER */
 
+  USDT_PROBE2(txn_abort, txn->txnid, txn->flags);
   return LOG_IFERR(txn_abort(txn));
 }
 
@@ -128,6 +129,10 @@ int mdbx_txn_park(MDBX_txn *txn, bool autounpark) {
   if (unlikely((txn->flags & MDBX_TXN_RDONLY) == 0))
     return LOG_IFERR(MDBX_TXN_INVALID);
 
+  if (unlikely(txn->ro.snapshot))
+    /* the view of a shared snapshot doesn't own a reader slot */
+    return LOG_IFERR(MDBX_EINVAL);
+
   if (unlikely((txn->flags & MDBX_TXN_ERROR))) {
     rc = txn_end(txn, TXN_END_RESET | TXN_END_UPDATE);
     return LOG_IFERR(rc ? rc : MDBX_OUSTED);
@@ -176,8 +181,18 @@ int mdbx_txn_renew(MDBX_txn *txn) {
       return rc;
   }
 
+#if MDBX_ENABLE_LATENCY_HIST
+  latency_probe_t probe;
+  const bool sampled = latency_probe_begin(txn->env, &txn->env->latency.tick, &probe);
+#endif /* MDBX_ENABLE_LATENCY_HIST */
+
   rc = txn_renew(txn, MDBX_TXN_RDONLY);
   if (rc == MDBX_SUCCESS) {
+#if MDBX_ENABLE_LATENCY_HIST
+    if (sampled)
+      latency_probe_end(txn->env, &probe, MDBX_LATENCY_READ_BEGIN);
+#endif /* MDBX_ENABLE_LATENCY_HIST */
+    USDT_PROBE2(txn_begin, txn->txnid, txn->flags);
     tASSERT(txn, txn->owner == (txn->flags & MDBX_NOSTICKYTHREADS) ? 0 : osal_thread_self());
     DEBUG("renew txn %" PRIaTXN "%c %p on env %p, root page %" PRIaPGNO "/%" PRIaPGNO, txn->txnid,
           (txn->flags & MDBX_TXN_RDONLY) ? 'r' : 'w', (void *)txn, (void *)txn->env, txn->dbs[MAIN_DBI].root,
@@ -244,6 +259,10 @@ int mdbx_txn_begin_ex(MDBX_env *env, MDBX_txn *parent, MDBX_txn_flags_t flags, M
       tASSERT(txn, audit_ex(txn, 0, false) == 0);
     }
   } else {
+#if MDBX_ENABLE_LATENCY_HIST
+    latency_probe_t probe;
+    const bool sampled = (flags & MDBX_TXN_RDONLY) && latency_probe_begin(env, &env->latency.tick, &probe);
+#endif /* MDBX_ENABLE_LATENCY_HIST */
     txn = env->basal_txn;
     if (flags & MDBX_TXN_RDONLY) {
       txn = txn_alloc(flags, env);
@@ -256,6 +275,10 @@ int mdbx_txn_begin_ex(MDBX_env *env, MDBX_txn *parent, MDBX_txn_flags_t flags, M
         osal_free(txn);
       return LOG_IFERR(rc);
     }
+#if MDBX_ENABLE_LATENCY_HIST
+    if (sampled)
+      latency_probe_end(env, &probe, MDBX_LATENCY_READ_BEGIN);
+#endif /* MDBX_ENABLE_LATENCY_HIST */
   }
 
   if (flags & (MDBX_TXN_RDONLY_PREPARE - MDBX_TXN_RDONLY))
@@ -271,12 +294,136 @@ int mdbx_txn_begin_ex(MDBX_env *env, MDBX_txn *parent, MDBX_txn_flags_t flags, M
   txn->signature = txn_signature;
   txn->userctx = context;
   *ret = txn;
+  USDT_PROBE2(txn_begin, txn->txnid, txn->flags);
   DEBUG("begin txn %" PRIaTXN "%c %p on env %p, root page %" PRIaPGNO "/%" PRIaPGNO, txn->txnid,
         (flags & MDBX_TXN_RDONLY) ? 'r' : 'w', (void *)txn, (void *)env, txn->dbs[MAIN_DBI].root,
         txn->dbs[FREE_DBI].root);
   return MDBX_SUCCESS;
 }
 
+int mdbx_snapshot_acquire(MDBX_env *env, MDBX_snapshot **ret) {
+  if (unlikely(!ret))
+    return LOG_IFERR(MDBX_EINVAL);
+  *ret = nullptr;
+
+  int rc = check_env(env, true);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return LOG_IFERR(rc);
+
+  MDBX_snapshot *const snapshot = osal_malloc(sizeof(MDBX_snapshot));
+  if (unlikely(!snapshot))
+    return LOG_IFERR(MDBX_ENOMEM);
+
+  /* The holder is a hidden read txn which isn't bound to any thread,
+   * so it occupies a separate reader slot without using of TLS.
+   * The txn_snapshot_holder distinguishes it from a txn of an env
+   * with MDBX_NOSTICKYTHREADS, since the env may be in the sticky mode. */
+  MDBX_txn *const txn = txn_alloc(MDBX_TXN_RDONLY, env);
+  if (unlikely(!txn)) {
+    osal_free(snapshot);
+    return LOG_IFERR(MDBX_ENOMEM);
+  }
+  rc = txn_renew(txn, MDBX_TXN_RDONLY | MDBX_NOSTICKYTHREADS | txn_snapshot_holder);
+  if (unlikely(rc != MDBX_SUCCESS)) {
+    osal_free(txn);
+    osal_free(snapshot);
+    return LOG_IFERR(rc);
+  }
+  txn->signature = txn_signature;
+
+  snapshot->signature = snapshot_signature;
+  snapshot->refs.weak = 1;
+  snapshot->txn = txn;
+  *ret = snapshot;
+  DEBUG("acquire snapshot %" PRIaTXN " %p on env %p", txn->txnid, (void *)snapshot, (void *)env);
+  return MDBX_SUCCESS;
+}
+
+static inline int check_snapshot(const MDBX_snapshot *snapshot) {
+  if (unlikely(!snapshot))
+    return MDBX_EINVAL;
+  if (unlikely(snapshot->signature != snapshot_signature || snapshot->refs.weak == 0))
+    return MDBX_EBADSIGN;
+  return check_env(snapshot->txn->env, true);
+}
+
+int mdbx_snapshot_retain(MDBX_snapshot *snapshot) {
+  int rc = check_snapshot(snapshot);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return LOG_IFERR(rc);
+
+  atomic_add32(&snapshot->refs, 1);
+  return MDBX_SUCCESS;
+}
+
+int mdbx_snapshot_release(MDBX_snapshot *snapshot) {
+  int rc = check_snapshot(snapshot);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return LOG_IFERR(rc);
+
+  txn_ro_snapshot_release(snapshot);
+  return MDBX_SUCCESS;
+}
+
+uint64_t mdbx_snapshot_id(const MDBX_snapshot *snapshot) {
+  if (unlikely(!snapshot || snapshot->signature != snapshot_signature))
+    return 0;
+  return snapshot->txn->txnid;
+}
+
+int mdbx_snapshot_begin(MDBX_snapshot *snapshot, MDBX_txn **in_out_txn, void *context) {
+  if (unlikely(!in_out_txn))
+    return LOG_IFERR(MDBX_EINVAL);
+
+  int rc = check_snapshot(snapshot);
+  if (unlikely(rc != MDBX_SUCCESS))
+    return LOG_IFERR(rc);
+
+  MDBX_env *const env = snapshot->txn->env;
+  MDBX_txn *txn = *in_out_txn;
+  if (txn) {
+    /* reuse a read txn like as mdbx_txn_renew() */
+    rc = check_txn(txn, 0);
+    if (unlikely(rc != MDBX_SUCCESS))
+      return LOG_IFERR(rc);
+    if (unlikely(txn->env != env || (txn->flags & MDBX_TXN_RDONLY) == 0))
+      return LOG_IFERR(MDBX_EINVAL);
+  }
+
+  /* retain before the reset, since the txn may be the view of this snapshot */
+  atomic_add32(&snapshot->refs, 1);
+  if (txn) {
+    if (txn->owner != 0 || !(txn->flags & MDBX_TXN_FINISHED))
+      rc = mdbx_txn_reset(txn);
+    if (likely(rc == MDBX_SUCCESS) && txn->ro.slot)
+      /* the view doesn't need a reader slot */
+      rc = txn_end(txn, TXN_END_RESET | TXN_END_SLOT);
+  } else {
+    txn = txn_alloc(MDBX_TXN_RDONLY, env);
+    if (unlikely(!txn))
+      rc = MDBX_ENOMEM;
+  }
+  if (unlikely(rc != MDBX_SUCCESS)) {
+    txn_ro_snapshot_release(snapshot);
+    return LOG_IFERR(rc);
+  }
+
+  txn->ro.snapshot = snapshot;
+  rc = txn_renew(txn, MDBX_TXN_RDONLY);
+  if (unlikely(rc != MDBX_SUCCESS)) {
+    tASSERT(txn, txn->ro.snapshot == nullptr);
+    if (!*in_out_txn)
+      osal_free(txn);
+    return LOG_IFERR(rc);
+  }
+
+  txn->signature = txn_signature;
+  txn->userctx = context;
+  *in_out_txn = txn;
+  DEBUG("begin view %" PRIaTXN " %p of snapshot %p on env %p", txn->txnid, (void *)txn, (void *)snapshot, (void *)env);
+  return MDBX_SUCCESS;
+}
+
 static void latency_gcprof(MDBX_commit_latency *latency, const MDBX_txn *txn) {
   MDBX_env *const env = txn->env;
   if (latency && likely(env->lck) && MDBX_ENABLE_PROFGC) {
@@ -316,9 +463,11 @@ static void latency_gcprof(MDBX_commit_latency *latency, const MDBX_txn *txn) {
 static void latency_init(MDBX_commit_latency *latency, struct commit_timestamp *ts) {
   ts->start = 0;
   ts->gc_cpu = 0;
-  if (latency) {
+  if (latency || MDBX_ENABLE_USDT) {
+    /* для USDT длительности фаз фиксации замеряются всегда */
     ts->start = osal_monotime();
-    memset(latency, 0, sizeof(*latency));
+    if (latency)
+      memset(latency, 0, sizeof(*latency));
   }
   ts->prep = ts->gc = ts->audit = ts->write = ts->sync = ts->start;
 }
@@ -337,11 +486,18 @@ static void latency_done(MDBX_commit_latency *latency, struct commit_timestamp *
   }
 }
 
+#if MDBX_ENABLE_USDT
+static inline uint64_t usdt_phase_ns(uint64_t begin, uint64_t end) {
+  return (end > begin) ? osal_monotime_to_ns(end - begin) : 0;
+}
+#endif /* MDBX_ENABLE_USDT */
+
 int mdbx_txn_commit_ex(MDBX_txn *txn, MDBX_commit_latency *latency) {
   STATIC_ASSERT(MDBX_TXN_FINISHED == MDBX_TXN_BLOCKED - MDBX_TXN_HAS_CHILD - MDBX_TXN_ERROR - MDBX_TXN_PARKED);
 
   struct commit_timestamp ts;
   latency_init(latency, &ts);
+  MDBX_MAYBE_UNUSED txnid_t txnid = 0;
 
   int rc = check_txn(txn, MDBX_TXN_FINISHED);
   if (unlikely(rc != MDBX_SUCCESS)) {
@@ -359,6 +515,7 @@ int mdbx_txn_commit_ex(MDBX_txn *txn, MDBX_commit_latency *latency) {
     return LOG_IFERR(rc);
   }
 
+  txnid = txn->txnid;
   if (txn->flags & MDBX_TXN_RDONLY) {
     if (unlikely(txn->parent || (txn->flags & MDBX_TXN_HAS_CHILD) || txn == env->txn || txn == env->basal_txn)) {
       ERROR("attempt to commit %s txn %p", "strange read-only", (void *)txn);
@@ -407,11 +564,13 @@ int mdbx_txn_commit_ex(MDBX_txn *txn, MDBX_commit_latency *latency) {
     }
 
     latency_gcprof(latency, txn);
-    rc = txn_nested_join(txn, latency ? &ts : nullptr);
+    rc = txn_nested_join(txn, (latency || MDBX_ENABLE_USDT) ? &ts : nullptr);
     goto done;
   }
 
-  rc = txn_basal_commit(txn, latency ? &ts : nullptr);
+  rc = txn_basal_commit(txn, (latency || MDBX_ENABLE_USDT) ? &ts : nullptr);
+  USDT_PROBE6(commit_phases, txnid, usdt_phase_ns(ts.start, ts.prep), usdt_phase_ns(ts.prep, ts.gc),
+              usdt_phase_ns(ts.gc, ts.audit), usdt_phase_ns(ts.audit, ts.write), usdt_phase_ns(ts.write, ts.sync));
   latency_gcprof(latency, txn);
   int end = TXN_END_COMMITTED | TXN_END_UPDATE;
   if (unlikely(rc != MDBX_SUCCESS)) {
@@ -421,11 +580,20 @@ int mdbx_txn_commit_ex(MDBX_txn *txn, MDBX_commit_latency *latency) {
       rc = MDBX_NOSUCCESS_PURE_COMMIT ? MDBX_RESULT_TRUE : MDBX_SUCCESS;
     }
   }
+  if (env->pageship.callback && end == (TXN_END_COMMITTED | TXN_END_UPDATE)) {
+    /* ship while the write lock is held, the txn is already committed,
+     * so a failure of shipping is reported separately and the next delta
+     * will cover this txn too */
+    env->pageship.status = pageship_commit(env);
+    if (unlikely(env->pageship.status != MDBX_SUCCESS))
+      ERROR("shipping of txn %" PRIaTXN " failed, error %d", txnid, env->pageship.status);
+  }
   int err = txn_end(txn, end);
   if (unlikely(err != MDBX_SUCCESS))
     rc = err;
 
 done:
+  USDT_PROBE3(commit, txnid, rc, usdt_ns_since(ts.start));
   latency_done(latency, &ts);
   return LOG_IFERR(rc);
 }
@@ -465,10 +633,9 @@ int mdbx_txn_info(const MDBX_txn *txn, MDBX_txn_info *info, bool scan_rlt) {
     info->txn_reader_lag = head.txnid - info->txn_id;
     info->txn_space_dirty = info->txn_space_retired = 0;
     uint64_t reader_snapshot_pages_retired = 0;
-    if (txn->ro.slot &&
-        ((txn->flags & MDBX_TXN_PARKED) == 0 || safe64_read(&txn->ro.slot->tid) != MDBX_TID_TXN_OUSTED) &&
-        head_retired >
-            (reader_snapshot_pages_retired = atomic_load64(&txn->ro.slot->snapshot_pages_retired, mo_Relaxed))) {
+    const reader_slot_t *const rslot = txn->ro.snapshot ? txn->ro.snapshot->txn->ro.slot : txn->ro.slot;
+    if (rslot && ((txn->flags & MDBX_TXN_PARKED) == 0 || safe64_read(&rslot->tid) != MDBX_TID_TXN_OUSTED) &&
+        head_retired > (reader_snapshot_pages_retired = atomic_load64(&rslot->snapshot_pages_retired, mo_Relaxed))) {
       info->txn_space_dirty = info->txn_space_retired =
           pgno2bytes(env, (pgno_t)(head_retired - reader_snapshot_pages_retired));
 
@@ -494,8 +661,8 @@ int mdbx_txn_info(const MDBX_txn *txn, MDBX_txn_info *info, bool scan_rlt) {
             }
             if (snap_txnid < next_reader && snap_tid >= MDBX_TID_TXN_OUSTED) {
               next_reader = snap_txnid;
-              retired_next_reader = pgno2bytes(
-                  env, (pgno_t)(snap_retired - atomic_load64(&txn->ro.slot->snapshot_pages_retired, mo_Relaxed)));
+              retired_next_reader =
+                  pgno2bytes(env, (pgno_t)(snap_retired - atomic_load64(&rslot->snapshot_pages_retired, mo_Relaxed)));
             }
           }
         }
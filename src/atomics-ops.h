@@ -231,6 +231,26 @@ MDBX_MAYBE_UNUSED static __always_inline uint32_t atomic_add32(mdbx_atomic_uint3
 
 #define atomic_sub32(p, v) atomic_add32(p, 0 - (v))
 
+#if MDBX_64BIT_CAS
+MDBX_MAYBE_UNUSED static __always_inline uint64_t atomic_add64(mdbx_atomic_uint64_t *p, uint64_t v) {
+#ifdef MDBX_HAVE_C11ATOMICS
+  STATIC_ASSERT(sizeof(long long) >= sizeof(uint64_t));
+  assert(atomic_is_lock_free(MDBX_c11a_rw(uint64_t, p)));
+  return atomic_fetch_add(MDBX_c11a_rw(uint64_t, p), v);
+#elif defined(__GNUC__) || defined(__clang__)
+  return __sync_fetch_and_add(&p->weak, v);
+#elif defined(_MSC_VER)
+  return (uint64_t)_InterlockedExchangeAdd64((volatile __int64 *)&p->weak, v);
+#elif defined(__APPLE__)
+  return OSAtomicAdd64Barrier(v, &p->weak);
+#else
+#error FIXME: Unsupported compiler
+#endif
+}
+
+#define atomic_sub64(p, v) atomic_add64(p, 0 - (v))
+#endif /* MDBX_64BIT_CAS */
+
 MDBX_MAYBE_UNUSED static __always_inline uint64_t safe64_txnid_next(uint64_t txnid) {
   txnid += xMDBX_TXNID_STEP;
 #if !MDBX_64BIT_CAS
@@ -12,7 +12,9 @@ typedef struct MDBX_chk_internal {
   uint8_t flags;
   bool got_break;
   bool write_locked;
+  bool concurrent;
   uint8_t scope_depth;
+  struct chk_parallel *parallel;
 
   MDBX_chk_table_t table_gc, table_main;
   int16_t *pagemap;
@@ -259,6 +261,19 @@ __cold static void MDBX_PRINTF_ARGS(2, 3) chk_scope_issue(MDBX_chk_scope_t *cons
   va_end(args);
 }
 
+__cold static void chk_scope_forget_issues(MDBX_chk_scope_t *const scope) {
+  while (scope->issues) {
+    MDBX_chk_issue_t *next = scope->issues->next;
+    osal_free(scope->issues);
+    scope->issues = next;
+  }
+}
+
+__cold static MDBX_chk_severity_t chk_scope_verbosity(const MDBX_chk_scope_t *const outer, int verbosity_adjustment) {
+  const int verbosity = outer->verbosity + (verbosity_adjustment - 1) * (1 << MDBX_chk_severity_prio_shift);
+  return (verbosity < MDBX_chk_warning) ? MDBX_chk_warning : (enum MDBX_chk_severity)verbosity;
+}
+
 __cold static int chk_scope_end(MDBX_chk_internal_t *chk, int err) {
   assert(chk->scope_depth > 0);
   MDBX_chk_scope_t *const inner = chk->scope_stack + chk->scope_depth;
@@ -284,11 +299,7 @@ __cold static int chk_scope_end(MDBX_chk_internal_t *chk, int err) {
   if (chk->cb->scope_pop)
     chk->cb->scope_pop(chk->usr, outer, inner);
 
-  while (inner->issues) {
-    MDBX_chk_issue_t *next = inner->issues->next;
-    osal_free(inner->issues);
-    inner->issues = next;
-  }
+  chk_scope_forget_issues(inner);
   memset(inner, -1, sizeof(*inner));
   return err;
 }
@@ -299,13 +310,12 @@ __cold static int chk_scope_begin_args(MDBX_chk_internal_t *chk, int verbosity_a
     return MDBX_BACKLOG_DEPLETED;
 
   MDBX_chk_scope_t *const outer = chk->scope_stack + chk->scope_depth;
-  const int verbosity = outer->verbosity + (verbosity_adjustment - 1) * (1 << MDBX_chk_severity_prio_shift);
   MDBX_chk_scope_t *const inner = outer + 1;
   memset(inner, 0, sizeof(*inner));
   inner->internal = outer->internal;
   inner->stage = stage ? stage : (stage = outer->stage);
   inner->object = object;
-  inner->verbosity = (verbosity < MDBX_chk_warning) ? MDBX_chk_warning : (enum MDBX_chk_severity)verbosity;
+  inner->verbosity = chk_scope_verbosity(outer, verbosity_adjustment);
   if (problems)
     chk->problem_counter = problems;
   else if (!chk->problem_counter || outer->stage != stage)
@@ -683,6 +693,32 @@ __cold static void chk_verbose_meta(MDBX_chk_scope_t *const scope, const unsigne
   }
 }
 
+/* Помечает страницу как используемую таблицей и возвращает идентификатор
+ * предыдущего владельца, либо 0. При параллельном обходе пара соседних
+ * элементов карты изменяется атомарно как выровненное 32-битное слово. */
+static int16_t chk_pagemap_claim(MDBX_chk_internal_t *chk, const size_t pgno, const int16_t id) {
+  if (!chk->concurrent) {
+    const int16_t prev = chk->pagemap[pgno];
+    if (!prev)
+      chk->pagemap[pgno] = id;
+    return prev;
+  }
+
+  mdbx_atomic_uint32_t *const pair = (mdbx_atomic_uint32_t *)(chk->pagemap + (pgno & ~(size_t)1));
+  for (;;) {
+    const uint32_t was = atomic_load32(pair, mo_AcquireRelease);
+    int16_t map[2];
+    memcpy(map, &was, sizeof(map));
+    if (map[pgno & 1])
+      return map[pgno & 1];
+    map[pgno & 1] = id;
+    uint32_t now;
+    memcpy(&now, map, sizeof(now));
+    if (atomic_cas32(pair, was, now))
+      return 0;
+  }
+}
+
 __cold static int chk_pgvisitor(const size_t pgno, const unsigned npages, void *const ctx, const int deep,
                                 const walk_tbl_t *tbl_info, const size_t page_size, const page_type_t pagetype,
                                 const MDBX_error_t page_err, const size_t nentries, const size_t payload_bytes,
@@ -821,15 +857,17 @@ __cold static int chk_pgvisitor(const size_t pgno, const unsigned npages, void *
         chk_object_issue(scope, "page", spanpgno, "wrong page-no", "%s-page: %" PRIuSIZE " > %" PRIuSIZE ", deep %i",
                          pagetype_caption, spanpgno, usr->result.alloc_pages, deep);
         tbl->pages.all += 1;
-      } else if (chk->pagemap[spanpgno]) {
-        const MDBX_chk_table_t *const rival = chk->table[chk->pagemap[spanpgno] - 1];
-        chk_object_issue(scope, "page", spanpgno, (branch && rival == tbl) ? "loop" : "already used",
-                         "%s-page: by %s, deep %i, parent %zu", pagetype_caption, chk_v2a(chk, &rival->name), deep,
-                         parent_pgno);
-        already_used = true;
       } else {
-        chk->pagemap[spanpgno] = (int16_t)tbl->id + 1;
-        tbl->pages.all += 1;
+        const int16_t rival_id = chk_pagemap_claim(chk, spanpgno, (int16_t)tbl->id + 1);
+        if (likely(!rival_id))
+          tbl->pages.all += 1;
+        else {
+          const MDBX_chk_table_t *const rival = chk->table[rival_id - 1];
+          chk_object_issue(scope, "page", spanpgno, (branch && rival == tbl) ? "loop" : "already used",
+                           "%s-page: by %s, deep %i, parent %zu", pagetype_caption, chk_v2a(chk, &rival->name), deep,
+                           parent_pgno);
+          already_used = true;
+        }
       }
     }
 
@@ -875,6 +913,468 @@ __cold static int chk_pgvisitor(const size_t pgno, const unsigned npages, void *
   return chk_check_break(scope);
 }
 
+//------------------------------------------------------------------------------
+
+/* Параллельная проверка при MDBX_CHK_PARALLEL.
+ *
+ * Таблицы распределяются между потоками как задания. Каждый поток использует
+ * собственные копии MDBX_chk_internal_t и MDBX_chk_context_t, а вместо
+ * функций обратного вызова приложения накапливает вывод и проблемы в журнале
+ * задания. Затем журналы воспроизводятся вызывающим потоком в исходном
+ * порядке таблиц, поэтому обратные вызовы приложения выполняются только в
+ * этом потоке и в предсказуемом порядке. */
+
+typedef struct chk_job {
+  MDBX_chk_table_t *tbl;
+  tree_t tree;
+  int deep;
+  int err, log_err;
+  /* вес задания для балансировки, ноль если обработка не требуется */
+  size_t weight;
+  MDBX_cursor *cursor;
+  const char *failed;
+  char *log;
+  size_t log_length, log_allocated;
+} chk_job_t;
+
+struct chk_worker;
+typedef int chk_job_func(struct chk_worker *worker, chk_job_t *job);
+
+typedef struct chk_parallel {
+  osal_fastmutex_t mutex;
+  MDBX_chk_internal_t *chk;
+  chk_job_func *func;
+  chk_job_t *jobs;
+  size_t count, allocated;
+  chk_job_t **queue;
+  size_t queued, next;
+  volatile bool got_break;
+} chk_parallel_t;
+
+typedef struct chk_worker {
+  MDBX_chk_internal_t chk;
+  MDBX_chk_context_t usr;
+  chk_parallel_t *shared;
+  chk_job_t *job;
+  size_t problems;
+  osal_thread_t thread;
+  int err;
+  bool primary;
+  MDBX_chk_line_t line;
+} chk_worker_t;
+
+enum chk_record_kind { chk_rec_begin, chk_rec_chars, chk_rec_flush, chk_rec_done, chk_rec_issue, chk_rec_conclude };
+
+typedef struct chk_record {
+  uint8_t kind, severity;
+  int err;
+  uint64_t entry;
+  const char *object, *caption;
+  size_t length;
+} chk_record_t;
+
+static inline size_t chk_record_bytes(size_t length) {
+  return ceil_powerof2(sizeof(chk_record_t) + length, sizeof(uint64_t));
+}
+
+static inline chk_worker_t *chk_worker(MDBX_chk_context_t *ctx) { return container_of(ctx, chk_worker_t, usr); }
+
+__cold static chk_record_t *chk_record(chk_worker_t *worker, enum chk_record_kind kind, size_t length) {
+  chk_job_t *const job = worker->job;
+  const size_t bytes = chk_record_bytes(length);
+  if (job->log_length + bytes > job->log_allocated) {
+    size_t wanna = job->log_allocated ? job->log_allocated * 2 : 4096;
+    while (wanna < job->log_length + bytes)
+      wanna += wanna;
+    char *const ptr = osal_realloc(job->log, wanna);
+    if (unlikely(!ptr)) {
+      job->log_err = MDBX_ENOMEM;
+      worker->chk.got_break = worker->shared->got_break = true;
+      return nullptr;
+    }
+    job->log = ptr;
+    job->log_allocated = wanna;
+  }
+  chk_record_t *const rec = (chk_record_t *)(job->log + job->log_length);
+  memset(rec, 0, sizeof(*rec));
+  rec->kind = (uint8_t)kind;
+  rec->length = length;
+  job->log_length += bytes;
+  return rec;
+}
+
+__cold static void chk_record_text(chk_worker_t *worker, enum chk_record_kind kind, const char *text, size_t length) {
+  chk_record_t *const rec = chk_record(worker, kind, length + 1);
+  if (likely(rec)) {
+    memcpy(rec + 1, text, length);
+    ((char *)(rec + 1))[length] = '\0';
+  }
+}
+
+__cold static bool chk_defer_break(MDBX_chk_context_t *ctx) {
+  chk_worker_t *const worker = chk_worker(ctx);
+  chk_parallel_t *const shared = worker->shared;
+  if (worker->primary && !shared->got_break) {
+    /* опрос приложения выполняется только из вызывающего потока */
+    MDBX_chk_internal_t *const chk = shared->chk;
+    if (chk->got_break || (chk->cb->check_break && chk->cb->check_break(chk->usr)))
+      chk->got_break = shared->got_break = true;
+  }
+  return shared->got_break;
+}
+
+__cold static MDBX_chk_line_t *chk_defer_begin(MDBX_chk_context_t *ctx, MDBX_chk_severity_t severity) {
+  /* не накапливаем строки, детализация которых превышает уровень контекста */
+  if (severity >= MDBX_chk_warning &&
+      (severity >> MDBX_chk_severity_prio_shift) > (ctx->scope->verbosity >> MDBX_chk_severity_prio_shift))
+    return nullptr;
+
+  chk_worker_t *const worker = chk_worker(ctx);
+  chk_record_t *const rec = chk_record(worker, chk_rec_begin, 0);
+  if (unlikely(!rec))
+    return nullptr;
+  rec->severity = (uint8_t)severity;
+  worker->line.ctx = ctx;
+  worker->line.severity = (uint8_t)severity;
+  worker->line.scope_depth = 0;
+  worker->line.empty = true;
+  /* текст строки сразу накапливается в журнале посредством chk_defer_chars() и chk_defer_format() */
+  worker->line.begin = worker->line.out = worker->line.end = nullptr;
+  return &worker->line;
+}
+
+__cold static void chk_defer_chars(MDBX_chk_line_t *line, const char *str, size_t len) {
+  chk_record_text(chk_worker(line->ctx), chk_rec_chars, str, len);
+}
+
+__cold static void chk_defer_format(MDBX_chk_line_t *line, const char *fmt, va_list args) {
+  va_list ones;
+  va_copy(ones, args);
+  const int length = vsnprintf(nullptr, 0, fmt, ones);
+  va_end(ones);
+  if (likely(length > 0)) {
+    chk_record_t *const rec = chk_record(chk_worker(line->ctx), chk_rec_chars, length + 1);
+    if (likely(rec))
+      vsnprintf((char *)(rec + 1), length + 1, fmt, args);
+  }
+}
+
+__cold static void chk_defer_flush(MDBX_chk_line_t *line) { chk_record(chk_worker(line->ctx), chk_rec_flush, 0); }
+
+__cold static void chk_defer_done(MDBX_chk_line_t *line) { chk_record(chk_worker(line->ctx), chk_rec_done, 0); }
+
+__cold static void chk_defer_issue(MDBX_chk_context_t *ctx, const char *object, uint64_t entry_number,
+                                   const char *caption, const char *extra_fmt, va_list extra_args) {
+  int length = 0;
+  if (extra_fmt) {
+    va_list ones;
+    va_copy(ones, extra_args);
+    length = vsnprintf(nullptr, 0, extra_fmt, ones);
+    va_end(ones);
+    if (unlikely(length < 0))
+      length = 0;
+  }
+  chk_record_t *const rec = chk_record(chk_worker(ctx), chk_rec_issue, extra_fmt ? length + 1 : 0);
+  if (likely(rec)) {
+    rec->object = object;
+    rec->entry = entry_number;
+    rec->caption = caption;
+    if (extra_fmt)
+      vsnprintf((char *)(rec + 1), length + 1, extra_fmt, extra_args);
+  }
+}
+
+__cold static int chk_defer_conclude(MDBX_chk_context_t *ctx, const MDBX_chk_table_t *table, MDBX_cursor *cursor,
+                                     int err) {
+  (void)table;
+  (void)cursor;
+  chk_record_t *const rec = chk_record(chk_worker(ctx), chk_rec_conclude, 0);
+  if (likely(rec))
+    rec->err = err;
+  return err;
+}
+
+static const MDBX_chk_callbacks_t chk_defer_callbacks = {.check_break = chk_defer_break,
+                                                         .issue = chk_defer_issue,
+                                                         .table_conclude = chk_defer_conclude,
+                                                         .print_begin = chk_defer_begin,
+                                                         .print_chars = chk_defer_chars,
+                                                         .print_format = chk_defer_format,
+                                                         .print_flush = chk_defer_flush,
+                                                         .print_done = chk_defer_done};
+
+/* Воспроизводит журнал задания через функции обратного вызова приложения
+ * в текущем контексте, возвращая итоговый код ошибки задания. */
+__cold static int chk_replay(MDBX_chk_internal_t *chk, const chk_job_t *job) {
+  MDBX_chk_line_t *line = nullptr;
+  int err = job->err;
+  for (size_t offset = 0; offset < job->log_length;) {
+    const chk_record_t *const rec = (const chk_record_t *)(job->log + offset);
+    const char *const text = rec->length ? (const char *)(rec + 1) : "";
+    offset += chk_record_bytes(rec->length);
+    switch (rec->kind) {
+    case chk_rec_begin:
+      chk_line_end(line);
+      line = chk_line_begin(chk->usr->scope, rec->severity);
+      break;
+    case chk_rec_chars:
+      line = chk_puts(line, text);
+      break;
+    case chk_rec_flush:
+      line = chk_flush(line);
+      break;
+    case chk_rec_done:
+      chk_line_end(line);
+      line = nullptr;
+      break;
+    case chk_rec_issue:
+      if (rec->caption)
+        chk_object_issue(chk->usr->scope, rec->object, rec->entry, rec->caption, rec->length ? "%s" : nullptr, text);
+      else
+        chk_scope_issue(chk->usr->scope, "%s", text);
+      break;
+    case chk_rec_conclude:
+      err = chk->cb->table_conclude ? chk->cb->table_conclude(chk->usr, job->tbl, job->cursor, rec->err) : rec->err;
+      break;
+    }
+  }
+  chk_line_end(line);
+  return err;
+}
+
+__cold static int chk_parallel_init(chk_parallel_t *shared, MDBX_chk_internal_t *chk, chk_job_func *func) {
+  memset(shared, 0, sizeof(*shared));
+  shared->chk = chk;
+  shared->func = func;
+  return osal_fastmutex_init(&shared->mutex);
+}
+
+__cold static void chk_parallel_destroy(chk_parallel_t *shared) {
+  for (size_t i = 0; i < shared->count; ++i)
+    osal_free(shared->jobs[i].log);
+  osal_free(shared->jobs);
+  osal_fastmutex_destroy(&shared->mutex);
+}
+
+__cold static chk_job_t *chk_job_add(chk_parallel_t *shared, MDBX_chk_table_t *tbl) {
+  if (shared->count == shared->allocated) {
+    const size_t wanna = shared->allocated ? shared->allocated * 2 : 64;
+    chk_job_t *const jobs = osal_realloc(shared->jobs, wanna * sizeof(chk_job_t));
+    if (unlikely(!jobs))
+      return nullptr;
+    shared->jobs = jobs;
+    shared->allocated = wanna;
+  }
+  chk_job_t *const job = &shared->jobs[shared->count++];
+  memset(job, 0, sizeof(*job));
+  job->tbl = tbl;
+  job->err = MDBX_EINTR /* until the job will be done */;
+  return job;
+}
+
+__cold static int chk_worker_loop(chk_worker_t *worker) {
+  chk_parallel_t *const shared = worker->shared;
+  MDBX_chk_scope_t *const scope = worker->usr.scope;
+  for (;;) {
+    chk_job_t *job = nullptr;
+    int err = osal_fastmutex_acquire(&shared->mutex);
+    if (unlikely(err != MDBX_SUCCESS))
+      return err;
+    if (shared->next < shared->queued && !shared->got_break)
+      job = shared->queue[shared->next++];
+    osal_fastmutex_release(&shared->mutex);
+    if (!job)
+      return MDBX_SUCCESS;
+
+    chk_scope_forget_issues(scope);
+    scope->subtotal_issues = 0;
+    scope->object = job->tbl;
+    worker->chk.last_nested = nullptr;
+    worker->job = job;
+    err = shared->func(worker, job);
+    job->err = job->log_err ? job->log_err : err;
+    worker->job = nullptr;
+  }
+}
+
+__cold static THREAD_RESULT THREAD_CALL chk_worker_thread(void *arg) {
+  chk_worker_t *const worker = arg;
+  worker->err = chk_worker_loop(worker);
+  return (THREAD_RESULT)0;
+}
+
+__cold static void chk_worker_init(chk_worker_t *worker, chk_parallel_t *shared, const MDBX_chk_scope_t *proto) {
+  MDBX_chk_internal_t *const chk = shared->chk;
+  worker->shared = shared;
+  worker->chk = *chk;
+  worker->chk.usr = &worker->usr;
+  worker->chk.cb = &chk_defer_callbacks;
+  worker->chk.problem_counter = &worker->problems;
+  worker->chk.got_break = false;
+  worker->chk.concurrent = true;
+  worker->chk.parallel = nullptr;
+  worker->chk.scope_depth = 0;
+  worker->chk.last_lookup = nullptr;
+  worker->chk.last_nested = nullptr;
+  worker->chk.v2a_buf.iov_base = nullptr;
+  worker->chk.v2a_buf.iov_len = 0;
+  worker->chk.scope_stack[0] = *proto;
+  worker->chk.scope_stack[0].internal = &worker->chk;
+  worker->chk.scope_stack[0].issues = nullptr;
+  worker->chk.scope_stack[0].subtotal_issues = 0;
+  worker->usr = *chk->usr;
+  worker->usr.internal = &worker->chk;
+  worker->usr.scope = worker->chk.scope_stack;
+  worker->usr.scope_nesting = 0;
+  worker->usr.result.processed_pages = 0;
+  worker->usr.result.total_payload_bytes = 0;
+}
+
+__cold static void chk_worker_fini(chk_worker_t *worker) {
+  MDBX_chk_context_t *const usr = worker->shared->chk->usr;
+  usr->result.processed_pages += worker->usr.result.processed_pages;
+  usr->result.total_payload_bytes += worker->usr.result.total_payload_bytes;
+  chk_scope_forget_issues(worker->usr.scope);
+  osal_free(worker->chk.v2a_buf.iov_base);
+}
+
+typedef chk_job_t *chk_job_ptr_t;
+/* при равенстве весов порядок заданий сохраняется, что также требуется
+ * для строгого упорядочивания, проверяемого SORT_IMPL в режиме аудита */
+#define CHK_JOB_CMP(first, last)                                                                                       \
+  ((first)->weight > (last)->weight || ((first)->weight == (last)->weight && (first) < (last)))
+SORT_IMPL(chk_job_sort, false, chk_job_ptr_t, CHK_JOB_CMP)
+
+/* Выполняет накопленные задания несколькими потоками, включая вызывающий. */
+__cold static int chk_parallel_run(chk_parallel_t *shared, const MDBX_chk_scope_t *proto) {
+  shared->queued = shared->next = 0;
+  for (size_t i = 0; i < shared->count; ++i)
+    shared->queued += shared->jobs[i].weight != 0;
+  const size_t n = (shared->queued < MDBX_ENVCHK_THREADS) ? shared->queued : MDBX_ENVCHK_THREADS;
+  if (!n)
+    return MDBX_SUCCESS;
+
+  shared->queue = osal_malloc(shared->queued * sizeof(chk_job_t *));
+  chk_worker_t *const workers = shared->queue ? osal_calloc(n, sizeof(chk_worker_t)) : nullptr;
+  if (unlikely(!workers)) {
+    osal_free(shared->queue);
+    shared->queue = nullptr;
+    return MDBX_ENOMEM;
+  }
+
+  /* the biggest tables first for better balance */
+  for (size_t i = 0, j = 0; i < shared->count; ++i)
+    if (shared->jobs[i].weight)
+      shared->queue[j++] = &shared->jobs[i];
+  chk_job_sort(shared->queue, shared->queue + shared->queued);
+
+  size_t started = 1;
+  chk_worker_init(&workers[0], shared, proto);
+  workers[0].primary = true;
+  for (; started < n; ++started) {
+    chk_worker_t *const worker = &workers[started];
+    chk_worker_init(worker, shared, proto);
+    if (osal_thread_create(&worker->thread, chk_worker_thread, worker) != MDBX_SUCCESS)
+      break;
+  }
+
+  /* the calling thread is a worker too */
+  int rc = chk_worker_loop(&workers[0]);
+  for (size_t i = 1; i < started; ++i) {
+    int err = osal_thread_join(workers[i].thread);
+    if (err == MDBX_SUCCESS)
+      err = workers[i].err;
+    if (rc == MDBX_SUCCESS)
+      rc = err;
+  }
+  for (size_t i = 0; i < started; ++i)
+    chk_worker_fini(&workers[i]);
+  osal_free(workers);
+  osal_free(shared->queue);
+  shared->queue = nullptr;
+  return rc;
+}
+
+__cold static int chk_tree_job(chk_worker_t *worker, chk_job_t *job) {
+  walk_ctx_t ctx = {.txn = worker->usr.txn,
+                    .userctx = worker->usr.scope,
+                    .visitor = chk_pgvisitor,
+                    .options = dont_check_keys_ordering | dont_walk_tables | prefetch_children,
+                    .deep = job->deep};
+  walk_tbl_t tbl = {.name = job->tbl->name, .internal = &job->tree};
+  return walk_tbl(&ctx, &tbl);
+}
+
+__cold static int chk_tree_defer(MDBX_chk_scope_t *const scope, chk_parallel_t *shared, const MDBX_val name,
+                                 const tree_t *tree, int deep) {
+  if (tree->root == P_INVALID)
+    return MDBX_SUCCESS; /* empty db */
+
+  tree_t aligned_db = *tree;
+  walk_tbl_t tbl_info = {.name = name, .internal = &aligned_db};
+  MDBX_chk_table_t *tbl;
+  int err = chk_get_tbl(scope, &tbl_info, &tbl);
+  if (unlikely(err))
+    return err;
+
+  chk_job_t *const job = chk_job_add(shared, tbl);
+  if (unlikely(!job))
+    return chk_error_rc(scope, MDBX_ENOMEM, "alloc_job");
+  job->tree = *tree;
+  job->deep = deep;
+  job->weight = 1 + (size_t)tree->branch_pages + tree->leaf_pages + tree->large_pages;
+  return MDBX_SUCCESS;
+}
+
+/* Параллельный аналог walk_pages(): GC, MainDB и каждая именованная таблица
+ * обходятся отдельными заданиями, при этом таблицы регистрируются заранее
+ * в порядке их следования в MainDB, как и при последовательном обходе. */
+__cold static int chk_tree_parallel(MDBX_chk_scope_t *const scope) {
+  MDBX_chk_internal_t *const chk = scope->internal;
+  MDBX_txn *const txn = chk->usr->txn;
+  chk_parallel_t shared;
+  int err = chk_parallel_init(&shared, chk, chk_tree_job);
+  if (unlikely(err != MDBX_SUCCESS))
+    return err;
+
+  err = chk_tree_defer(scope, &shared, (MDBX_val){.iov_base = MDBX_CHK_GC}, &txn->dbs[FREE_DBI], 0);
+  if (likely(err == MDBX_SUCCESS))
+    err = chk_tree_defer(scope, &shared, (MDBX_val){.iov_base = MDBX_CHK_MAIN}, &txn->dbs[MAIN_DBI], 0);
+  if (likely(err == MDBX_SUCCESS) && txn->dbs[MAIN_DBI].root != P_INVALID) {
+    MDBX_cursor *cursor;
+    err = mdbx_cursor_open(txn, MAIN_DBI, &cursor);
+    if (likely(err == MDBX_SUCCESS)) {
+      cursor->checking |= z_ignord | z_pagecheck;
+      MDBX_val key, data;
+      err = mdbx_cursor_get(cursor, &key, &data, MDBX_FIRST);
+      while (err == MDBX_SUCCESS) {
+        const node_t *const node = page_node(cursor->pg[cursor->top], cursor->ki[cursor->top]);
+        if (node_flags(node) == N_TREE && data.iov_len == sizeof(tree_t)) {
+          tree_t aligned_db;
+          memcpy(&aligned_db, data.iov_base, sizeof(aligned_db));
+          err = chk_tree_defer(scope, &shared, key, &aligned_db, txn->dbs[MAIN_DBI].height);
+          if (unlikely(err != MDBX_SUCCESS))
+            break;
+        }
+        err = mdbx_cursor_get(cursor, &key, &data, MDBX_NEXT);
+      }
+      if (err == MDBX_NOTFOUND)
+        err = MDBX_SUCCESS;
+      mdbx_cursor_close(cursor);
+    }
+  }
+
+  if (likely(err == MDBX_SUCCESS))
+    err = chk_parallel_run(&shared, chk->usr->scope);
+  for (size_t i = 0; i < shared.count; ++i) {
+    const int job_err = chk_replay(chk, &shared.jobs[i]);
+    if (err == MDBX_SUCCESS)
+      err = job_err;
+  }
+  chk_parallel_destroy(&shared);
+  return err;
+}
+
 __cold static int chk_tree(MDBX_chk_scope_t *const scope) {
   MDBX_chk_internal_t *const chk = scope->internal;
   MDBX_chk_context_t *const usr = chk->usr;
@@ -886,7 +1386,8 @@ __cold static int chk_tree(MDBX_chk_scope_t *const scope) {
 #else
   errno = 0;
 #endif /* Windows */
-  chk->pagemap = osal_calloc(usr->result.alloc_pages, sizeof(*chk->pagemap));
+  /* +1 для выравнивания пар элементов при параллельном обходе */
+  chk->pagemap = osal_calloc(usr->result.alloc_pages + 1, sizeof(*chk->pagemap));
   if (!chk->pagemap) {
     int err = osal_get_errno();
     return chk_error_rc(scope, err ? err : MDBX_ENOMEM, "calloc");
@@ -897,7 +1398,9 @@ __cold static int chk_tree(MDBX_chk_scope_t *const scope) {
   /* always skip key ordering checking
    * to avoid MDBX_CORRUPTED in case custom comparators were used */
   usr->result.processed_pages = NUM_METAS;
-  int err = walk_pages(txn, chk_pgvisitor, scope, dont_check_keys_ordering);
+  int err = (chk->flags & MDBX_CHK_PARALLEL) && MDBX_ENVCHK_THREADS > 1
+                ? chk_tree_parallel(scope)
+                : walk_pages(txn, chk_pgvisitor, scope, dont_check_keys_ordering | prefetch_children);
   if (MDBX_IS_ERROR(err) && err != MDBX_EINTR)
     chk_error_rc(scope, err, "walk_pages");
 
@@ -1018,33 +1521,122 @@ __cold static int chk_handle_kv(MDBX_chk_scope_t *const scope, MDBX_chk_table_t
   return err ? err : chk_check_break(scope);
 }
 
-__cold static int chk_db(MDBX_chk_scope_t *const scope, MDBX_dbi dbi, MDBX_chk_table_t *tbl, chk_kv_visitor *handler) {
+__cold static int chk_db_walk(MDBX_chk_scope_t *const scope, MDBX_cursor *cursor, MDBX_chk_table_t *tbl,
+                              chk_kv_visitor *handler);
+__cold static int chk_db(MDBX_chk_scope_t *const scope, MDBX_dbi dbi, MDBX_chk_table_t *tbl, chk_kv_visitor *handler);
+
+__cold static int chk_db_open(MDBX_chk_internal_t *chk, MDBX_chk_table_t *tbl, MDBX_dbi *dbi) {
+  return dbi_open(chk->usr->txn, &tbl->name, MDBX_DB_ACCEDE, dbi,
+                  (chk->flags & MDBX_CHK_IGNORE_ORDER) ? cmp_equal_or_greater : nullptr,
+                  (chk->flags & MDBX_CHK_IGNORE_ORDER) ? cmp_equal_or_greater : nullptr);
+}
+
+__cold static int chk_cursor_open(MDBX_chk_internal_t *chk, MDBX_dbi dbi, MDBX_cursor **cursor) {
+  int err = mdbx_cursor_open(chk->usr->txn, dbi, cursor);
+  if (likely(err == MDBX_SUCCESS) && (chk->flags & MDBX_CHK_IGNORE_ORDER)) {
+    (*cursor)->checking |= z_ignord | z_pagecheck;
+    if ((*cursor)->subcur)
+      (*cursor)->subcur->cursor.checking |= z_ignord | z_pagecheck;
+  }
+  return err;
+}
+
+__cold static void chk_db_close(MDBX_cursor *cursor) {
+  MDBX_txn *const txn = cursor->txn;
+  const size_t dbi = cursor_dbi(cursor);
+  mdbx_cursor_close(cursor);
+  if (!txn->cursors[dbi] && (txn->dbi_state[dbi] & DBI_FRESH))
+    mdbx_dbi_close(txn->env, (MDBX_dbi)dbi);
+}
+
+__cold static int chk_kv_job(chk_worker_t *worker, chk_job_t *job) {
+  return chk_db_walk(worker->usr.scope, job->cursor, job->tbl, chk_handle_kv);
+}
+
+/* Обрабатывает отложенные таблицы и воспроизводит их журналы по порядку. */
+__cold static int chk_tables_flush(MDBX_chk_scope_t *const scope) {
   MDBX_chk_internal_t *const chk = scope->internal;
   MDBX_chk_context_t *const usr = chk->usr;
-  MDBX_env *const env = usr->env;
-  MDBX_txn *const txn = usr->txn;
-  MDBX_cursor *cursor = nullptr;
-  size_t record_count = 0, dups = 0, sub_databases = 0;
-  int err;
+  chk_parallel_t *const shared = chk->parallel;
+
+  MDBX_chk_scope_t proto = *scope;
+  proto.verbosity = chk_scope_verbosity(scope, 0);
+  proto.stage = MDBX_chk_tables;
+  int err = chk_parallel_run(shared, &proto);
+  for (size_t i = 0; i < shared->count; ++i) {
+    chk_job_t *const job = &shared->jobs[i];
+    if (err == MDBX_SUCCESS) {
+      if (!job->tbl->cookie)
+        chk_line_end(chk_flush(chk_print(chk_line_begin(scope, MDBX_chk_processing), "Skip processing %s...",
+                                         chk_v2a(chk, &job->tbl->name))));
+      else {
+        err = chk_scope_begin(chk, 0, MDBX_chk_tables, job->tbl, &usr->result.problems_kv, "Processing table %s...",
+                              chk_v2a(chk, &job->tbl->name));
+        if (likely(!err)) {
+          err = job->failed ? chk_error_rc(usr->scope, job->err, job->failed) : chk_replay(chk, job);
+          if (err != MDBX_EINTR && err != MDBX_RESULT_TRUE)
+            usr->result.table_processed += 1;
+        }
+        err = chk_scope_restore(scope, err);
+      }
+    }
+    if (job->cursor)
+      chk_db_close(job->cursor);
+    osal_free(job->log);
+  }
+  shared->count = 0;
+  return err;
+}
 
-  if ((MDBX_TXN_FINISHED | MDBX_TXN_ERROR) & txn->flags) {
-    chk_line_end(chk_flush(chk_print(chk_line_begin(scope, MDBX_chk_error),
-                                     "abort processing %s due to a previous error", chk_v2a(chk, &tbl->name))));
-    err = MDBX_BAD_TXN;
-    goto bailout;
+/* Откладывает обработку таблицы, заранее открывая её dbi-дескриптор и курсор
+ * в вызывающем потоке. */
+__cold static int chk_tables_defer(MDBX_chk_scope_t *const scope, MDBX_chk_table_t *tbl) {
+  MDBX_chk_internal_t *const chk = scope->internal;
+  chk_parallel_t *const shared = chk->parallel;
+  MDBX_dbi dbi = 0;
+  int err = MDBX_SUCCESS;
+  if (tbl->cookie) {
+    err = chk_db_open(chk, tbl, &dbi);
+    if (err == MDBX_DBS_FULL && shared->count) {
+      /* все слоты заняты ранее отложенными таблицами, сначала обрабатываем их */
+      err = chk_tables_flush(scope);
+      if (unlikely(err))
+        return err;
+      err = chk_db_open(chk, tbl, &dbi);
+    }
   }
 
-  if (0 > (int)dbi) {
-    err = dbi_open(txn, &tbl->name, MDBX_DB_ACCEDE, &dbi,
-                   (chk->flags & MDBX_CHK_IGNORE_ORDER) ? cmp_equal_or_greater : nullptr,
-                   (chk->flags & MDBX_CHK_IGNORE_ORDER) ? cmp_equal_or_greater : nullptr);
+  chk_job_t *const job = chk_job_add(shared, tbl);
+  if (unlikely(!job))
+    return chk_error_rc(scope, MDBX_ENOMEM, "alloc_job");
+  if (tbl->cookie) {
     if (unlikely(err)) {
-      tASSERT(txn, dbi >= txn->env->n_dbi || (txn->env->dbs_flags[dbi] & DB_VALID) == 0);
-      chk_error_rc(scope, err, "mdbx_dbi_open");
-      goto bailout;
+      job->err = err;
+      job->failed = "mdbx_dbi_open";
+    } else {
+      err = chk_cursor_open(chk, dbi, &job->cursor);
+      if (unlikely(err)) {
+        job->cursor = nullptr;
+        job->err = err;
+        job->failed = "mdbx_cursor_open";
+      } else {
+        const tree_t *const db = chk->usr->txn->dbs + dbi;
+        job->weight = 1 + (size_t)db->branch_pages + db->leaf_pages + db->large_pages;
+      }
     }
-    tASSERT(txn, dbi < txn->env->n_dbi && (txn->env->dbs_flags[dbi] & DB_VALID) != 0);
   }
+  return MDBX_SUCCESS;
+}
+
+__cold static int chk_db_walk(MDBX_chk_scope_t *const scope, MDBX_cursor *cursor, MDBX_chk_table_t *tbl,
+                              chk_kv_visitor *handler) {
+  MDBX_chk_internal_t *const chk = scope->internal;
+  MDBX_chk_context_t *const usr = chk->usr;
+  MDBX_env *const env = usr->env;
+  MDBX_txn *const txn = usr->txn;
+  const MDBX_dbi dbi = (MDBX_dbi)cursor_dbi(cursor);
+  size_t record_count = 0, dups = 0, sub_databases = 0;
+  int err;
 
   const tree_t *const db = txn->dbs + dbi;
   if (handler) {
@@ -1144,22 +1736,13 @@ __cold static int chk_db(MDBX_chk_scope_t *const scope, MDBX_dbi dbi, MDBX_chk_t
     }
   }
 
-  err = mdbx_cursor_open(txn, dbi, &cursor);
-  if (unlikely(err)) {
-    chk_error_rc(scope, err, "mdbx_cursor_open");
-    goto bailout;
-  }
-  if (chk->flags & MDBX_CHK_IGNORE_ORDER) {
-    cursor->checking |= z_ignord | z_pagecheck;
-    if (cursor->subcur)
-      cursor->subcur->cursor.checking |= z_ignord | z_pagecheck;
-  }
-
   const size_t maxkeysize = mdbx_env_get_maxkeysize_ex(env, tbl->flags);
   MDBX_val prev_key = {nullptr, 0}, prev_data = {nullptr, 0};
   MDBX_val key, data;
   size_t dups_count = 0;
-  err = mdbx_cursor_get(cursor, &key, &data, MDBX_FIRST);
+  /* без проверки владельца транзакции, так как может выполняться
+   * вспомогательным потоком при MDBX_CHK_PARALLEL */
+  err = cursor_ops(cursor, &key, &data, MDBX_FIRST);
   while (err == MDBX_SUCCESS) {
     err = chk_check_break(scope);
     if (unlikely(err))
@@ -1250,7 +1833,11 @@ __cold static int chk_db(MDBX_chk_scope_t *const scope, MDBX_dbi dbi, MDBX_chk_t
         err = chk_get_tbl(scope, &tbl_info, &table);
         if (unlikely(err))
           goto bailout;
-        if (table->cookie) {
+        if (chk->parallel) {
+          err = chk_tables_defer(scope, table);
+          if (unlikely(err))
+            goto bailout;
+        } else if (table->cookie) {
           err = chk_scope_begin(chk, 0, MDBX_chk_tables, table, &usr->result.problems_kv, "Processing table %s...",
                                 chk_v2a(chk, &table->name));
           if (likely(!err)) {
@@ -1271,7 +1858,7 @@ __cold static int chk_db(MDBX_chk_scope_t *const scope, MDBX_dbi dbi, MDBX_chk_t
         goto bailout;
     }
 
-    err = mdbx_cursor_get(cursor, &key, &data, MDBX_NEXT);
+    err = cursor_ops(cursor, &key, &data, MDBX_NEXT);
   }
 
   if (prev_key.iov_base)
@@ -1281,47 +1868,85 @@ __cold static int chk_db(MDBX_chk_scope_t *const scope, MDBX_dbi dbi, MDBX_chk_t
   if (err == MDBX_SUCCESS && record_count != db->items)
     chk_scope_issue(scope, "different number of entries %" PRIuSIZE " != %" PRIu64, record_count, db->items);
 bailout:
-  if (cursor) {
-    if (handler) {
-      if (record_count) {
-        MDBX_chk_line_t *line = chk_line_begin(scope, MDBX_chk_info);
-        line = histogram_dist(line, &tbl->histogram.key_len, "key length density", "0/1", false);
+  if (handler) {
+    if (record_count) {
+      MDBX_chk_line_t *line = chk_line_begin(scope, MDBX_chk_info);
+      line = histogram_dist(line, &tbl->histogram.key_len, "key length density", "0/1", false);
+      chk_line_feed(line);
+      line = histogram_dist(line, &tbl->histogram.val_len, "value length density", "0/1", false);
+      if (tbl->histogram.multival.amount) {
         chk_line_feed(line);
-        line = histogram_dist(line, &tbl->histogram.val_len, "value length density", "0/1", false);
-        if (tbl->histogram.multival.amount) {
-          chk_line_feed(line);
-          line = histogram_dist(line, &tbl->histogram.multival, "number of multi-values density", "single", false);
-          chk_line_feed(line);
-          line = chk_print(line, "number of keys %" PRIuSIZE ", average values per key %.1f",
-                           tbl->histogram.multival.count, record_count / (double)tbl->histogram.multival.count);
-        }
-        chk_line_end(line);
+        line = histogram_dist(line, &tbl->histogram.multival, "number of multi-values density", "single", false);
+        chk_line_feed(line);
+        line = chk_print(line, "number of keys %" PRIuSIZE ", average values per key %.1f",
+                         tbl->histogram.multival.count, record_count / (double)tbl->histogram.multival.count);
       }
-      if (scope->stage == MDBX_chk_maindb)
-        usr->result.table_total = sub_databases;
-      if (chk->cb->table_conclude)
-        err = chk->cb->table_conclude(usr, tbl, cursor, err);
-      MDBX_chk_line_t *line = chk_line_begin(scope, MDBX_chk_resolution);
-      line = chk_print(line, "summary: %" PRIuSIZE " records,", record_count);
-      if (dups || (tbl->flags & (MDBX_DUPSORT | MDBX_DUPFIXED | MDBX_REVERSEDUP | MDBX_INTEGERDUP)))
-        line = chk_print(line, " %" PRIuSIZE " dups,", dups);
-      if (sub_databases || dbi == MAIN_DBI)
-        line = chk_print(line, " %" PRIuSIZE " tables,", sub_databases);
-      line = chk_print(line,
-                       " %" PRIuSIZE " key's bytes,"
-                       " %" PRIuSIZE " data's bytes,"
-                       " %" PRIuSIZE " problem(s)",
-                       tbl->histogram.key_len.amount, tbl->histogram.val_len.amount, scope->subtotal_issues);
-      chk_line_end(chk_flush(line));
+      chk_line_end(line);
     }
+    if (scope->stage == MDBX_chk_maindb)
+      usr->result.table_total = sub_databases;
+    if (chk->cb->table_conclude)
+      err = chk->cb->table_conclude(usr, tbl, cursor, err);
+    MDBX_chk_line_t *line = chk_line_begin(scope, MDBX_chk_resolution);
+    line = chk_print(line, "summary: %" PRIuSIZE " records,", record_count);
+    if (dups || (tbl->flags & (MDBX_DUPSORT | MDBX_DUPFIXED | MDBX_REVERSEDUP | MDBX_INTEGERDUP)))
+      line = chk_print(line, " %" PRIuSIZE " dups,", dups);
+    if (sub_databases || dbi == MAIN_DBI)
+      line = chk_print(line, " %" PRIuSIZE " tables,", sub_databases);
+    line = chk_print(line,
+                     " %" PRIuSIZE " key's bytes,"
+                     " %" PRIuSIZE " data's bytes,"
+                     " %" PRIuSIZE " problem(s)",
+                     tbl->histogram.key_len.amount, tbl->histogram.val_len.amount, scope->subtotal_issues);
+    chk_line_end(chk_flush(line));
+  }
+  return err;
+}
 
-    mdbx_cursor_close(cursor);
-    if (!txn->cursors[dbi] && (txn->dbi_state[dbi] & DBI_FRESH))
-      mdbx_dbi_close(env, dbi);
+__cold static int chk_db(MDBX_chk_scope_t *const scope, MDBX_dbi dbi, MDBX_chk_table_t *tbl, chk_kv_visitor *handler) {
+  MDBX_chk_internal_t *const chk = scope->internal;
+  MDBX_txn *const txn = chk->usr->txn;
+  if ((MDBX_TXN_FINISHED | MDBX_TXN_ERROR) & txn->flags) {
+    chk_line_end(chk_flush(chk_print(chk_line_begin(scope, MDBX_chk_error),
+                                     "abort processing %s due to a previous error", chk_v2a(chk, &tbl->name))));
+    return MDBX_BAD_TXN;
   }
+
+  int err;
+  if (0 > (int)dbi) {
+    err = chk_db_open(chk, tbl, &dbi);
+    if (unlikely(err)) {
+      tASSERT(txn, dbi >= txn->env->n_dbi || (txn->env->dbs_flags[dbi] & DB_VALID) == 0);
+      return chk_error_rc(scope, err, "mdbx_dbi_open");
+    }
+    tASSERT(txn, dbi < txn->env->n_dbi && (txn->env->dbs_flags[dbi] & DB_VALID) != 0);
+  }
+
+  MDBX_cursor *cursor;
+  err = chk_cursor_open(chk, dbi, &cursor);
+  if (unlikely(err))
+    return chk_error_rc(scope, err, "mdbx_cursor_open");
+  err = chk_db_walk(scope, cursor, tbl, handler);
+  chk_db_close(cursor);
   return err;
 }
 
+
+__cold static int chk_tables_parallel(MDBX_chk_scope_t *const scope) {
+  MDBX_chk_internal_t *const chk = scope->internal;
+  chk_parallel_t shared;
+  int err = chk_parallel_init(&shared, chk, chk_kv_job);
+  if (unlikely(err != MDBX_SUCCESS))
+    return chk_error_rc(scope, err, "osal_fastmutex_init");
+
+  chk->parallel = &shared;
+  err = chk_db(scope, MAIN_DBI, &chk->table_main, nullptr);
+  const int rc = chk_tables_flush(scope);
+  chk->parallel = nullptr;
+  chk_parallel_destroy(&shared);
+  return err ? err : rc;
+}
+
 __cold static int chk_handle_gc(MDBX_chk_scope_t *const scope, MDBX_chk_table_t *tbl, const size_t record_number,
                                 const MDBX_val *key, const MDBX_val *data) {
   MDBX_chk_internal_t *const chk = scope->internal;
@@ -1737,7 +2362,9 @@ __cold static int env_chk(MDBX_chk_scope_t *const scope) {
       err = chk_scope_begin(chk, 1, MDBX_chk_tables, nullptr, &usr->result.problems_kv,
                             "Processing %s by txn#%" PRIaTXN "...", subj_tables, txn->txnid);
       if (!err)
-        err = chk_db(usr->scope, MAIN_DBI, &chk->table_main, nullptr);
+        err = ((chk->flags & MDBX_CHK_PARALLEL) && MDBX_ENVCHK_THREADS > 1 && !chk->cb->table_handle_kv)
+                  ? chk_tables_parallel(usr->scope)
+                  : chk_db(usr->scope, MAIN_DBI, &chk->table_main, nullptr);
       if (usr->scope->subtotal_issues)
         chk_line_end(chk_print(chk_line_begin(usr->scope, MDBX_chk_resolution),
                                "processed %" PRIuSIZE " of %" PRIuSIZE " %s, %" PRIuSIZE " problems(s)",
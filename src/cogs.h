@@ -486,7 +486,8 @@ static __always_inline int check_txn(const MDBX_txn *txn, int bad_bits) {
     }
   }
 
-  tASSERT(txn, (txn->flags & MDBX_TXN_FINISHED) ||
+  /* владелец разделяемого снимка не привязан к потокам независимо от режима среды */
+  tASSERT(txn, (txn->flags & (MDBX_TXN_FINISHED | txn_snapshot_holder)) ||
                    (txn->flags & MDBX_NOSTICKYTHREADS) == (txn->env->flags & MDBX_NOSTICKYTHREADS));
 #if MDBX_TXN_CHECKOWNER
   if ((txn->flags & (MDBX_NOSTICKYTHREADS | MDBX_TXN_FINISHED)) != MDBX_NOSTICKYTHREADS &&
@@ -94,6 +94,7 @@ __cold int coherency_timeout(uint64_t *timestamp, intptr_t pgno, const MDBX_env
   if (likely(timestamp && *timestamp == 0))
     *timestamp = osal_monotime();
   else if (unlikely(!timestamp || osal_monotime() - *timestamp > osal_16dot16_to_monotime(65536 / 10))) {
+    USDT_PROBE3(coherency_timeout, pgno, timestamp ? usdt_ns_since(*timestamp) : 0, MDBX_PROBLEM);
     if (pgno >= 0 && pgno != env->stuck_meta)
       ERROR("bailout waiting for %" PRIuSIZE " page arrival %s", pgno,
             "(workaround for incoherent flaw of unified page/buffer cache)");
@@ -102,6 +103,7 @@ __cold int coherency_timeout(uint64_t *timestamp, intptr_t pgno, const MDBX_env
     return MDBX_PROBLEM;
   }
 
+  USDT_PROBE3(coherency_timeout, pgno, usdt_ns_since(*timestamp), MDBX_RESULT_TRUE);
   osal_memory_fence(mo_AcquireRelease, true);
   osal_yield();
   return MDBX_RESULT_TRUE;
@@ -262,6 +262,31 @@ MDBX_MAYBE_UNUSED MDBX_NOTHROW_PURE_FUNCTION static inline bool cursor_is_core(c
   return mc->dbi_state < mc->txn->dbi_state + CORE_DBS;
 }
 
+#if MDBX_ENABLE_DBI_OPSTAT
+MDBX_MAYBE_UNUSED MDBX_NOTHROW_PURE_FUNCTION static inline dbi_opstat_t *cursor_opstat(const MDBX_cursor *mc) {
+  return mc->txn->env->dbi_opstat + cursor_dbi(mc);
+}
+
+MDBX_MAYBE_UNUSED static inline void opstat_add(mdbx_atomic_uint64_t *counter, uint64_t n) {
+#if MDBX_64BIT_CAS
+  atomic_add64(counter, n);
+#else
+  /* Без 64-битных атомарных RMW-операций инкременты из параллельных потоков
+   * могут теряться, но значение счетчика не разрушается. */
+  atomic_store64(counter, atomic_load64(counter, mo_Relaxed) + n, mo_Relaxed);
+#endif /* MDBX_64BIT_CAS */
+}
+
+MDBX_MAYBE_UNUSED static inline uint64_t opstat_fetch(mdbx_atomic_uint64_t *counter, bool reset) {
+  const uint64_t value = atomic_load64(counter, mo_Relaxed);
+  /* Вместо обнуления вычитаем прочитанное значение, чтобы не потерять
+   * инкременты выполненные параллельно после чтения. */
+  if (reset && value)
+    opstat_add(counter, 0 - value);
+  return value;
+}
+#endif /* MDBX_ENABLE_DBI_OPSTAT */
+
 MDBX_MAYBE_UNUSED static inline int cursor_dbi_dbg(const MDBX_cursor *mc) {
   /* Debugging output value of a cursor's DBI: Negative for a sub-cursor. */
   const int dbi = cursor_dbi(mc);
@@ -21,6 +21,131 @@ size_t dbi_bitmap_ctz_fallback(const MDBX_txn *txn, intptr_t bmi) {
 }
 #endif /* MDBX_ENABLE_DBI_SPARSE */
 
+/*----------------------------------------------------------------------------*/
+/* Хэш-индекс имён открытых таблиц (открытая адресация, линейное пробирование).
+ *
+ * Индекс изменяется только под env->dbi_lock, но читается без блокировки при
+ * открытии хендлов в dbi_open(). Поэтому найденный через индекс хендл всегда
+ * перепроверяется, а промах приводит к повторному поиску под блокировкой.
+ * Индекс используется только при побайтовом сравнении имён в MainDB, иначе
+ * выполняется прежний линейный поиск посредством компаратора MainDB. */
+
+#define DBI_HASH_EMPTY FREE_DBI
+#define DBI_HASH_DELETED MAIN_DBI
+
+static uint32_t dbi_hash_name(const MDBX_val *name) {
+  const uint8_t *ptr = name->iov_base;
+  size_t left = name->iov_len;
+  uint64_t hash = left;
+  while (left >= 8) {
+    uint64_t word;
+    memcpy(&word, ptr, 8);
+    hash = rrxmrrxmsx_0(hash ^ word);
+    ptr += 8;
+    left -= 8;
+  }
+  uint64_t tail = 0;
+  if (left)
+    memcpy(&tail, ptr, left);
+  return (uint32_t)rrxmrrxmsx_0(hash ^ tail);
+}
+
+static inline bool dbi_hash_bytewise(const MDBX_env *env) {
+  MDBX_cmp_func *const cmp = env->kvs[MAIN_DBI].clc.k.cmp;
+  return cmp == cmp_lexical || cmp == cmp_reverse;
+}
+
+static inline bool dbi_name_eq(const MDBX_val *a, const MDBX_val *b) {
+  return a->iov_len == b->iov_len && memcmp(a->iov_base, b->iov_base, a->iov_len) == 0;
+}
+
+size_t dbi_hash_bytes(const MDBX_dbi max_dbi) {
+  size_t capacity = 8;
+  while (capacity < (size_t)max_dbi * 2)
+    capacity <<= 1;
+  return capacity * sizeof(mdbx_atomic_uint32_t);
+}
+
+static void dbi_hash_rebuild(MDBX_env *env);
+
+/* Добавляет в индекс хендл, имя которого уже установлено в env->kvs[]. */
+static void dbi_hash_insert(MDBX_env *env, const size_t dbi) {
+  eASSERT(env, dbi >= CORE_DBS && dbi < env->n_dbi && env->kvs[dbi].name.iov_base);
+  const uint32_t mask = env->dbi_hash_mask;
+  if (unlikely(env->dbi_hash_deleted > (mask + 1) / 4)) {
+    /* слишком много "надгробий", перестраиваем индекс включая dbi */
+    dbi_hash_rebuild(env);
+    return;
+  }
+
+  for (size_t i = dbi_hash_name(&env->kvs[dbi].name);; ++i) {
+    const uint32_t entry = env->dbi_hash[i & mask].weak;
+    eASSERT(env, entry != dbi);
+    if (entry == DBI_HASH_EMPTY || entry == DBI_HASH_DELETED) {
+      env->dbi_hash_deleted -= entry == DBI_HASH_DELETED;
+      atomic_store32(&env->dbi_hash[i & mask], (uint32_t)dbi, mo_AcquireRelease);
+      return;
+    }
+  }
+}
+
+static void dbi_hash_rebuild(MDBX_env *env) {
+  for (size_t i = 0; i <= env->dbi_hash_mask; ++i)
+    atomic_store32(&env->dbi_hash[i], DBI_HASH_EMPTY, mo_AcquireRelease);
+  env->dbi_hash_deleted = 0;
+  for (size_t dbi = CORE_DBS; dbi < env->n_dbi; ++dbi)
+    if (env->kvs[dbi].name.iov_base)
+      dbi_hash_insert(env, dbi);
+}
+
+/* Удаляет хендл из индекса, имя передаётся явно так как в env->kvs[]
+ * оно уже может быть сброшено или заменено. */
+static void dbi_hash_remove(MDBX_env *env, const size_t dbi, const MDBX_val *name) {
+  const uint32_t mask = env->dbi_hash_mask;
+  size_t i = dbi_hash_name(name);
+  for (size_t n = 0; n <= mask; ++n, ++i) {
+    const uint32_t entry = env->dbi_hash[i & mask].weak;
+    if (entry == dbi) {
+      atomic_store32(&env->dbi_hash[i & mask], DBI_HASH_DELETED, mo_AcquireRelease);
+      env->dbi_hash_deleted += 1;
+      return;
+    }
+    if (entry == DBI_HASH_EMPTY)
+      break;
+  }
+  eASSERT(env, !"dbi is missing in the hash-index");
+}
+
+static size_t dbi_hash_lookup(const MDBX_env *env, const MDBX_val *name) {
+  const uint32_t mask = env->dbi_hash_mask;
+  size_t i = dbi_hash_name(name);
+  for (size_t n = 0; n <= mask; ++n, ++i) {
+    const uint32_t entry = atomic_load32(&env->dbi_hash[i & mask], mo_AcquireRelease);
+    if (entry == DBI_HASH_EMPTY)
+      break;
+    if (entry != DBI_HASH_DELETED && entry < env->n_dbi) {
+      const MDBX_val candidate = env->kvs[entry].name;
+      if (candidate.iov_base && dbi_name_eq(name, &candidate))
+        return entry;
+    }
+  }
+  return 0;
+}
+
+size_t dbi_lookup(const MDBX_env *env, const MDBX_val *name) {
+  if (likely(dbi_hash_bytewise(env))) {
+    const size_t dbi = dbi_hash_lookup(env, name);
+    return (dbi && (env->dbs_flags[dbi] & DB_VALID)) ? dbi : 0;
+  }
+
+  for (size_t dbi = CORE_DBS; dbi < env->n_dbi; ++dbi)
+    if ((env->dbs_flags[dbi] & DB_VALID) && env->kvs[MAIN_DBI].clc.k.cmp(name, &env->kvs[dbi].name) == 0)
+      return dbi;
+  return 0;
+}
+
+/*----------------------------------------------------------------------------*/
+
 struct dbi_snap_result dbi_snap(const MDBX_env *env, const size_t dbi) {
   eASSERT(env, dbi < env->n_dbi);
   struct dbi_snap_result r;
@@ -131,6 +256,13 @@ __noinline int dbi_import(MDBX_txn *txn, const size_t dbi) {
   return MDBX_BAD_DBI;
 }
 
+/* Слот освобождается или становится невалидным, поэтому поиск свободного
+ * слота должен начинаться не дальше него. */
+static inline void dbi_slot_vacated(MDBX_env *env, size_t dbi) {
+  if (env->dbi_free_hint > dbi)
+    env->dbi_free_hint = (unsigned)dbi;
+}
+
 int dbi_defer_release(MDBX_env *const env, defer_free_item_t *const chain) {
   size_t length = 0;
   defer_free_item_t *obsolete_chain = nullptr;
@@ -201,9 +333,12 @@ int dbi_update(MDBX_txn *txn, bool keep) {
       uint32_t seq = dbi_seq_next(env, dbi);
       defer_free_item_t *item = env->kvs[dbi].name.iov_base;
       if (item) {
+        const MDBX_val name = env->kvs[dbi].name;
         env->dbs_flags[dbi] = 0;
+        dbi_slot_vacated(env, dbi);
         env->kvs[dbi].name.iov_len = 0;
         env->kvs[dbi].name.iov_base = nullptr;
+        dbi_hash_remove(env, dbi, &name);
         atomic_store32(&env->dbi_seqs[dbi], seq, mo_AcquireRelease);
         osal_flush_incoherent_cpu_writeback();
         item->next = defer_chain;
@@ -289,6 +424,7 @@ int dbi_bind(MDBX_txn *txn, const size_t dbi, unsigned user_flags, MDBX_cmp_func
       txn->dbs[dbi].flags = db_flags;
       txn->dbs[dbi].dupfix_size = 0;
       if (unlikely(tbl_setup(env, &env->kvs[dbi], &txn->dbs[dbi]))) {
+        dbi_slot_vacated(txn->env, dbi);
         txn->dbi_state[dbi] = DBI_LINDO;
         txn->flags |= MDBX_TXN_ERROR;
         return MDBX_PROBLEM;
@@ -368,33 +504,30 @@ static int dbi_open_locked(MDBX_txn *txn, unsigned user_flags, MDBX_dbi *dbi, MD
   tASSERT(txn, env->kvs[MAIN_DBI].clc.k.cmp);
 
   /* Is the DB already open? */
-  size_t slot = env->n_dbi;
-  for (size_t scan = CORE_DBS; scan < env->n_dbi; ++scan) {
-    if ((env->dbs_flags[scan] & DB_VALID) == 0) {
-      /* Remember this free slot */
-      slot = (slot < scan) ? slot : scan;
-      continue;
+  size_t slot = dbi_lookup(env, &name);
+  if (slot) {
+    int err = dbi_check(txn, slot);
+    if (err == MDBX_BAD_DBI && txn->dbi_state[slot] == (DBI_OLDEN | DBI_LINDO)) {
+      /* хендл использовался, стал невалидным,
+       * но теперь явно пере-открывается в этой транзакци */
+      eASSERT(env, !txn->cursors[slot]);
+      txn->dbi_state[slot] = DBI_LINDO;
+      err = dbi_check(txn, slot);
     }
-    if (env->kvs[MAIN_DBI].clc.k.cmp(&name, &env->kvs[scan].name) == 0) {
-      slot = scan;
-      int err = dbi_check(txn, slot);
-      if (err == MDBX_BAD_DBI && txn->dbi_state[slot] == (DBI_OLDEN | DBI_LINDO)) {
-        /* хендл использовался, стал невалидным,
-         * но теперь явно пере-открывается в этой транзакци */
-        eASSERT(env, !txn->cursors[slot]);
-        txn->dbi_state[slot] = DBI_LINDO;
-        err = dbi_check(txn, slot);
-      }
-      if (err == MDBX_SUCCESS) {
-        err = dbi_bind(txn, slot, user_flags, keycmp, datacmp);
-        if (likely(err == MDBX_SUCCESS)) {
-          goto done;
-        }
+    if (err == MDBX_SUCCESS) {
+      err = dbi_bind(txn, slot, user_flags, keycmp, datacmp);
+      if (likely(err == MDBX_SUCCESS)) {
+        goto done;
       }
-      return err;
     }
+    return err;
   }
 
+  /* Find a free slot, all ones below the hint are in use */
+  eASSERT(env, env->dbi_free_hint >= CORE_DBS && env->dbi_free_hint <= env->n_dbi);
+  for (slot = env->dbi_free_hint; slot < env->n_dbi && (env->dbs_flags[slot] & DB_VALID); ++slot)
+    ;
+
   /* Fail, if no free slot and max hit */
   if (unlikely(slot >= env->max_dbi))
     return MDBX_DBS_FULL;
@@ -405,6 +538,9 @@ static int dbi_open_locked(MDBX_txn *txn, unsigned user_flags, MDBX_dbi *dbi, MD
   env->dbs_flags[slot] = DB_POISON;
   atomic_store32(&env->dbi_seqs[slot], dbi_seq_next(env, slot), mo_AcquireRelease);
   memset(&env->kvs[slot], 0, sizeof(env->kvs[slot]));
+#if MDBX_ENABLE_DBI_OPSTAT
+  memset(&env->dbi_opstat[slot], 0, sizeof(env->dbi_opstat[slot]));
+#endif /* MDBX_ENABLE_DBI_OPSTAT */
   if (env->n_dbi == slot)
     env->n_dbi = (unsigned)slot + 1;
   eASSERT(env, slot < env->n_dbi);
@@ -475,8 +611,11 @@ static int dbi_open_locked(MDBX_txn *txn, unsigned user_flags, MDBX_dbi *dbi, MD
     goto bailout;
 
   env->kvs[slot].name = name;
+  dbi_hash_insert(env, slot);
   env->dbs_flags[slot] = txn->dbs[slot].flags | DB_VALID;
   txn->dbi_seqs[slot] = atomic_store32(&env->dbi_seqs[slot], seq, mo_AcquireRelease);
+  if (env->dbi_free_hint == slot)
+    env->dbi_free_hint = (unsigned)slot + 1;
 
 done:
   *dbi = (MDBX_dbi)slot;
@@ -532,7 +671,11 @@ int dbi_open(MDBX_txn *txn, const MDBX_val *const name, unsigned user_flags, MDB
   /* Is the DB already open? */
   const MDBX_env *const env = txn->env;
   bool have_free_slot = env->n_dbi < env->max_dbi;
-  for (size_t i = CORE_DBS; i < env->n_dbi; ++i) {
+  /* при наличии хэш-индекса проверяется только найденный в нём хендл,
+   * а в случае промаха или несовпадения выполняется поиск под блокировкой */
+  const bool hashed = dbi_hash_bytewise(env);
+  for (size_t i = hashed ? dbi_hash_lookup(env, name) : CORE_DBS; i >= CORE_DBS && i < env->n_dbi;
+       i = hashed ? SIZE_MAX : i + 1) {
     if ((env->dbs_flags[i] & DB_VALID) == 0) {
       have_free_slot = true;
       continue;
@@ -588,7 +731,7 @@ int dbi_open(MDBX_txn *txn, const MDBX_val *const name, unsigned user_flags, MDB
   }
 
   /* Fail, if no free slot and max hit */
-  if (unlikely(!have_free_slot))
+  if (unlikely(!have_free_slot) && !hashed)
     return MDBX_DBS_FULL;
 
 slowpath_locking:
@@ -644,6 +787,8 @@ __cold struct dbi_rename_result dbi_rename_locked(MDBX_txn *txn, MDBX_dbi dbi, M
     if (likely(pair.err == MDBX_SUCCESS)) {
       pair.defer = env->kvs[dbi].name.iov_base;
       env->kvs[dbi].name = new_name;
+      dbi_hash_remove(env, dbi, &old_name);
+      dbi_hash_insert(env, dbi);
     } else
       txn->flags |= MDBX_TXN_ERROR;
   }
@@ -660,9 +805,12 @@ static defer_free_item_t *dbi_close_locked(MDBX_env *env, MDBX_dbi dbi) {
   const uint32_t seq = dbi_seq_next(env, dbi);
   defer_free_item_t *defer_item = env->kvs[dbi].name.iov_base;
   if (likely(defer_item)) {
+    const MDBX_val name = env->kvs[dbi].name;
     env->dbs_flags[dbi] = 0;
+    dbi_slot_vacated(env, dbi);
     env->kvs[dbi].name.iov_len = 0;
     env->kvs[dbi].name.iov_base = nullptr;
+    dbi_hash_remove(env, dbi, &name);
     atomic_store32(&env->dbi_seqs[dbi], seq, mo_AcquireRelease);
     osal_flush_incoherent_cpu_writeback();
     defer_item->next = nullptr;
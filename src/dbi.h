@@ -81,6 +81,9 @@ static inline bool dbi_foreach_step(const MDBX_txn *const txn, size_t *bitmap_it
 
 MDBX_INTERNAL int dbi_import(MDBX_txn *txn, const size_t dbi);
 
+MDBX_INTERNAL size_t dbi_hash_bytes(const MDBX_dbi max_dbi);
+MDBX_INTERNAL size_t dbi_lookup(const MDBX_env *env, const MDBX_val *name);
+
 struct dbi_snap_result {
   uint32_t sequence;
   unsigned flags;
@@ -115,6 +115,7 @@ __cold int dxb_read_header(MDBX_env *env, meta_t *dest, const int lck_exclusive,
 
 __cold int dxb_resize(MDBX_env *const env, const pgno_t used_pgno, const pgno_t size_pgno, pgno_t limit_pgno,
                       const enum resize_mode mode) {
+  MDBX_MAYBE_UNUSED const uint64_t usdt_begin = usdt_monotime();
   /* Acquire guard to avoid collision between read and write txns
    * around geo_in_bytes and dxb_mmap */
 #if defined(_WIN32) || defined(_WIN64)
@@ -194,6 +195,9 @@ __cold int dxb_resize(MDBX_env *const env, const pgno_t used_pgno, const pgno_t
           rc = err;
           goto bailout;
         }
+        /* forbid lock-free binding of reader slots, see mvcc_bind_slot() */
+        atomic_store32(&env->remap_pending, true, mo_Relaxed);
+        osal_memory_barrier();
 
         /* looking for readers from this process */
         const size_t snap_nreaders = atomic_load32(&lck->rdt_length, mo_AcquireRelease);
@@ -202,6 +206,7 @@ __cold int dxb_resize(MDBX_env *const env, const pgno_t used_pgno, const pgno_t
           if (lck->rdt[i].pid.weak == env->pid && lck->rdt[i].tid.weak != osal_thread_self()) {
             /* the base address of the mapping can't be changed since
              * the other reader thread from this process exists. */
+            atomic_store32(&env->remap_pending, false, mo_AcquireRelease);
             lck_rdt_unlock(env);
             mresize_flags &= ~(MDBX_MRESIZE_MAY_UNMAP | MDBX_MRESIZE_MAY_MOVE);
             break;
@@ -341,14 +346,17 @@ bailout:
       osal_free(suspended);
   }
 #else
-  if (env->lck_mmap.lck && (mresize_flags & (MDBX_MRESIZE_MAY_UNMAP | MDBX_MRESIZE_MAY_MOVE)) != 0)
+  if (env->lck_mmap.lck && (mresize_flags & (MDBX_MRESIZE_MAY_UNMAP | MDBX_MRESIZE_MAY_MOVE)) != 0) {
+    atomic_store32(&env->remap_pending, false, mo_AcquireRelease);
     lck_rdt_unlock(env);
+  }
   int err = osal_fastmutex_release(&env->remap_guard);
 #endif /* Windows */
   if (err != MDBX_SUCCESS) {
     FATAL("failed resume-after-remap: errcode %d", err);
     return MDBX_PANIC;
   }
+  USDT_PROBE6(dxb_resize, bytes2pgno(env, prev_size), size_pgno, limit_pgno, mode, rc, usdt_ns_since(usdt_begin));
   return rc;
 }
 #if defined(ENABLE_MEMCHECK) || defined(__SANITIZE_ADDRESS__)
@@ -503,6 +511,44 @@ __cold int dxb_set_readahead(const MDBX_env *env, const pgno_t edge, const bool
   return err;
 }
 
+/* Hint the OS to read the given pages in advance, e.g. the next frontier of
+ * a tree traversal. This is advisory only, so errors are ignored. */
+__cold void dxb_prefetch(const MDBX_env *env, const pgno_t pgno, const size_t npages) {
+  const size_t current = env->dxb_mmap.current;
+  size_t offset = pgno2bytes(env, pgno);
+  if (unlikely(offset >= current || !npages))
+    return;
+  size_t length = pgno2bytes(env, npages);
+  length = (length < current - offset) ? length : current - offset;
+  /* the DB page may be smaller than a system one */
+  const size_t gap = offset - floor_powerof2(offset, globals.sys_pagesize);
+  offset -= gap;
+  length += gap;
+
+#if defined(F_RDADVISE)
+  struct radvisory hint;
+  hint.ra_offset = offset;
+  hint.ra_count = unlikely(length > INT_MAX && sizeof(length) > sizeof(hint.ra_count)) ? INT_MAX : (int)length;
+  (void)/* Ignore ENOTTY for DB on the ram-disk and so on */ fcntl(env->lazy_fd, F_RDADVISE, &hint);
+#elif defined(MADV_WILLNEED)
+  (void)madvise(ptr_disp(env->dxb_mmap.base, offset), length, MADV_WILLNEED);
+#elif defined(POSIX_MADV_WILLNEED)
+  (void)posix_madvise(ptr_disp(env->dxb_mmap.base, offset), length, POSIX_MADV_WILLNEED);
+#elif defined(_WIN32) || defined(_WIN64)
+  if (imports.PrefetchVirtualMemory) {
+    WIN32_MEMORY_RANGE_ENTRY hint;
+    hint.VirtualAddress = ptr_disp(env->dxb_mmap.base, offset);
+    hint.NumberOfBytes = length;
+    (void)imports.PrefetchVirtualMemory(GetCurrentProcess(), 1, &hint, 0);
+  }
+#elif defined(POSIX_FADV_WILLNEED)
+  (void)posix_fadvise(env->lazy_fd, offset, length, POSIX_FADV_WILLNEED);
+#else
+  (void)offset;
+  (void)length;
+#endif
+}
+
 __cold int dxb_setup(MDBX_env *env, const int lck_rc, const mdbx_mode_t mode_bits) {
   meta_t header;
   eASSERT(env, !(env->flags & ENV_ACTIVE));
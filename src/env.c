@@ -573,7 +573,7 @@ __cold int env_close(MDBX_env *env, bool resurrect_after_fork) {
         if (env->kvs[i].name.iov_len)
           osal_free(env->kvs[i].name.iov_base);
       osal_free(env->kvs);
-      env->n_dbi = CORE_DBS;
+      env->n_dbi = env->dbi_free_hint = CORE_DBS;
       env->kvs = nullptr;
     }
     if (env->page_auxbuf) {
@@ -584,6 +584,16 @@ __cold int env_close(MDBX_env *env, bool resurrect_after_fork) {
       osal_free(env->dbi_seqs);
       env->dbi_seqs = nullptr;
     }
+#if MDBX_ENABLE_DBI_OPSTAT
+    if (env->dbi_opstat) {
+      osal_free(env->dbi_opstat);
+      env->dbi_opstat = nullptr;
+    }
+#endif /* MDBX_ENABLE_DBI_OPSTAT */
+    if (env->dbi_hash) {
+      osal_free(env->dbi_hash);
+      env->dbi_hash = nullptr;
+    }
     if (env->dbs_flags) {
       osal_free(env->dbs_flags);
       env->dbs_flags = nullptr;
@@ -852,7 +852,8 @@ pgr_t gc_alloc_ex(const MDBX_cursor *const mc, const size_t num, uint8_t flags)
   eASSERT(env, pnl_check_allocated(txn->wr.repnl, txn->geo.first_unallocated - MDBX_ENABLE_REFUND));
 
   size_t newnext;
-  const uint64_t monotime_begin = (MDBX_ENABLE_PROFGC || (num > 1 && env->options.gc_time_limit)) ? osal_monotime() : 0;
+  const uint64_t monotime_begin =
+      (MDBX_ENABLE_PROFGC || MDBX_ENABLE_USDT || (num > 1 && env->options.gc_time_limit)) ? osal_monotime() : 0;
   struct monotime_cache now_cache;
   now_cache.expire_countdown = 1 /* старт с 1 позволяет избавиться как от лишних системных вызовов когда
                                     лимит времени задан нулевой или уже исчерпан, так и от подсчета
@@ -878,7 +879,9 @@ pgr_t gc_alloc_ex(const MDBX_cursor *const mc, const size_t num, uint8_t flags)
   //---------------------------------------------------------------------------
 
   if (unlikely(!is_reclaimable(txn, mc, flags))) {
-    eASSERT(env, (txn->flags & txn_gc_drained) || num > 1);
+    /* Отладочная сборка выполняет раннюю очистку GC при любом размере wr.repnl,
+     * поэтому изменение GC-курсором может потребовать страницу вне резерва. */
+    eASSERT(env, (txn->flags & txn_gc_drained) || num > 1 || (MDBX_DEBUG && mc == gc_cursor(env)));
     goto no_gc;
   }
 
@@ -1339,6 +1342,7 @@ done:
 #if MDBX_ENABLE_PROFGC
   prof->rtime_monotonic += osal_monotime() - monotime_begin;
 #endif /* MDBX_ENABLE_PROFGC */
+  USDT_PROBE6(gc_alloc, txn->txnid, cursor_dbi(mc), num, flags, ret.err, usdt_ns_since(monotime_begin));
   return ret;
 }
 
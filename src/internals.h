@@ -58,7 +58,8 @@ enum signatures {
   txn_signature = INT32_C(0x13D53A31),
   cur_signature_live = INT32_C(0x7E05D5B1),
   cur_signature_ready4dispose = INT32_C(0x2817A047),
-  cur_signature_wait4eot = INT32_C(0x10E297A7)
+  cur_signature_wait4eot = INT32_C(0x10E297A7),
+  snapshot_signature = INT32_C(0x5A9C73E1)
 };
 
 /*----------------------------------------------------------------------------*/
@@ -140,6 +141,27 @@ struct kvx {
   MDBX_val name; /* имя table */
 };
 
+/* Счетчики операций с отдельной table в пределах экземпляра env.
+ *
+ * Хранятся отдельно от kvx_t, чтобы не раздувать его. Счетчики чтения
+ * обновляются одновременно из нескольких читающих потоков, а сброс может
+ * выполняться параллельно с любыми операциями, поэтому все счетчики
+ * обновляются атомарно посредством opstat_add(). Однако, при этом все потоки
+ * работающие с одной table конкурируют за одну линию кэша, из-за чего опция
+ * MDBX_ENABLE_DBI_OPSTAT выключена по-умолчанию. */
+typedef struct dbi_opstat {
+  mdbx_atomic_uint64_t gets;  /* поиски посредством mdbx_get() и подобных */
+  mdbx_atomic_uint64_t puts;  /* вставки и обновления */
+  mdbx_atomic_uint64_t dels;  /* удаления */
+  mdbx_atomic_uint64_t seeks; /* позиционирование курсора по ключу */
+  mdbx_atomic_uint64_t steps; /* перемещения курсора относительно текущей позиции */
+  mdbx_atomic_uint64_t newly; /* выделено новых страниц */
+  mdbx_atomic_uint64_t cow;   /* скопировано страниц при изменении (copy-on-write) */
+  mdbx_atomic_uint64_t split; /* разделений страниц */
+  mdbx_atomic_uint64_t merge; /* слияний страниц */
+  mdbx_atomic_uint64_t large; /* выделено страниц для длинных значений */
+} dbi_opstat_t;
+
 /* Non-shared DBI state flags inside transaction */
 enum dbi_state {
   DBI_DIRTY = 0x01 /* DB was written in this txn */,
@@ -155,6 +177,7 @@ enum txn_flags {
   txn_ro_begin_flags = MDBX_TXN_RDONLY | MDBX_TXN_RDONLY_PREPARE,
   txn_rw_begin_flags = MDBX_TXN_NOMETASYNC | MDBX_TXN_NOSYNC | MDBX_TXN_TRY,
   txn_shrink_allowed = UINT32_C(0x40000000),
+  txn_snapshot_holder = UINT32_C(0x20000000) /* hidden holder of MDBX_snapshot */,
   txn_parked = MDBX_TXN_PARKED,
   txn_gc_drained = 0x80 /* GC was depleted up to oldest reader */,
   txn_may_have_cursors = 0x100,
@@ -205,10 +228,20 @@ struct MDBX_txn {
   /* User-settable context */
   void *userctx;
 
+#if MDBX_ENABLE_LATENCY_HIST
+  /* Счетчик операций для прореживания замеров задержек. */
+  uint32_t latency_tick;
+#endif /* MDBX_ENABLE_LATENCY_HIST */
+
   union {
     struct {
       /* For read txns: This thread/txn's slot table slot, or nullptr. */
       reader_slot_t *slot;
+      /* For views of a shared snapshot: the snapshot, which holds the slot. */
+      MDBX_snapshot *snapshot;
+      /* For reset read txns: the number of DBI-handles, which states could be
+       * reused by renewal if the MVCC-snapshot is unchanged, or zero. */
+      size_t reuse_n_dbi;
     } ro;
     struct {
       troika_t troika;
@@ -255,6 +288,16 @@ struct MDBX_txn {
   };
 };
 
+/* Разделяемый MVCC-снимок для чтения из множества потоков.
+ * Удерживает один слот в таблице читателей посредством скрытой читающей
+ * транзакции, а порождаемые от него транзакции-представления (views) лишь
+ * копируют состояние этой транзакции и не занимают слотов. */
+struct MDBX_snapshot {
+  int32_t signature;
+  mdbx_atomic_uint32_t refs; /* число ссылок, включая транзакции-представления */
+  MDBX_txn *txn;             /* читающая транзакция удерживающая снимок */
+};
+
 #define CURSOR_STACK_SIZE (16 + MDBX_WORDBITS / 4)
 
 struct MDBX_cursor {
@@ -379,13 +422,32 @@ struct MDBX_env {
   kvx_t *kvs;                     /* array of auxiliary key-value properties */
   uint8_t *__restrict dbs_flags;  /* array of flags from tree_t.flags */
   mdbx_atomic_uint32_t *dbi_seqs; /* array of dbi sequence numbers */
+#if MDBX_ENABLE_DBI_OPSTAT
+  dbi_opstat_t *dbi_opstat; /* array of per-table operation counters */
+#endif                      /* MDBX_ENABLE_DBI_OPSTAT */
+  mdbx_atomic_uint32_t *dbi_hash; /* hash index of table names to dbi */
+  uint32_t dbi_hash_mask;         /* size of the dbi_hash minus one */
+  uint32_t dbi_hash_deleted;      /* number of tombstones in the dbi_hash */
   unsigned maxgc_large1page;      /* Number of pgno_t fit in a single large page */
   unsigned maxgc_per_branch;
   uint32_t registered_reader_pid; /* have liveness lock in reader table */
   void *userctx;                  /* User-settable context */
   MDBX_hsr_func *hsr_callback;    /* Callback for kicking laggard readers */
+  struct {
+    MDBX_pageship_func *callback; /* Callback for shipping of committed pages */
+    MDBX_snapshot *base;          /* The last shipped snapshot */
+    int status;                   /* Error of the last shipping, if failed */
+  } pageship;
   size_t madv_threshold;
 
+#if MDBX_ENABLE_LATENCY_HIST
+  struct {
+    uint32_t period; /* период прореживания замеров, ноль если отключено */
+    uint32_t tick;   /* счетчик стартов читающих транзакций для прореживания */
+    lat_hist_t local[MDBX_LATENCY_KINDS]; /* гистограммы текущего процесса */
+  } latency;
+#endif /* MDBX_ENABLE_LATENCY_HIST */
+
   struct {
     unsigned dp_reserve_limit;
     unsigned rp_augment_limit;
@@ -471,7 +533,8 @@ struct MDBX_env {
     txnid_t detent;
   } gc;
   osal_fastmutex_t dbi_lock;
-  unsigned n_dbi; /* number of DBs opened */
+  unsigned n_dbi;         /* number of DBs opened */
+  unsigned dbi_free_hint; /* all slots below are in use */
 
   unsigned shadow_reserve_len;
   page_t *__restrict shadow_reserve; /* list of malloc'ed blocks for re-use */
@@ -486,6 +549,10 @@ struct MDBX_env {
                              to the DB files */
 #else
   osal_fastmutex_t remap_guard;
+  /* Non-zero while dxb_resize() holds the readers table locked for a remap
+   * which could move or unmap the DB, i.e. the lock-free binding of reader
+   * slots by threads of this process must fall back to the slow path. */
+  mdbx_atomic_uint32_t remap_pending;
 #endif
 
   /* ------------------------------------------------- stub for lck-less mode */
@@ -499,7 +566,8 @@ struct MDBX_env {
 
 /* Number of slots in the reader table.
  * This value was chosen somewhat arbitrarily. The 61 is a prime number,
- * and such readers plus a couple mutexes fit into single 4KB page.
+ * and such readers plus a couple mutexes once fit into single 4KB page,
+ * before the summary of the reader table was added to the LCK-header.
  * Applications should set the table size using mdbx_env_set_maxreaders(). */
 #define DEFAULT_READERS 61
 
@@ -532,6 +600,10 @@ MDBX_MAYBE_UNUSED static void static_checks(void) {
                     "Oops, some txn flags overlapped or wrong");
   STATIC_ASSERT_MSG(((txn_rw_begin_flags | txn_ro_begin_flags | txn_state_flags) & txn_shrink_allowed) == 0,
                     "Oops, some txn flags overlapped or wrong");
+  STATIC_ASSERT_MSG(((txn_rw_begin_flags | txn_ro_begin_flags | txn_state_flags | txn_shrink_allowed | MDBX_WRITEMAP |
+                      MDBX_NOSTICKYTHREADS) &
+                     txn_snapshot_holder) == 0,
+                    "Oops, some txn flags overlapped or wrong");
 
   STATIC_ASSERT(sizeof(reader_slot_t) == 32);
 #if MDBX_LOCKING > 0
@@ -573,6 +645,10 @@ MDBX_MAYBE_UNUSED static void static_checks(void) {
 
 #include "lck.h"
 
+#include "latency.h"
+
+#include "usdt.h"
+
 #include "meta.h"
 
 #include "page-iov.h"
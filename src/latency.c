@@ -0,0 +1,53 @@
+/// \copyright SPDX-License-Identifier: Apache-2.0
+/// \author Леонид Юрьев aka Leonid Yuriev <leo@yuriev.ru> \date 2025
+
+#include "internals.h"
+
+#if MDBX_ENABLE_LATENCY_HIST
+
+static inline unsigned latency_bucket(uint64_t ns) {
+  if (ns < 2)
+    return 0;
+#if __GNUC_PREREQ(4, 1) || __has_builtin(__builtin_clzll)
+  const unsigned msb = 63 - __builtin_clzll(ns);
+#else
+  unsigned msb = 0;
+  for (unsigned shift = 32; shift; shift >>= 1)
+    if (ns >> shift) {
+      ns >>= shift;
+      msb += shift;
+    }
+#endif
+  return (msb < MDBX_LATENCY_BUCKETS) ? msb : MDBX_LATENCY_BUCKETS - 1;
+}
+
+static inline void latency_add(lat_hist_t *hist, uint64_t ns, unsigned bucket) {
+  /* Без атомарных RMW-операций, так как замеры прорежены, а незначительная
+   * потеря отсчетов при гонках допустима. */
+  hist->count.weak += 1;
+  hist->total.weak += ns;
+  hist->buckets[bucket].weak += 1;
+}
+
+void latency_record(MDBX_env *env, MDBX_latency_kind_t kind, uint64_t ns) {
+  assert(kind < MDBX_LATENCY_KINDS);
+  const unsigned bucket = latency_bucket(ns);
+  latency_add(&env->lck->latency[kind], ns, bucket);
+  latency_add(&env->latency.local[kind], ns, bucket);
+}
+
+void latency_probe_start(latency_probe_t *probe) {
+  osal_cputime(&probe->majflt);
+  probe->start = osal_monotime();
+}
+
+void latency_probe_end(MDBX_env *env, const latency_probe_t *probe, MDBX_latency_kind_t kind) {
+  const uint64_t ns = osal_monotime_to_ns(osal_monotime() - probe->start);
+  size_t majflt;
+  osal_cputime(&majflt);
+  latency_record(env, kind, ns);
+  if (majflt != probe->majflt)
+    latency_record(env, MDBX_LATENCY_FAULTED, ns);
+}
+
+#endif /* MDBX_ENABLE_LATENCY_HIST */
@@ -0,0 +1,36 @@
+/// \copyright SPDX-License-Identifier: Apache-2.0
+/// \author Леонид Юрьев aka Leonid Yuriev <leo@yuriev.ru> \date 2025
+
+#pragma once
+
+#include "essentials.h"
+
+#if MDBX_ENABLE_LATENCY_HIST
+
+/* Гистограммы задержек операций чтения, см. mdbx_env_latency_hist().
+ *
+ * Замеры прореживаются согласно MDBX_opt_latency_sampling, т.е. при периоде
+ * N замеряется только каждая N-ая операция, а для остальных затраты сводятся
+ * к инкременту и проверке счетчика. Результаты накапливаются одновременно
+ * в LCK (для всех процессов) и в MDBX_env (для текущего процесса). */
+
+typedef struct latency_probe {
+  uint64_t start;
+  size_t majflt;
+} latency_probe_t;
+
+MDBX_INTERNAL void latency_record(MDBX_env *env, MDBX_latency_kind_t kind, uint64_t ns);
+MDBX_INTERNAL void latency_probe_start(latency_probe_t *probe);
+MDBX_INTERNAL void latency_probe_end(MDBX_env *env, const latency_probe_t *probe, MDBX_latency_kind_t kind);
+
+/* Решает замерять ли очередную операцию и при необходимости начинает замер,
+ * а tick является счетчиком операций для прореживания. */
+static inline bool latency_probe_begin(const MDBX_env *env, uint32_t *tick, latency_probe_t *probe) {
+  const uint32_t period = env->latency.period;
+  if (likely(period == 0) || likely((++*tick & (period - 1)) != 0))
+    return false;
+  latency_probe_start(probe);
+  return true;
+}
+
+#endif /* MDBX_ENABLE_LATENCY_HIST */
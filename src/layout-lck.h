@@ -8,7 +8,7 @@
 #include "essentials.h"
 
 /* The version number for a database's lockfile format. */
-#define MDBX_LOCK_VERSION 6
+#define MDBX_LOCK_VERSION 7
 
 #if MDBX_LOCKING == MDBX_LOCKING_WIN32FILES
 
@@ -29,6 +29,25 @@ typedef pthread_mutex_t osal_ipclock_t;
 #define MDBX_LCK_SIGN UINT32_C(0xFC29)
 typedef sem_t osal_ipclock_t;
 
+#elif MDBX_LOCKING == MDBX_LOCKING_FUTEX
+
+#define MDBX_LCK_SIGN UINT32_C(0xF07E)
+/* Справедливая (FIFO) блокировка с билетами (ticket lock) поверх Linux futex:
+ *  - ожидающие берут номер билета из tail и захватывают блокировку в порядке
+ *    очереди, что исключает "голодание" писателей из разных процессов;
+ *  - в state размещается номер обслуживаемого билета (младшие 32 бита)
+ *    и pid владельца (старшие 32 бита), что позволяет обнаружить смерть
+ *    владельца и восстановить работоспособность блокировки;
+ *  - futex-слово event увеличивается при каждом изменении state,
+ *    а ожидающие засыпают на нём после ограниченного активного ожидания. */
+typedef struct osal_ipclock {
+  mdbx_atomic_uint64_t state;
+  mdbx_atomic_uint32_t tail;
+  mdbx_atomic_uint32_t event;
+  mdbx_atomic_uint32_t sleepers;
+  mdbx_atomic_uint32_t spin_limit;
+} osal_ipclock_t;
+
 #else
 #error "FIXME"
 #endif /* MDBX_LOCKING */
@@ -102,14 +121,24 @@ typedef struct pgops {
   } gc_prof;
 } pgop_stat_t;
 
+/* Log2-гистограмма длительностей операций в наносекундах,
+ * см. mdbx_env_latency_hist(). */
+typedef struct lat_hist {
+  mdbx_atomic_uint64_t count;
+  mdbx_atomic_uint64_t total;
+  mdbx_atomic_uint64_t buckets[MDBX_LATENCY_BUCKETS];
+} lat_hist_t;
+
 /* Reader Lock Table
  *
  * Readers don't acquire any locks for their data access. Instead, they
- * simply record their transaction ID in the reader table. The reader
- * mutex is needed just to find an empty slot in the reader table. The
- * slot's address is saved in thread-specific data so that subsequent
- * read transactions started by the same thread need no further locking to
- * proceed.
+ * simply record their transaction ID in the reader table. A free slot
+ * is claimed lock-free by CAS on its pid, starting from a position derived
+ * from the current CPU number to spread concurrently starting threads. The
+ * reader mutex is needed just to extend the reader table and to cleanup
+ * slots of dead processes. The slot's address is saved in thread-specific
+ * data so that subsequent read transactions started by the same thread need
+ * no further locking to proceed.
  *
  * If MDBX_NOSTICKYTHREADS is set, the slot address is not saved in
  * thread-specific data. No reader table is used if the database is on a
@@ -141,6 +170,12 @@ typedef struct pgops {
  * string of contiguous pages can be found after coalescing old pages from
  * many old transactions together. */
 
+#define MDBX_READERS_LIMIT 32767
+
+/* The reader table is summarized by groups of 64 slots (2 KiB). */
+#define MDBX_RDT_GROUP_LN2 6
+#define MDBX_RDT_GROUPS ((MDBX_READERS_LIMIT >> MDBX_RDT_GROUP_LN2) + 1)
+
 /* The actual reader record, with cacheline padding. */
 typedef struct reader_slot {
   /* Current Transaction ID when this transaction began, or INVALID_TXNID.
@@ -229,6 +264,27 @@ typedef struct shared_lck {
 
   MDBX_ALIGNAS(MDBX_CACHELINE_SIZE) /* cacheline ----------------------------*/
 
+  /* Statistics of the write transaction lock contention. Everything except
+   * the number of waiters is updated only while holding the lock. */
+  struct {
+    mdbx_atomic_uint64_t acquisitions; /* Number of lock acquisitions */
+    mdbx_atomic_uint64_t contended;    /* Number of acquisitions with waiting */
+    mdbx_atomic_uint64_t wait_time;    /* Total waiting time in 1/65536 of second */
+    mdbx_atomic_uint32_t waiters;      /* Current number of waiters */
+    mdbx_atomic_uint32_t max_waiters;  /* Peak number of waiters */
+  } wrt_stat;
+
+#if MDBX_ENABLE_LATENCY_HIST
+  MDBX_ALIGNAS(MDBX_CACHELINE_SIZE) /* cacheline ----------------------------*/
+
+  /* Гистограммы задержек всех процессов текущей сессии. Обновляются без
+   * атомарных операций, т.е. при одновременных замерах в нескольких потоках
+   * возможна незначительная потеря отсчетов. */
+  lat_hist_t latency[MDBX_LATENCY_KINDS];
+#endif /* MDBX_ENABLE_LATENCY_HIST */
+
+  MDBX_ALIGNAS(MDBX_CACHELINE_SIZE) /* cacheline ----------------------------*/
+
 #if MDBX_LOCKING > 0
   /* Write transaction lock. */
   osal_ipclock_t wrt_lock;
@@ -272,6 +328,17 @@ typedef struct shared_lck {
   mdbx_atomic_uint32_t rdt_length;
   mdbx_atomic_uint32_t rdt_refresh_flag;
 
+  MDBX_ALIGNAS(MDBX_CACHELINE_SIZE) /* cacheline ----------------------------*/
+
+  /* Hierarchical summary of the reader table for mvcc_shapshot_oldest().
+   * Readers raise the refresh flag of the group of their slot on any change,
+   * while the writer rescans only the changed groups and keeps the oldest
+   * txnid of each group, so the oldest reader is found in O(groups) instead
+   * of O(readers). A zero-initialized flag means "changed", i.e. a group
+   * will be scanned at the first time. */
+  mdbx_atomic_uint32_t rdt_group_refresh[MDBX_RDT_GROUPS];
+  atomic_txnid_t rdt_group_oldest[MDBX_RDT_GROUPS];
+
 #if FLEXIBLE_ARRAY_MEMBERS
   MDBX_ALIGNAS(MDBX_CACHELINE_SIZE) /* cacheline ----------------------------*/
   reader_slot_t rdt[] /* dynamic size */;
@@ -285,5 +352,3 @@ typedef struct shared_lck {
 } lck_t;
 
 #define MDBX_LOCK_MAGIC ((MDBX_MAGIC << 8) + MDBX_LOCK_VERSION)
-
-#define MDBX_READERS_LIMIT 32767
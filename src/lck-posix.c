@@ -9,7 +9,13 @@
 
 #if MDBX_LOCKING == MDBX_LOCKING_SYSV
 #include <sys/sem.h>
-#endif /* MDBX_LOCKING == MDBX_LOCKING_SYSV */
+#elif MDBX_LOCKING == MDBX_LOCKING_FUTEX
+#include <linux/futex.h>
+#include <sys/syscall.h>
+#if !MDBX_64BIT_CAS
+#error "MDBX_LOCKING_FUTEX requires 64-bit atomic CAS"
+#endif /* MDBX_64BIT_CAS */
+#endif /* MDBX_LOCKING */
 
 /* Описание реализации блокировок для POSIX & Linux:
  *
@@ -207,6 +213,9 @@ int lck_ipclock_stubinit(osal_ipclock_t *ipc) {
   return sem_init(ipc, false, 1) ? errno : 0;
 #elif MDBX_LOCKING == MDBX_LOCKING_POSIX2001 || MDBX_LOCKING == MDBX_LOCKING_POSIX2008
   return pthread_mutex_init(ipc, nullptr);
+#elif MDBX_LOCKING == MDBX_LOCKING_FUTEX
+  memset(ipc, 0, sizeof(*ipc));
+  return MDBX_SUCCESS;
 #else
 #error "FIXME"
 #endif
@@ -217,6 +226,9 @@ int lck_ipclock_destroy(osal_ipclock_t *ipc) {
   return sem_destroy(ipc) ? errno : 0;
 #elif MDBX_LOCKING == MDBX_LOCKING_POSIX2001 || MDBX_LOCKING == MDBX_LOCKING_POSIX2008
   return pthread_mutex_destroy(ipc);
+#elif MDBX_LOCKING == MDBX_LOCKING_FUTEX
+  (void)ipc;
+  return MDBX_SUCCESS;
 #else
 #error "FIXME"
 #endif
@@ -580,10 +592,16 @@ __cold int lck_init(MDBX_env *env, MDBX_env *inprocess_neighbor, int global_uniq
   return MDBX_SUCCESS;
 
 #elif MDBX_LOCKING == MDBX_LOCKING_FUTEX
+
+  /* futex-блокировки не требуют инициализации в процессе, достаточно
+   * обнулить их при первом открытии lck-файла */
   (void)inprocess_neighbor;
-  if (global_uniqueness_flag != MDBX_RESULT_TRUE)
-    return MDBX_SUCCESS;
-#error "FIXME: Not implemented"
+  if (global_uniqueness_flag == MDBX_RESULT_TRUE) {
+    lck_ipclock_stubinit(&env->lck_mmap.lck->rdt_lock);
+    lck_ipclock_stubinit(&env->lck_mmap.lck->wrt_lock);
+  }
+  return MDBX_SUCCESS;
+
 #elif MDBX_LOCKING == MDBX_LOCKING_POSIX1988
 
   /* don't initialize semaphores twice */
@@ -672,7 +690,7 @@ bailout:
 
 __cold static int osal_ipclock_failed(MDBX_env *env, osal_ipclock_t *ipc, const int err) {
   int rc = err;
-#if MDBX_LOCKING == MDBX_LOCKING_POSIX2008 || MDBX_LOCKING == MDBX_LOCKING_SYSV
+#if MDBX_LOCKING == MDBX_LOCKING_POSIX2008 || MDBX_LOCKING == MDBX_LOCKING_SYSV || MDBX_LOCKING == MDBX_LOCKING_FUTEX
 
 #ifndef EOWNERDEAD
 #define EOWNERDEAD MDBX_RESULT_TRUE
@@ -695,7 +713,7 @@ __cold static int osal_ipclock_failed(MDBX_env *env, osal_ipclock_t *ipc, const
     int check_rc = mvcc_cleanup_dead(env, rlocked, nullptr);
     check_rc = (check_rc == MDBX_SUCCESS) ? MDBX_RESULT_TRUE : check_rc;
 
-#if MDBX_LOCKING == MDBX_LOCKING_SYSV
+#if MDBX_LOCKING == MDBX_LOCKING_SYSV || MDBX_LOCKING == MDBX_LOCKING_FUTEX
     rc = (rc == MDBX_SUCCESS) ? check_rc : rc;
 #else
 #if defined(PTHREAD_MUTEX_ROBUST) || defined(pthread_mutex_consistent)
@@ -722,13 +740,6 @@ __cold static int osal_ipclock_failed(MDBX_env *env, osal_ipclock_t *ipc, const
   (void)ipc;
 #elif MDBX_LOCKING == MDBX_LOCKING_POSIX1988
   (void)ipc;
-#elif MDBX_LOCKING == MDBX_LOCKING_FUTEX
-#ifdef _MSC_VER
-#pragma message("warning: TODO")
-#else
-#warning "TODO"
-#endif
-  (void)ipc;
 #else
 #error "FIXME"
 #endif /* MDBX_LOCKING */
@@ -758,6 +769,166 @@ int osal_check_tid4bionic(void) {
 }
 #endif /* __ANDROID_API__ || ANDROID) || BIONIC */
 
+#if MDBX_LOCKING == MDBX_LOCKING_FUTEX
+/* Старший бит поля владельца в state: предыдущий владелец умер не освободив
+ * блокировку, следующий захвативший должен выполнить восстановление. */
+#define FUTEX_OWNER_ORPHAN UINT32_C(0x80000000)
+/* Пределы адаптивного активного ожидания, в итерациях atomic_yield(). */
+#define FUTEX_SPIN_MIN 16u
+#define FUTEX_SPIN_MAX 4096u
+/* Интервал пробуждения для проверки живости владельца, в наносекундах. */
+#define FUTEX_WAIT_NS 125000000
+
+static inline uint64_t futex_state(const uint32_t serving, const uint32_t owner) {
+  return (uint64_t)owner << 32 | serving;
+}
+
+/* Ожидающие засыпают с маской от номера своего билета, что позволяет будить
+ * только обладателя очередного билета (и совпадающих с ним по модулю 32),
+ * а не всю очередь при каждом освобождении. */
+static inline uint32_t futex_bitset(const uint32_t ticket) { return UINT32_C(1) << (ticket & 31); }
+
+static int futex_wait(mdbx_atomic_uint32_t *word, const uint32_t expected, const uint32_t ticket) {
+  /* FUTEX_WAIT_BITSET принимает абсолютный таймаут по CLOCK_MONOTONIC */
+  struct timespec deadline;
+  if (unlikely(clock_gettime(CLOCK_MONOTONIC, &deadline)))
+    return errno;
+  deadline.tv_nsec += FUTEX_WAIT_NS;
+  if (deadline.tv_nsec >= 1000000000) {
+    deadline.tv_sec += 1;
+    deadline.tv_nsec -= 1000000000;
+  }
+  /* без FUTEX_PRIVATE_FLAG, так как блокировка разделяется между процессами */
+  return syscall(SYS_futex, &word->weak, FUTEX_WAIT_BITSET, expected, &deadline, nullptr, futex_bitset(ticket))
+             ? errno
+             : MDBX_SUCCESS;
+}
+
+static void futex_wake(mdbx_atomic_uint32_t *word, const uint32_t serving) {
+  syscall(SYS_futex, &word->weak, FUTEX_WAKE_BITSET, INT_MAX, nullptr, nullptr, futex_bitset(serving));
+}
+
+/* Изменяет state и будит обладателя очередного билета, используется при
+ * восстановлении после смерти владельца и при пропуске невостребованного
+ * билета. */
+static bool futex_advance(osal_ipclock_t *ipc, const uint64_t state, const uint64_t next) {
+  if (!atomic_cas64(&ipc->state, state, next))
+    return false;
+  atomic_add32(&ipc->event, 1);
+  futex_wake(&ipc->event, (uint32_t)next);
+  return true;
+}
+
+/* Если задан waiters, то на время ожидания в очереди за другими он
+ * увеличивается, а в queued возвращается его значение с учётом себя. */
+static int futex_lock(MDBX_env *env, osal_ipclock_t *ipc, const bool dont_wait, mdbx_atomic_uint32_t *waiters,
+                      uint32_t *queued) {
+  const uint32_t pid = env->pid;
+  uint32_t ticket;
+  if (dont_wait) {
+    /* билет берётся только если блокировка свободна и очередь пуста */
+    const uint64_t state = atomic_load64(&ipc->state, mo_AcquireRelease);
+    ticket = (uint32_t)state;
+    if ((uint32_t)(state >> 32) & ~FUTEX_OWNER_ORPHAN || !atomic_cas32(&ipc->tail, ticket, ticket + 1))
+      return MDBX_BUSY;
+  } else
+    ticket = atomic_add32(&ipc->tail, 1);
+
+  const uint32_t spin_limit = atomic_load32(&ipc->spin_limit, mo_Relaxed);
+  uint32_t spins = 0;
+  unsigned stalls = 0;
+  bool sleeping = false;
+  int rc;
+  for (;;) {
+    const uint32_t event = atomic_load32(&ipc->event, mo_AcquireRelease);
+    const uint64_t state = atomic_load64(&ipc->state, mo_AcquireRelease);
+    const uint32_t serving = (uint32_t)state, owner = (uint32_t)(state >> 32);
+    const int32_t distance = (int32_t)(ticket - serving);
+    if (distance == 0 && (owner & ~FUTEX_OWNER_ORPHAN) == 0) {
+      if (atomic_cas64(&ipc->state, state, futex_state(serving, pid))) {
+        rc = (owner & FUTEX_OWNER_ORPHAN) ? EOWNERDEAD : MDBX_SUCCESS;
+        break;
+      }
+      continue;
+    }
+
+    if (waiters && !*queued)
+      *queued = atomic_add32(waiters, 1) + 1;
+
+    if (unlikely(distance < 0)) {
+      /* билет был пропущен из-за слишком долгой задержки, встаём в очередь заново */
+      ticket = atomic_add32(&ipc->tail, 1);
+      continue;
+    }
+
+    if (distance == 0 && !sleeping && spins < spin_limit + FUTEX_SPIN_MIN) {
+      /* следующие в очереди, ждём освобождения активно */
+      atomic_yield();
+      spins += 1;
+      continue;
+    }
+
+    if (!sleeping) {
+      sleeping = true;
+      atomic_add32(&ipc->sleepers, 1);
+    }
+    rc = futex_wait(&ipc->event, event, ticket);
+    if (rc != ETIMEDOUT) {
+      if (unlikely(rc != MDBX_SUCCESS && rc != EAGAIN && rc != EINTR))
+        break;
+      stalls = 0;
+      continue;
+    }
+
+    if (atomic_load64(&ipc->state, mo_AcquireRelease) != state) {
+      stalls = 0;
+      continue;
+    }
+    const uint32_t owner_pid = owner & ~FUTEX_OWNER_ORPHAN;
+    if (owner_pid) {
+      /* владелец жив, пока удерживает блокировку байта с номером своего pid */
+      if (owner_pid != pid && env->lck == env->lck_mmap.lck &&
+          lck_op(env->lazy_fd, op_getlk, F_WRLCK, owner_pid, 1) == MDBX_RESULT_FALSE) {
+        WARNING("%clock owner pid %u is dead, hand-off ticket %u", (ipc == &env->lck->rdt_lock) ? 'r' : 'w', owner_pid,
+                serving + 1);
+        futex_advance(ipc, state, futex_state(serving + 1, FUTEX_OWNER_ORPHAN));
+      }
+    } else if (++stalls > 1) {
+      /* обладатель билета не забирает блокировку (скорее всего процесс умер
+       * в ожидании), поэтому пропускаем его билет сохраняя признак ORPHAN */
+      NOTICE("skip unclaimed ipc-lock ticket %u", serving);
+      futex_advance(ipc, state, futex_state(serving + 1, owner));
+      stalls = 0;
+    }
+  }
+
+  if (sleeping)
+    atomic_sub32(&ipc->sleepers, 1);
+  if (waiters && *queued)
+    atomic_sub32(waiters, 1);
+  if (likely(rc == MDBX_SUCCESS || rc == EOWNERDEAD)) {
+    /* адаптация длительности активного ожидания, под блокировкой */
+    if (spins && !sleeping)
+      atomic_store32(&ipc->spin_limit, (spin_limit < FUTEX_SPIN_MAX) ? spin_limit + spin_limit / 8 + 1 : FUTEX_SPIN_MAX,
+                     mo_Relaxed);
+    else if (sleeping && spins)
+      atomic_store32(&ipc->spin_limit, spin_limit - spin_limit / 8, mo_Relaxed);
+  }
+  return rc;
+}
+
+static int futex_unlock(MDBX_env *env, osal_ipclock_t *ipc) {
+  const uint64_t state = atomic_load64(&ipc->state, mo_AcquireRelease);
+  if (unlikely((uint32_t)(state >> 32) != env->pid) ||
+      !atomic_cas64(&ipc->state, state, futex_state((uint32_t)state + 1, 0)))
+    return EPERM;
+  atomic_add32(&ipc->event, 1);
+  if (atomic_load32(&ipc->sleepers, mo_AcquireRelease))
+    futex_wake(&ipc->event, (uint32_t)state + 1);
+  return MDBX_SUCCESS;
+}
+#endif /* MDBX_LOCKING_FUTEX */
+
 static int osal_ipclock_lock(MDBX_env *env, osal_ipclock_t *ipc, const bool dont_wait) {
 #if MDBX_LOCKING == MDBX_LOCKING_POSIX2001 || MDBX_LOCKING == MDBX_LOCKING_POSIX2008
   int rc = osal_check_tid4bionic();
@@ -786,6 +957,8 @@ static int osal_ipclock_lock(MDBX_env *env, osal_ipclock_t *ipc, const bool dont
     rc = *ipc ? EOWNERDEAD : MDBX_SUCCESS;
     *ipc = env->pid;
   }
+#elif MDBX_LOCKING == MDBX_LOCKING_FUTEX
+  int rc = futex_lock(env, ipc, dont_wait, nullptr, nullptr);
 #else
 #error "FIXME"
 #endif /* MDBX_LOCKING */
@@ -809,6 +982,8 @@ static int osal_ipclock_unlock(MDBX_env *env, osal_ipclock_t *ipc) {
     struct sembuf op = {.sem_num = (ipc != &env->lck->wrt_lock), .sem_op = 1, .sem_flg = SEM_UNDO};
     err = semop(env->me_sysv_ipc.semid, &op, 1) ? errno : MDBX_SUCCESS;
   }
+#elif MDBX_LOCKING == MDBX_LOCKING_FUTEX
+  err = futex_unlock(env, ipc);
 #else
 #error "FIXME"
 #endif /* MDBX_LOCKING */
@@ -843,7 +1018,47 @@ void lck_rdt_unlock(MDBX_env *env) {
 int lck_txn_lock(MDBX_env *env, bool dont_wait) {
   TRACE("%swait %s", dont_wait ? "dont-" : "", ">>");
   jitter4testing(true);
-  const int err = osal_ipclock_lock(env, &env->lck->wrt_lock, dont_wait);
+  lck_t *const lck = env->lck;
+  uint64_t waited = 0, waited_monotime = 0;
+  uint32_t waiters = 0;
+#if MDBX_LOCKING == MDBX_LOCKING_FUTEX
+  /* Билет в очереди берётся сразу, без предварительной попытки захвата,
+   * а ожидающим считается только вставший в очередь за другими. */
+  const uint64_t started = osal_monotime();
+  int err = futex_lock(env, &lck->wrt_lock, dont_wait, &lck->wrt_stat.waiters, &waiters);
+  if (unlikely(err != MDBX_SUCCESS && err != MDBX_BUSY))
+    err = osal_ipclock_failed(env, &lck->wrt_lock, err);
+  if (waiters) {
+    waited_monotime = osal_monotime() - started;
+    waited = osal_monotime_to_16dot16_noUnderflow(waited_monotime);
+  }
+#else
+  int err = osal_ipclock_lock(env, &lck->wrt_lock, true);
+  if (err == MDBX_BUSY && !dont_wait) {
+    waiters = atomic_add32(&lck->wrt_stat.waiters, 1) + 1;
+    const uint64_t started = osal_monotime();
+    err = osal_ipclock_lock(env, &lck->wrt_lock, false);
+    waited_monotime = osal_monotime() - started;
+    waited = osal_monotime_to_16dot16_noUnderflow(waited_monotime);
+    atomic_sub32(&lck->wrt_stat.waiters, 1);
+  }
+#endif /* MDBX_LOCKING */
+  if (likely(!MDBX_IS_ERROR(err))) {
+    /* статистика обновляется под блокировкой */
+#if MDBX_ENABLE_LATENCY_HIST
+    if (env->latency.period)
+      latency_record(env, MDBX_LATENCY_WRITE_LOCK, osal_monotime_to_ns(waited_monotime));
+#else
+    (void)waited_monotime;
+#endif /* MDBX_ENABLE_LATENCY_HIST */
+    atomic_store64(&lck->wrt_stat.acquisitions, atomic_load64(&lck->wrt_stat.acquisitions, mo_Relaxed) + 1, mo_Relaxed);
+    if (waiters) {
+      atomic_store64(&lck->wrt_stat.contended, atomic_load64(&lck->wrt_stat.contended, mo_Relaxed) + 1, mo_Relaxed);
+      atomic_store64(&lck->wrt_stat.wait_time, atomic_load64(&lck->wrt_stat.wait_time, mo_Relaxed) + waited, mo_Relaxed);
+      if (waiters > atomic_load32(&lck->wrt_stat.max_waiters, mo_Relaxed))
+        atomic_store32(&lck->wrt_stat.max_waiters, waiters, mo_Relaxed);
+    }
+  }
   int rc = err;
   if (likely(env->basal_txn && !MDBX_IS_ERROR(err))) {
     eASSERT(env, !env->basal_txn->owner || err == /* если другой поток в этом-же процессе завершился
@@ -108,3 +108,13 @@ MDBX_INTERNAL int lck_rpid_clear(MDBX_env *env);
 ///     or not working with DB (indicative lock is not present).
 ///   Otherwise (not 0 and not -1) - error code.
 MDBX_INTERNAL int lck_rpid_check(MDBX_env *env, uint32_t pid);
+
+/// \brief Marks the table of readers as changed for mvcc_shapshot_oldest(),
+///   including the summary group which the given slot belongs to.
+/// \note The flags are published with the release semantics, so the writer
+///   which consumes a flag by mvcc_shapshot_oldest() sees the slot changes.
+MDBX_MAYBE_UNUSED static inline void lck_rdt_changed(lck_t *lck, const reader_slot_t *slot) {
+  const size_t group = (size_t)(slot - lck->rdt) >> MDBX_RDT_GROUP_LN2;
+  atomic_store32(&lck->rdt_group_refresh[group], true, mo_AcquireRelease);
+  atomic_store32(&lck->rdt_refresh_flag, true, mo_AcquireRelease);
+}
@@ -25,7 +25,10 @@
 #include <array>
 #include <atomic>
 #include <cctype> // for isxdigit(), etc
+#include <condition_variable>
+#include <mutex>
 #include <system_error>
+#include <thread>
 
 namespace {
 
@@ -1462,15 +1465,42 @@ txn_managed txn::start_nested() {
   return txn_managed(nested);
 }
 
+#if defined(__cpp_lib_memory_resource) && __cpp_lib_memory_resource >= 201603L && _GLIBCXX_USE_CXX11_ABI
+struct txn_managed::scratch : public ::std::pmr::monotonic_buffer_resource {
+  /* the first block is embedded to avoid an extra allocation for a few small buffers */
+  alignas(::std::max_align_t) char initial[4096 - 128];
+  scratch() : monotonic_buffer_resource(initial, sizeof(initial), ::std::pmr::get_default_resource()) {}
+};
+
+::std::pmr::memory_resource *txn_managed::scratch_resource() {
+  if (MDBX_UNLIKELY(!handle_))
+    MDBX_CXX20_UNLIKELY error::throw_exception(MDBX_BAD_TXN);
+  if (!scratch_)
+    scratch_ = new scratch();
+  return scratch_;
+}
+
+void txn_managed::release_scratch() noexcept {
+  delete scratch_;
+  scratch_ = nullptr;
+}
+#else
+void txn_managed::release_scratch() noexcept { assert(scratch_ == nullptr); }
+#endif /* __cpp_lib_memory_resource >= 201603L */
+
 txn_managed::~txn_managed() noexcept {
   if (MDBX_UNLIKELY(handle_))
     MDBX_CXX20_UNLIKELY error::success_or_panic(::mdbx_txn_abort(handle_), "mdbx::~txn", "mdbx_txn_abort");
+  release_scratch();
 }
 
 void txn_managed::abort() {
   const error err = static_cast<MDBX_error_t>(::mdbx_txn_abort(handle_));
   if (MDBX_LIKELY(err.code() != MDBX_THREAD_MISMATCH))
-    MDBX_CXX20_LIKELY handle_ = nullptr;
+    MDBX_CXX20_LIKELY {
+      handle_ = nullptr;
+      release_scratch();
+    }
   if (MDBX_UNLIKELY(err.code() != MDBX_SUCCESS))
     MDBX_CXX20_UNLIKELY err.throw_exception();
 }
@@ -1478,7 +1508,10 @@ void txn_managed::abort() {
 void txn_managed::commit() {
   const error err = static_cast<MDBX_error_t>(::mdbx_txn_commit(handle_));
   if (MDBX_LIKELY(err.code() != MDBX_THREAD_MISMATCH))
-    MDBX_CXX20_LIKELY handle_ = nullptr;
+    MDBX_CXX20_LIKELY {
+      handle_ = nullptr;
+      release_scratch();
+    }
   if (MDBX_UNLIKELY(err.code() != MDBX_SUCCESS))
     MDBX_CXX20_UNLIKELY err.throw_exception();
 }
@@ -1486,7 +1519,10 @@ void txn_managed::commit() {
 void txn_managed::commit(commit_latency *latency) {
   const error err = static_cast<MDBX_error_t>(::mdbx_txn_commit_ex(handle_, latency));
   if (MDBX_LIKELY(err.code() != MDBX_THREAD_MISMATCH))
-    MDBX_CXX20_LIKELY handle_ = nullptr;
+    MDBX_CXX20_LIKELY {
+      handle_ = nullptr;
+      release_scratch();
+    }
   if (MDBX_UNLIKELY(err.code() != MDBX_SUCCESS))
     MDBX_CXX20_UNLIKELY err.throw_exception();
 }
@@ -1499,6 +1535,139 @@ void txn_managed::commit_embark_read() {
 
 //------------------------------------------------------------------------------
 
+struct write_queue::state {
+  ::mdbx::env env;
+  const options params;
+  ::std::mutex mutex;
+  ::std::condition_variable wakeup;
+  job *head{nullptr}, *tail{nullptr};
+  bool stopping{false};
+  ::std::thread writer;
+  state(const ::mdbx::env &env, const options &params) : env(env), params(params) {}
+};
+
+write_queue::job::~job() noexcept {}
+
+write_queue::write_queue(const ::mdbx::env &env, const options &params) : state_(new state(env, params)) {
+  try {
+    state_->writer = ::std::thread(&write_queue::worker, this);
+  } catch (...) {
+    delete state_;
+    throw;
+  }
+}
+
+write_queue::~write_queue() noexcept {
+  stop();
+  delete state_;
+}
+
+void write_queue::stop() noexcept {
+  {
+    ::std::lock_guard<::std::mutex> guard(state_->mutex);
+    state_->stopping = true;
+  }
+  state_->wakeup.notify_all();
+  /* the writer thread could not wait for itself, e.g. when stop() is called
+   * from the resumed coroutine */
+  if (state_->writer.joinable() && state_->writer.get_id() != ::std::this_thread::get_id())
+    state_->writer.join();
+}
+
+void write_queue::submit(job *job) noexcept {
+  assert(job && !job->next_);
+  {
+    ::std::lock_guard<::std::mutex> guard(state_->mutex);
+    if (MDBX_LIKELY(!state_->stopping))
+      MDBX_CXX20_LIKELY {
+        if (state_->tail)
+          state_->tail->next_ = job;
+        else
+          state_->head = job;
+        state_->tail = job;
+        state_->wakeup.notify_one();
+        return;
+      }
+  }
+
+  try {
+    error::throw_exception(MDBX_EPERM);
+  } catch (...) {
+    job->failure_ = ::std::current_exception();
+  }
+  job->complete();
+}
+
+void write_queue::worker() noexcept {
+  ::std::unique_lock<::std::mutex> lock(state_->mutex);
+  for (;;) {
+    state_->wakeup.wait(lock, [this] { return state_->head || state_->stopping; });
+    job *const batch = state_->head;
+    if (!batch)
+      return;
+    job *last = batch;
+    for (size_t n = 1; n < state_->params.max_batch && last->next_; ++n)
+      last = last->next_;
+    state_->head = last->next_;
+    if (!state_->head)
+      state_->tail = nullptr;
+    last->next_ = nullptr;
+
+    lock.unlock();
+    run(batch);
+    lock.lock();
+  }
+}
+
+void write_queue::run(job *batch) noexcept {
+  while (batch) {
+    job *failed = nullptr;
+    ::std::exception_ptr failure;
+    try {
+      txn_managed txn = state_->env.start_write();
+      for (job *it = batch; it && !failed; it = it->next_)
+        try {
+          it->execute(txn);
+        } catch (...) {
+          it->failure_ = ::std::current_exception();
+          failed = it;
+        }
+      if (failed)
+        txn.abort();
+      else {
+        txn.commit();
+        if (state_->params.durable)
+          state_->env.sync_to_disk();
+      }
+    } catch (...) {
+      failure = ::std::current_exception();
+    }
+
+    if (failed && !failure) {
+      /* complete the failed closure and retry the rest of batch */
+      job **ptr = &batch;
+      while (*ptr != failed)
+        ptr = &(*ptr)->next_;
+      *ptr = failed->next_;
+      failed->next_ = nullptr;
+      failed->complete();
+      continue;
+    }
+
+    for (job *it = batch; it;) {
+      job *const next = it->next_;
+      it->next_ = nullptr;
+      if (failure && !it->failure_)
+        it->failure_ = failure;
+      it->complete();
+      it = next;
+    }
+    batch = nullptr;
+  }
+}
+
+//------------------------------------------------------------------------------
+
 __cold bool txn::drop_map(const char *name, bool throw_if_absent) {
   map_handle map;
   const int err = ::mdbx_dbi_open(handle_, name, MDBX_DB_ACCEDE, &map.dbi);
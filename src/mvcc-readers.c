@@ -3,11 +3,78 @@
 
 #include "internals.h"
 
-bsr_t mvcc_bind_slot(MDBX_env *env) {
+/* Пытается захватить свободный слот в таблице читателей без блокировки,
+ * посредством CAS(slot->pid, 0, env->pid). Просмотр начинается с позиции
+ * определяемой номером текущего процессора (либо потока), что рассредотачивает
+ * одновременно стартующие потоки по разным слотам и линиям кэша. */
+static reader_slot_t *rdt_claim_slot(MDBX_env *env, const size_t nreaders, const size_t hint, const uint64_t tid) {
+  lck_t *const lck = env->lck;
+  const uint32_t pid = env->pid;
+  for (size_t i = 0, n = hint % nreaders; i < nreaders; ++i) {
+    reader_slot_t *const slot = &lck->rdt[n];
+    if (atomic_load32(&slot->pid, mo_Relaxed) == 0 && atomic_cas32(&slot->pid, 0, pid)) {
+      /* Слот захвачен, но в нём могут быть устаревшие txnid и tid от прежнего
+       * владельца. Это допустимо: txnid будет сброшен прямо сейчас, а его
+       * устаревшее значение может лишь временно задержать переработку
+       * страниц, т.е. является консервативным. */
+      safe64_reset(&slot->txnid, true);
+      atomic_store64(&slot->tid, tid, mo_AcquireRelease);
+      lck_rdt_changed(lck, slot);
+      return slot;
+    }
+    n = (n + 1 < nreaders) ? n + 1 : 0;
+  }
+  return nullptr;
+}
+
+static bsr_t bind_slot_done(MDBX_env *env, reader_slot_t *slot, const bool sticky) {
+  bsr_t result = {MDBX_SUCCESS, slot};
+  if (likely(sticky && (env->flags & ENV_TXKEY))) {
+    eASSERT(env, env->registered_reader_pid == env->pid);
+    thread_rthc_set(env->me_txkey, result.slot);
+  }
+  return result;
+}
+
+/* Для не-привязанных к потокам слотов (sticky == false) в tid записывается
+ * ноль, а сам слот не запоминается в TLS. Такие слоты используются как при
+ * MDBX_NOSTICKYTHREADS, так и для удержания разделяемых снимков MDBX_snapshot. */
+bsr_t mvcc_bind_slot(MDBX_env *env, const bool sticky) {
   eASSERT(env, env->lck_mmap.lck);
+  eASSERT(env, !sticky || !(env->flags & MDBX_NOSTICKYTHREADS));
   eASSERT(env, env->lck->magic_and_version == MDBX_LOCK_MAGIC);
   eASSERT(env, env->lck->os_and_format == MDBX_LOCK_FORMAT);
 
+  const size_t hint = osal_cpu_hint();
+  const uint64_t tid = sticky ? osal_thread_self() : 0;
+  if (likely(env->registered_reader_pid == env->pid && !(env->flags & ENV_FATAL_ERROR) && env->dxb_mmap.base)) {
+    /* Fast path: claim a free slot without acquiring the readers table lock,
+     * which is only needed to extend the table or to cleanup dead readers. */
+#if defined(_WIN32) || defined(_WIN64)
+    /* same as lck_rdt_lock() to be coherent with osal_suspend_threads_before_remap() */
+    imports.srwl_AcquireShared(&env->remap_guard);
+#endif /* Windows */
+    const size_t nreaders = atomic_load32(&env->lck->rdt_length, mo_AcquireRelease);
+    reader_slot_t *slot = nreaders ? rdt_claim_slot(env, nreaders, hint, tid) : nullptr;
+#if defined(_WIN32) || defined(_WIN64)
+    imports.srwl_ReleaseShared(&env->remap_guard);
+#else
+    if (slot) {
+      /* The dxb_resize() with a remap that could move the mapping checks for
+       * reader slots of this process while holding the readers table lock.
+       * So here is a Dekker-style handshake: either dxb_resize() sees the
+       * claimed slot, or we see the pending remap and retreat to slow path. */
+      osal_memory_barrier();
+      if (unlikely(atomic_load32(&env->remap_pending, mo_AcquireRelease))) {
+        atomic_store32(&slot->pid, 0, mo_AcquireRelease);
+        slot = nullptr;
+      }
+    }
+#endif /* Windows */
+    if (likely(slot))
+      return bind_slot_done(env, slot, sticky);
+  }
+
   bsr_t result = {lck_rdt_lock(env), nullptr};
   if (unlikely(MDBX_IS_ERROR(result.err)))
     return result;
@@ -31,44 +98,70 @@ bsr_t mvcc_bind_slot(MDBX_env *env) {
     env->registered_reader_pid = env->pid;
   }
 
-  result.err = MDBX_SUCCESS;
-  size_t slot, nreaders;
   while (1) {
-    nreaders = env->lck->rdt_length.weak;
-    for (slot = 0; slot < nreaders; slot++)
-      if (!atomic_load32(&env->lck->rdt[slot].pid, mo_AcquireRelease))
-        break;
+    /* Only the holder of the readers table lock could extend it,
+     * but the existing slots could be claimed lock-free concurrently. */
+    const size_t nreaders = env->lck->rdt_length.weak;
+    result.slot = nreaders ? rdt_claim_slot(env, nreaders, hint, tid) : nullptr;
+    if (result.slot)
+      break;
 
-    if (likely(slot < env->max_readers))
+    if (likely(nreaders < env->max_readers)) {
+      result.slot = &env->lck->rdt[nreaders];
+      /* Claim the new reader slot, carefully since other code
+       * uses the reader table un-mutexed: First reset the
+       * slot, next publish it in lck->rdt_length.  After
+       * that, it is safe for mdbx_env_close() to touch it. */
+      safe64_reset(&result.slot->txnid, true);
+      result.slot->tid.weak = tid;
+      atomic_store32(&result.slot->pid, env->pid, mo_AcquireRelease);
+      atomic_store32(&env->lck->rdt_length, (uint32_t)nreaders + 1, mo_AcquireRelease);
+      lck_rdt_changed(env->lck, result.slot);
       break;
+    }
 
     result.err = mvcc_cleanup_dead(env, true, nullptr);
     if (result.err != MDBX_RESULT_TRUE) {
       lck_rdt_unlock(env);
       result.err = (result.err == MDBX_SUCCESS) ? MDBX_READERS_FULL : result.err;
+      result.slot = nullptr;
       return result;
     }
   }
-
-  result.slot = &env->lck->rdt[slot];
-  /* Claim the reader slot, carefully since other code
-   * uses the reader table un-mutexed: First reset the
-   * slot, next publish it in lck->rdt_length.  After
-   * that, it is safe for mdbx_env_close() to touch it.
-   * When it will be closed, we can finally claim it. */
-  atomic_store32(&result.slot->pid, 0, mo_AcquireRelease);
-  safe64_reset(&result.slot->txnid, true);
-  if (slot == nreaders)
-    env->lck->rdt_length.weak = (uint32_t)++nreaders;
-  result.slot->tid.weak = (env->flags & MDBX_NOSTICKYTHREADS) ? 0 : osal_thread_self();
-  atomic_store32(&result.slot->pid, env->pid, mo_AcquireRelease);
   lck_rdt_unlock(env);
+  return bind_slot_done(env, result.slot, sticky);
+}
 
-  if (likely(env->flags & ENV_TXKEY)) {
-    eASSERT(env, env->registered_reader_pid == env->pid);
-    thread_rthc_set(env->me_txkey, result.slot);
+/* Scans the given group of slots of the reader table and returns the oldest
+ * txnid of the group, or INVALID_TXNID if there are no active readers. */
+static txnid_t rdt_group_oldest(MDBX_env *const env, const size_t begin, const size_t end, const txnid_t prev_oldest,
+                                const txnid_t steady) {
+  const uint32_t nothing_changed = MDBX_STRING_TETRAD("None");
+  lck_t *const lck = env->lck_mmap.lck;
+  txnid_t group_oldest = INVALID_TXNID;
+  for (size_t i = begin; i < end; ++i) {
+    const uint32_t pid = atomic_load32(&lck->rdt[i].pid, mo_AcquireRelease);
+    if (!pid)
+      continue;
+    jitter4testing(true);
+
+    const txnid_t rtxn = safe64_read(&lck->rdt[i].txnid);
+    if (unlikely(rtxn < prev_oldest)) {
+      if (unlikely(nothing_changed == atomic_load32(&lck->rdt_refresh_flag, mo_AcquireRelease)) &&
+          safe64_reset_compare(&lck->rdt[i].txnid, rtxn)) {
+        NOTICE("kick stuck reader[%zu of %zu].pid_%u %" PRIaTXN " < prev-oldest %" PRIaTXN ", steady-txn %" PRIaTXN, i,
+               (size_t)atomic_load32(&lck->rdt_length, mo_Relaxed), pid, rtxn, prev_oldest, steady);
+      }
+      continue;
+    }
+
+    if (rtxn < group_oldest) {
+      group_oldest = rtxn;
+      if (!MDBX_DEBUG && !MDBX_FORCE_ASSERTIONS && group_oldest == prev_oldest)
+        break;
+    }
   }
-  return result;
+  return group_oldest;
 }
 
 __hot txnid_t mvcc_shapshot_oldest(MDBX_env *const env, const txnid_t steady) {
@@ -85,31 +178,39 @@ __hot txnid_t mvcc_shapshot_oldest(MDBX_env *const env, const txnid_t steady) {
   const txnid_t prev_oldest = atomic_load64(&lck->cached_oldest, mo_AcquireRelease);
   eASSERT(env, steady >= prev_oldest);
 
+  /* Флаги изменений сбрасываются посредством CAS, который является полным барьером.
+   * Поэтому либо будут видны изменения в слотах читателя, опубликовавшего флаг,
+   * либо его флаг останется взведенным и вызовет повторный просмотр. Сброс флага
+   * простой записью мог затереть уведомление читателя, с кешированием слишком
+   * нового rdt_group_oldest и последующей переработкой страниц его снимка. */
   txnid_t new_oldest = prev_oldest;
-  while (nothing_changed != atomic_load32(&lck->rdt_refresh_flag, mo_AcquireRelease)) {
-    lck->rdt_refresh_flag.weak = nothing_changed;
+  for (;;) {
+    const uint32_t changed = atomic_load32(&lck->rdt_refresh_flag, mo_AcquireRelease);
+    if (changed == nothing_changed)
+      break;
+    if (!atomic_cas32(&lck->rdt_refresh_flag, changed, nothing_changed))
+      continue;
     jitter4testing(false);
     const size_t snap_nreaders = atomic_load32(&lck->rdt_length, mo_AcquireRelease);
     new_oldest = steady;
 
-    for (size_t i = 0; i < snap_nreaders; ++i) {
-      const uint32_t pid = atomic_load32(&lck->rdt[i].pid, mo_AcquireRelease);
-      if (!pid)
-        continue;
-      jitter4testing(true);
-
-      const txnid_t rtxn = safe64_read(&lck->rdt[i].txnid);
-      if (unlikely(rtxn < prev_oldest)) {
-        if (unlikely(nothing_changed == atomic_load32(&lck->rdt_refresh_flag, mo_AcquireRelease)) &&
-            safe64_reset_compare(&lck->rdt[i].txnid, rtxn)) {
-          NOTICE("kick stuck reader[%zu of %zu].pid_%u %" PRIaTXN " < prev-oldest %" PRIaTXN ", steady-txn %" PRIaTXN,
-                 i, snap_nreaders, pid, rtxn, prev_oldest, steady);
-        }
-        continue;
+    /* Rescan only the changed groups of slots, but use the cached oldest
+     * txnid for other ones. The cached value less than prev_oldest means
+     * the group contains a stuck reader which should be kicked. */
+    for (size_t group = 0, begin = 0; begin < snap_nreaders; ++group, begin += (size_t)1 << MDBX_RDT_GROUP_LN2) {
+      txnid_t group_oldest = atomic_load64(&lck->rdt_group_oldest[group], mo_Relaxed);
+      const uint32_t group_changed = atomic_load32(&lck->rdt_group_refresh[group], mo_AcquireRelease);
+      if (nothing_changed != group_changed || unlikely(group_oldest < prev_oldest)) {
+        if (nothing_changed != group_changed)
+          /* при неудаче флаг остается взведенным до следующего просмотра */
+          atomic_cas32(&lck->rdt_group_refresh[group], group_changed, nothing_changed);
+        const size_t end = begin + ((size_t)1 << MDBX_RDT_GROUP_LN2);
+        group_oldest = rdt_group_oldest(env, begin, (end < snap_nreaders) ? end : snap_nreaders, prev_oldest, steady);
+        atomic_store64(&lck->rdt_group_oldest[group], group_oldest, mo_Relaxed);
       }
 
-      if (rtxn < new_oldest) {
-        new_oldest = rtxn;
+      if (group_oldest < new_oldest) {
+        new_oldest = group_oldest;
         if (!MDBX_DEBUG && !MDBX_FORCE_ASSERTIONS && new_oldest == prev_oldest)
           break;
       }
@@ -280,7 +381,7 @@ __cold int mvcc_cleanup_dead(MDBX_env *env, int rdt_locked, int *dead) {
       if (lck->rdt[ii].pid.weak == pid) {
         DEBUG("clear stale reader pid %" PRIuPTR " txn %" PRIaTXN, (size_t)pid, lck->rdt[ii].txnid.weak);
         atomic_store32(&lck->rdt[ii].pid, 0, mo_Relaxed);
-        atomic_store32(&lck->rdt_refresh_flag, true, mo_AcquireRelease);
+        lck_rdt_changed(lck, &lck->rdt[ii]);
         count++;
       }
     }
@@ -302,6 +403,7 @@ __cold int mvcc_cleanup_dead(MDBX_env *env, int rdt_locked, int *dead) {
 
 __cold bool mvcc_kick_laggards(MDBX_env *env, const txnid_t straggler) {
   DEBUG("DB size maxed out by reading #%" PRIaTXN, straggler);
+  MDBX_MAYBE_UNUSED const uint64_t usdt_begin = usdt_monotime();
   osal_memory_fence(mo_AcquireRelease, false);
   MDBX_hsr_func *const callback = env->hsr_callback;
   txnid_t oldest = 0;
@@ -309,13 +411,18 @@ __cold bool mvcc_kick_laggards(MDBX_env *env, const txnid_t straggler) {
   int retry = 0;
   do {
     const txnid_t steady = env->txn->wr.troika.txnid[env->txn->wr.troika.prefer_steady];
+    lck_t *const lck = env->lck_mmap.lck;
+    if (lck) {
+      /* force full rescan, i.e. don't rely on the summary of reader table */
+      for (size_t group = 0; group < ARRAY_LENGTH(lck->rdt_group_refresh); ++group)
+        lck->rdt_group_refresh[group].weak = true;
+    }
     env->lck->rdt_refresh_flag.weak = /* force refresh */ true;
     oldest = mvcc_shapshot_oldest(env, steady);
     eASSERT(env, oldest < env->basal_txn->txnid);
     eASSERT(env, oldest >= straggler);
     eASSERT(env, oldest >= env->lck->cached_oldest.weak);
 
-    lck_t *const lck = env->lck_mmap.lck;
     if (oldest == steady || oldest > straggler || /* without-LCK mode */ !lck)
       break;
 
@@ -393,6 +500,7 @@ __cold bool mvcc_kick_laggards(MDBX_env *env, const txnid_t straggler) {
         safe64_reset(&stucked->txnid, true);
         atomic_store64(&stucked->tid, 0, mo_Relaxed);
         atomic_store32(&stucked->pid, 0, mo_AcquireRelease);
+        lck_rdt_changed(lck, stucked);
       }
     } else if (!notify_eof_of_loop) {
 #if MDBX_ENABLE_PROFGC
@@ -410,5 +518,6 @@ __cold bool mvcc_kick_laggards(MDBX_env *env, const txnid_t straggler) {
       NOTICE("hsr-kick: done turn %" PRIaTXN " -> %" PRIaTXN " +%" PRIaTXN, straggler, oldest, turn);
     callback(env, env->txn, 0, 0, straggler, (turn < UINT_MAX) ? (unsigned)turn : UINT_MAX, 0, -retry);
   }
+  USDT_PROBE5(kick_laggards, env->txn->txnid, straggler, oldest, retry, usdt_ns_since(usdt_begin));
   return oldest > straggler;
 }
@@ -99,6 +99,29 @@
 #error MDBX_ENABLE_PGOP_STAT must be defined as 0 or 1
 #endif /* MDBX_ENABLE_PGOP_STAT */
 
+/** Controls gathering per-table operation counters, see mdbx_dbi_opstat(). */
+#ifndef MDBX_ENABLE_DBI_OPSTAT
+#define MDBX_ENABLE_DBI_OPSTAT 0
+#elif !(MDBX_ENABLE_DBI_OPSTAT == 0 || MDBX_ENABLE_DBI_OPSTAT == 1)
+#error MDBX_ENABLE_DBI_OPSTAT must be defined as 0 or 1
+#endif /* MDBX_ENABLE_DBI_OPSTAT */
+
+/** Controls support for latency histograms of reading in the LCK,
+ * see mdbx_env_latency_hist(). Changes the LCK layout. */
+#ifndef MDBX_ENABLE_LATENCY_HIST
+#define MDBX_ENABLE_LATENCY_HIST 0
+#elif !(MDBX_ENABLE_LATENCY_HIST == 0 || MDBX_ENABLE_LATENCY_HIST == 1)
+#error MDBX_ENABLE_LATENCY_HIST must be defined as 0 or 1
+#endif /* MDBX_ENABLE_LATENCY_HIST */
+
+/** Controls USDT static tracepoints for bpftrace/perf/SystemTap,
+ * requires the `<sys/sdt.h>`. See `src/usdt.h` for details. */
+#ifndef MDBX_ENABLE_USDT
+#define MDBX_ENABLE_USDT 0
+#elif !(MDBX_ENABLE_USDT == 0 || MDBX_ENABLE_USDT == 1)
+#error MDBX_ENABLE_USDT must be defined as 0 or 1
+#endif /* MDBX_ENABLE_USDT */
+
 /** Controls using Unix' mincore() to determine whether DB-pages
  * are resident in memory. */
 #ifndef MDBX_USE_MINCORE
@@ -205,6 +228,22 @@
 #error MDBX_ENVCOPY_WRITEBUF must be defined in range 65536..1073741824 and be multiple of 65536
 #endif /* MDBX_ENVCOPY_WRITEBUF */
 
+/** Max number of threads (including the calling one) used for the compacting
+ * copy with \ref MDBX_CP_PARALLEL. */
+#ifndef MDBX_ENVCOPY_THREADS
+#define MDBX_ENVCOPY_THREADS 4
+#elif MDBX_ENVCOPY_THREADS < 1 || MDBX_ENVCOPY_THREADS > 256
+#error MDBX_ENVCOPY_THREADS must be defined in range 1..256
+#endif /* MDBX_ENVCOPY_THREADS */
+
+/** Max number of threads (including the calling one) used for the integrity
+ * check with \ref MDBX_CHK_PARALLEL. */
+#ifndef MDBX_ENVCHK_THREADS
+#define MDBX_ENVCHK_THREADS 4
+#elif MDBX_ENVCHK_THREADS < 1 || MDBX_ENVCHK_THREADS > 256
+#error MDBX_ENVCHK_THREADS must be defined in range 1..256
+#endif /* MDBX_ENVCHK_THREADS */
+
 /** Forces assertion checking. */
 #ifndef MDBX_FORCE_ASSERTIONS
 #define MDBX_FORCE_ASSERTIONS 0
@@ -290,6 +329,10 @@
 /** POSIX-2008 Robust Mutexes for \ref MDBX_LOCKING */
 #define MDBX_LOCKING_POSIX2008 2008
 
+/** Linux futex-based FIFO lock with robust owner-death detection
+ * for \ref MDBX_LOCKING */
+#define MDBX_LOCKING_FUTEX 1995
+
 /** Advanced: Choices the locking implementation (autodetection by default). */
 #if defined(_WIN32) || defined(_WIN64)
 #define MDBX_LOCKING MDBX_LOCKING_WIN32FILES
@@ -317,6 +360,9 @@
 #else
 #define MDBX_LOCKING_CONFIG MDBX_STRINGIFY(MDBX_LOCKING)
 #endif /* MDBX_LOCKING */
+#if MDBX_LOCKING == MDBX_LOCKING_FUTEX && !defined(__linux__) && !defined(__gnu_linux__)
+#error "MDBX_LOCKING_FUTEX is available only on Linux"
+#endif /* MDBX_LOCKING_FUTEX */
 #endif /* !Windows */
 
 /** Advanced: Using POSIX OFD-locks (autodetection by default). */
@@ -1472,6 +1472,30 @@ int osal_write(mdbx_filehandle_t fd, const void *buf, size_t bytes) {
   }
 }
 
+int osal_read(mdbx_filehandle_t fd, void *buf, size_t bytes) {
+  while (true) {
+#if defined(_WIN32) || defined(_WIN64)
+    DWORD got;
+    if (unlikely(!ReadFile(fd, buf, likely(bytes <= MAX_WRITE) ? (DWORD)bytes : MAX_WRITE, &got, nullptr)))
+      return (int)GetLastError();
+#else
+    const intptr_t got = read(fd, buf, likely(bytes <= MAX_WRITE) ? bytes : MAX_WRITE);
+    if (got < 0) {
+      const int rc = errno;
+      if (rc != EINTR)
+        return rc;
+      continue;
+    }
+#endif
+    if (likely(bytes == (size_t)got))
+      return MDBX_SUCCESS;
+    if (got == 0)
+      return MDBX_ENODATA;
+    bytes -= got;
+    buf = ptr_disp(buf, got);
+  }
+}
+
 int osal_pwritev(mdbx_filehandle_t fd, struct iovec *iov, size_t sgvcnt, uint64_t offset) {
   size_t expected = 0;
   for (size_t i = 0; i < sgvcnt; ++i)
@@ -2703,6 +2727,20 @@ uint32_t osal_monotime_to_16dot16(uint64_t monotime) {
   return ret;
 }
 
+uint64_t osal_monotime_to_ns(uint64_t monotime) {
+#if defined(_WIN32) || defined(_WIN64)
+  const uint64_t ratio = performance_frequency.QuadPart;
+#elif defined(__APPLE__) || defined(__MACH__)
+  const uint64_t ratio = ratio_16dot16_to_monotine;
+#else
+  return monotime;
+#endif
+#if defined(_WIN32) || defined(_WIN64) || defined(__APPLE__) || defined(__MACH__)
+  /* деление с остатком, чтобы избежать переполнения при умножении */
+  return monotime / ratio * UINT64_C(1000000000) + monotime % ratio * UINT64_C(1000000000) / ratio;
+#endif
+}
+
 uint64_t osal_monotime(void) {
 #if defined(_WIN32) || defined(_WIN64)
   LARGE_INTEGER counter;
@@ -427,6 +427,7 @@ MDBX_INTERNAL int osal_pwritev(mdbx_filehandle_t fd, struct iovec *iov, size_t s
 MDBX_INTERNAL int osal_pread(mdbx_filehandle_t fd, void *buf, size_t count, uint64_t offset);
 MDBX_INTERNAL int osal_pwrite(mdbx_filehandle_t fd, const void *buf, size_t count, uint64_t offset);
 MDBX_INTERNAL int osal_write(mdbx_filehandle_t fd, const void *buf, size_t count);
+MDBX_INTERNAL int osal_read(mdbx_filehandle_t fd, void *buf, size_t count);
 
 MDBX_INTERNAL int osal_thread_create(osal_thread_t *thread, THREAD_RESULT(THREAD_CALL *start_routine)(void *),
                                      void *arg);
@@ -521,6 +522,24 @@ MDBX_MAYBE_UNUSED static inline uintptr_t osal_thread_self(void) {
   return (uintptr_t)thunk;
 }
 
+/* Номер процессора на котором выполняется текущий поток, либо некое
+ * производное от идентификатора потока, если номер процессора не доступен.
+ * Используется только как подсказка для снижения конкуренции за разделяемые
+ * ресурсы, поэтому не требует точности. */
+MDBX_MAYBE_UNUSED static inline size_t osal_cpu_hint(void) {
+#if defined(_WIN32) || defined(_WIN64)
+  return GetCurrentProcessorNumber();
+#else
+#if __GLIBC_PREREQ(2, 6) && defined(_GNU_SOURCE)
+  const int cpu = sched_getcpu();
+  if (likely(cpu >= 0))
+    return (size_t)cpu;
+#endif /* sched_getcpu() */
+  const uint64_t tid = osal_thread_self();
+  return (size_t)((tid ^ tid >> 29) * UINT64_C(0x9E3779B97F4A7C15) >> 40);
+#endif /* Windows */
+}
+
 #if !defined(_WIN32) && !defined(_WIN64)
 #if defined(__ANDROID_API__) || defined(ANDROID) || defined(BIONIC)
 MDBX_INTERNAL int osal_check_tid4bionic(void);
@@ -538,6 +557,7 @@ MDBX_INTERNAL uint64_t osal_monotime(void);
 MDBX_INTERNAL uint64_t osal_cputime(size_t *optional_page_faults);
 MDBX_INTERNAL uint64_t osal_16dot16_to_monotime(uint32_t seconds_16dot16);
 MDBX_INTERNAL uint32_t osal_monotime_to_16dot16(uint64_t monotime);
+MDBX_MAYBE_UNUSED MDBX_INTERNAL uint64_t osal_monotime_to_ns(uint64_t monotime);
 
 MDBX_MAYBE_UNUSED static inline uint32_t osal_monotime_to_16dot16_noUnderflow(uint64_t monotime) {
   uint32_t seconds_16dot16 = osal_monotime_to_16dot16(monotime);
@@ -25,6 +25,9 @@ pgr_t page_new(MDBX_cursor *mc, const unsigned flags) {
 #if MDBX_ENABLE_PGOP_STAT
   mc->txn->env->lck->pgops.newly.weak += 1;
 #endif /* MDBX_ENABLE_PGOP_STAT */
+#if MDBX_ENABLE_DBI_OPSTAT
+  opstat_add(&cursor_opstat(mc)->newly, 1);
+#endif /* MDBX_ENABLE_DBI_OPSTAT */
 
   STATIC_ASSERT(P_BRANCH == 1);
   const unsigned is_branch = flags & P_BRANCH;
@@ -53,6 +56,11 @@ pgr_t page_new_large(MDBX_cursor *mc, const size_t npages) {
 #if MDBX_ENABLE_PGOP_STAT
   mc->txn->env->lck->pgops.newly.weak += npages;
 #endif /* MDBX_ENABLE_PGOP_STAT */
+#if MDBX_ENABLE_DBI_OPSTAT
+  dbi_opstat_t *const opstat = cursor_opstat(mc);
+  opstat_add(&opstat->newly, npages);
+  opstat_add(&opstat->large, npages);
+#endif /* MDBX_ENABLE_DBI_OPSTAT */
 
   mc->tree->large_pages += (pgno_t)npages;
   ret.page->pages = (pgno_t)npages;
@@ -130,6 +138,7 @@ __cold pgr_t __must_check_result page_unspill(MDBX_txn *const txn, const page_t
 #if MDBX_ENABLE_PGOP_STAT
     txn->env->lck->pgops.unspill.weak += npages;
 #endif /* MDBX_ENABLE_PGOP_STAT */
+    USDT_PROBE3(unspill, txn->txnid, mp->pgno, npages);
     ret.page->flags |= (scan == txn) ? 0 : P_SPILLED;
     ret.err = MDBX_SUCCESS;
     return ret;
@@ -156,6 +165,7 @@ __hot int page_touch_modifable(MDBX_txn *txn, const page_t *const mp) {
 #if MDBX_ENABLE_PGOP_STAT
     txn->env->lck->pgops.unspill.weak += 1;
 #endif /* MDBX_ENABLE_PGOP_STAT */
+    USDT_PROBE3(unspill, txn->txnid, mp->pgno, 1);
     return page_dirty(txn, (page_t *)mp, 1);
   }
 
@@ -207,6 +217,9 @@ __hot int page_touch_unmodifable(MDBX_txn *txn, MDBX_cursor *mc, const page_t *c
 #if MDBX_ENABLE_PGOP_STAT
     txn->env->lck->pgops.cow.weak += 1;
 #endif /* MDBX_ENABLE_PGOP_STAT */
+#if MDBX_ENABLE_DBI_OPSTAT
+    opstat_add(&cursor_opstat(mc)->cow, 1);
+#endif /* MDBX_ENABLE_DBI_OPSTAT */
     page_copy(np, mp, txn->env->ps);
     np->pgno = pgno;
     np->txnid = txn->front_txnid;
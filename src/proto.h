@@ -10,8 +10,13 @@
 /* audit.c */
 MDBX_INTERNAL int audit_ex(MDBX_txn *txn, size_t retired_stored, bool dont_filter_gc);
 
+/* api-copy.c */
+MDBX_INTERNAL int delta_apply(mdbx_filehandle_t dxb_fd, mdbx_filehandle_t delta_fd);
+MDBX_INTERNAL int pageship_commit(MDBX_env *env);
+MDBX_INTERNAL void pageship_stop(MDBX_env *env);
+
 /* mvcc-readers.c */
-MDBX_INTERNAL bsr_t mvcc_bind_slot(MDBX_env *env);
+MDBX_INTERNAL bsr_t mvcc_bind_slot(MDBX_env *env, const bool sticky);
 MDBX_MAYBE_UNUSED MDBX_INTERNAL pgno_t mvcc_largest_this(MDBX_env *env, pgno_t largest);
 MDBX_INTERNAL txnid_t mvcc_shapshot_oldest(MDBX_env *const env, const txnid_t steady);
 MDBX_INTERNAL pgno_t mvcc_snapshot_largest(const MDBX_env *env, pgno_t last_used_page);
@@ -26,6 +31,7 @@ enum resize_mode { implicit_grow, impilict_shrink, explicit_resize };
 MDBX_INTERNAL int __must_check_result dxb_resize(MDBX_env *const env, const pgno_t used_pgno, const pgno_t size_pgno,
                                                  pgno_t limit_pgno, const enum resize_mode mode);
 MDBX_INTERNAL int dxb_set_readahead(const MDBX_env *env, const pgno_t edge, const bool enable, const bool force_whole);
+MDBX_INTERNAL void dxb_prefetch(const MDBX_env *env, const pgno_t pgno, const size_t npages);
 MDBX_INTERNAL int __must_check_result dxb_sync_locked(MDBX_env *env, unsigned flags, meta_t *const pending,
                                                       troika_t *const troika);
 #if defined(ENABLE_MEMCHECK) || defined(__SANITIZE_ADDRESS__)
@@ -85,6 +91,8 @@ MDBX_INTERNAL int txn_ro_park(MDBX_txn *txn, bool autounpark);
 MDBX_INTERNAL int txn_ro_unpark(MDBX_txn *txn);
 MDBX_INTERNAL int txn_ro_start(MDBX_txn *txn, unsigned flags);
 MDBX_INTERNAL int txn_ro_end(MDBX_txn *txn, unsigned mode);
+MDBX_INTERNAL int txn_ro_share(MDBX_txn *txn, unsigned flags);
+MDBX_INTERNAL void txn_ro_snapshot_release(MDBX_snapshot *snapshot);
 
 /* env.c */
 MDBX_INTERNAL int env_open(MDBX_env *env, mdbx_mode_t mode);
@@ -178,6 +178,7 @@ static size_t spill_gate(const MDBX_env *env, intptr_t part, const size_t total)
 __cold int spill_slowpath(MDBX_txn *const txn, MDBX_cursor *const m0, const intptr_t wanna_spill_entries,
                           const intptr_t wanna_spill_npages, const size_t need) {
   tASSERT(txn, (txn->flags & MDBX_TXN_RDONLY) == 0);
+  MDBX_MAYBE_UNUSED const uint64_t usdt_begin = usdt_monotime();
 
   int rc = MDBX_SUCCESS;
   if (unlikely(txn->wr.loose_count >=
@@ -223,6 +224,7 @@ __cold int spill_slowpath(MDBX_txn *const txn, MDBX_cursor *const m0, const intp
     txn->wr.writemap_spilled_npages += txn->wr.writemap_dirty_npages;
     txn->wr.writemap_dirty_npages = 0;
 #endif /* MDBX_AVOID_MSYNC */
+    USDT_PROBE4(spill, txn->txnid, dirty_entries, dirty_npages, usdt_ns_since(usdt_begin));
     goto done;
   }
 
@@ -406,6 +408,7 @@ __cold int spill_slowpath(MDBX_txn *const txn, MDBX_cursor *const m0, const intp
     txn->flags |= MDBX_TXN_SPILLS;
     NOTICE("spilled %u dirty-entries, %u dirty-npages, now have %zu dirty-room", spilled_entries, spilled_npages,
            txn->wr.dirtyroom);
+    USDT_PROBE4(spill, txn->txnid, spilled_entries, spilled_npages, usdt_ns_since(usdt_begin));
   } else {
     tASSERT(txn, rc == MDBX_SUCCESS);
     for (size_t i = 1; i <= dl->length; ++i) {
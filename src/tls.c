@@ -290,7 +290,7 @@ __cold void rthc_thread_dtor(void *rthc) {
     if (atomic_load32(&reader->pid, mo_Relaxed) == current_pid) {
       TRACE("==== thread 0x%" PRIxPTR ", rthc %p, cleanup", osal_thread_self(), __Wpedantic_format_voidptr(reader));
       (void)atomic_cas32(&reader->pid, current_pid, 0);
-      atomic_store32(&env->lck->rdt_refresh_flag, true, mo_Relaxed);
+      lck_rdt_changed(env->lck, reader);
     }
   }
 
@@ -378,16 +378,13 @@ __cold static int rthc_drown(MDBX_env *const env) {
     TRACE("== %s env %p pid %d, readers %p ...%p, current-pid %d", (current_pid == env->pid) ? "cleanup" : "skip",
           __Wpedantic_format_voidptr(env), env->pid, __Wpedantic_format_voidptr(begin), __Wpedantic_format_voidptr(end),
           current_pid);
-    bool cleaned = false;
     for (reader_slot_t *r = begin; r < end; ++r) {
       if (atomic_load32(&r->pid, mo_Relaxed) == current_pid) {
         atomic_store32(&r->pid, 0, mo_AcquireRelease);
         TRACE("== cleanup %p", __Wpedantic_format_voidptr(r));
-        cleaned = true;
+        lck_rdt_changed(env->lck_mmap.lck, r);
       }
     }
-    if (cleaned)
-      atomic_store32(&env->lck_mmap.lck->rdt_refresh_flag, true, mo_Relaxed);
     rc = rthc_uniq_check(&env->lck_mmap, &inprocess_neighbor);
     if (!inprocess_neighbor && env->registered_reader_pid && env->lck_mmap.fd != INVALID_HANDLE_VALUE) {
       int err = lck_rpid_clear(env);
@@ -519,7 +516,6 @@ __cold void rthc_dtor(const uint32_t current_pid) {
     reader_slot_t *const begin = &env->lck_mmap.lck->rdt[0];
     reader_slot_t *const end = &env->lck_mmap.lck->rdt[env->max_readers];
     thread_key_delete(env->me_txkey);
-    bool cleaned = false;
     for (reader_slot_t *reader = begin; reader < end; ++reader) {
       TRACE("== [%zi] = key %" PRIuPTR ", %p ... %p, rthc %p (%+i), "
             "rthc-pid %i, current-pid %i",
@@ -528,11 +524,9 @@ __cold void rthc_dtor(const uint32_t current_pid) {
       if (atomic_load32(&reader->pid, mo_Relaxed) == current_pid) {
         (void)atomic_cas32(&reader->pid, current_pid, 0);
         TRACE("== cleanup %p", __Wpedantic_format_voidptr(reader));
-        cleaned = true;
+        lck_rdt_changed(env->lck, reader);
       }
     }
-    if (cleaned)
-      atomic_store32(&env->lck->rdt_refresh_flag, true, mo_Relaxed);
   }
 
   rthc_limit = rthc_count = 0;
@@ -343,7 +343,7 @@ static const MDBX_chk_callbacks_t cb = {.check_break = check_break,
 static void usage(char *prog) {
   fprintf(stderr,
           "usage: %s "
-          "[-V] [-v] [-q] [-c] [-0|1|2] [-w] [-d] [-i] [-s table] [-u|U] dbpath\n"
+          "[-V] [-v] [-q] [-c] [-0|1|2] [-w] [-d] [-i] [-P] [-s table] [-u|U] dbpath\n"
           "  -V\t\tprint version and exit\n"
           "  -v\t\tmore verbose, could be repeated upto 9 times for extra details\n"
           "  -q\t\tbe quiet\n"
@@ -351,6 +351,7 @@ static void usage(char *prog) {
           "  -w\t\twrite-mode checking\n"
           "  -d\t\tdisable page-by-page traversal of B-tree\n"
           "  -i\t\tignore wrong order errors (for custom comparators case)\n"
+          "  -P\t\tcheck tables in parallel by several threads\n"
           "  -s table\tprocess a specific subdatabase only\n"
           "  -u\t\twarmup database before checking\n"
           "  -U\t\twarmup and try lock database pages in memory before checking\n"
@@ -441,6 +442,7 @@ int main(int argc, char *argv[]) {
                           "t"
                           "d"
                           "i"
+                          "P"
                           "s:")) != EOF;) {
     switch (i) {
     case 'V':
@@ -513,6 +515,9 @@ int main(int argc, char *argv[]) {
     case 'i':
       chk_flags |= MDBX_CHK_IGNORE_ORDER;
       break;
+    case 'P':
+      chk_flags |= MDBX_CHK_PARALLEL;
+      break;
     case 'u':
       warmup = true;
       break;
@@ -587,7 +592,8 @@ int main(int argc, char *argv[]) {
     return rc < 0 ? EXIT_FAILURE_MDBX : EXIT_FAILURE_SYS;
   }
 
-  rc = mdbx_env_set_maxdbs(env, CORE_DBS);
+  /* for parallel checking the named tables are opened by batches */
+  rc = mdbx_env_set_maxdbs(env, (chk_flags & MDBX_CHK_PARALLEL) ? 256 : CORE_DBS);
   if (rc) {
     error_fn("mdbx_env_set_maxdbs", rc);
     goto bailout;
@@ -38,22 +38,48 @@ static void signal_handler(int sig) {
 
 static void usage(const char *prog) {
   fprintf(stderr,
-          "usage: %s [-V] [-q] [-c] [-d] [-p] [-u|U] src_path [dest_path]\n"
+          "usage: %s [-V] [-q] [-c [-P]] [-d] [-p] [-u|U] [-D txnid] src_path [dest_path]\n"
+          "       %s [-V] [-q] -A [delta_path] dest_path\n"
           "  -V\t\tprint version and exit\n"
           "  -q\t\tbe quiet\n"
           "  -c\t\tenable compactification (skip unused pages)\n"
+          "  -P\t\twalk tables in parallel by several threads during compactification\n"
           "  -f\t\tforce copying even the target file exists\n"
           "  -d\t\tenforce copy to be a dynamic size DB\n"
           "  -p\t\tusing transaction parking/ousting during copying MVCC-snapshot\n"
           "    \t\tto avoid stopping recycling and overflowing the DB\n"
           "  -u\t\twarmup database before copying\n"
           "  -U\t\twarmup and try lock database pages in memory before copying\n"
+          "  -D txnid\tmake a delta of pages changed since the given transaction\n"
+          "  -A\t\tapply a delta to the dest_path copy of database\n"
           "  src_path\tsource database\n"
-          "  dest_path\tdestination (stdout if not specified)\n",
-          prog);
+          "  dest_path\tdestination (stdout if not specified)\n"
+          "  delta_path\tdelta made by -D (stdin if not specified)\n",
+          prog, prog);
   exit(EXIT_FAILURE);
 }
 
+static int open_file(const char *pathname, bool for_write, bool overwrite, mdbx_filehandle_t *fd) {
+#if defined(_WIN32) || defined(_WIN64)
+  *fd = CreateFileA(pathname, for_write ? GENERIC_WRITE : GENERIC_READ, for_write ? 0 : FILE_SHARE_READ, nullptr,
+                    for_write ? (overwrite ? CREATE_ALWAYS : CREATE_NEW) : OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL,
+                    nullptr);
+  return (*fd == INVALID_HANDLE_VALUE) ? (int)GetLastError() : MDBX_SUCCESS;
+#else
+  *fd = open(pathname, for_write ? O_WRONLY | O_CREAT | (overwrite ? O_TRUNC : O_EXCL) : O_RDONLY,
+             S_IRUSR | S_IWUSR | S_IRGRP | S_IWGRP);
+  return (*fd < 0) ? errno : MDBX_SUCCESS;
+#endif
+}
+
+static void close_file(mdbx_filehandle_t fd) {
+#if defined(_WIN32) || defined(_WIN64)
+  CloseHandle(fd);
+#else
+  close(fd);
+#endif
+}
+
 static void logger(MDBX_log_level_t level, const char *function, int line, const char *fmt, va_list args) {
   static const char *const prefixes[] = {
       "!!!fatal: ", // 0 fatal
@@ -76,7 +102,8 @@ int main(int argc, char *argv[]) {
   unsigned flags = MDBX_RDONLY;
   unsigned cpflags = 0;
   bool quiet = false;
-  bool warmup = false;
+  bool warmup = false, delta = false, apply = false;
+  uint64_t since_txnid = 0;
   MDBX_warmup_flags_t warmup_flags = MDBX_warmup_default;
 
   for (; argc > 1 && argv[1][0] == '-'; argc--, argv++) {
@@ -84,6 +111,8 @@ int main(int argc, char *argv[]) {
       flags |= MDBX_NOSUBDIR;
     else if (argv[1][1] == 'c' && argv[1][2] == '\0')
       cpflags |= MDBX_CP_COMPACT;
+    else if (argv[1][1] == 'P' && argv[1][2] == '\0')
+      cpflags |= MDBX_CP_PARALLEL;
     else if (argv[1][1] == 'd' && argv[1][2] == '\0')
       cpflags |= MDBX_CP_FORCE_DYNAMIC_SIZE;
     else if (argv[1][1] == 'p' && argv[1][2] == '\0')
@@ -92,6 +121,15 @@ int main(int argc, char *argv[]) {
       cpflags |= MDBX_CP_OVERWRITE;
     else if (argv[1][1] == 'q' && argv[1][2] == '\0')
       quiet = true;
+    else if (argv[1][1] == 'D' && argv[1][2] == '\0' && argc > 2) {
+      char *end = nullptr;
+      since_txnid = strtoull(argv[2], &end, 0);
+      if (!end || *end || end == argv[2])
+        usage(progname);
+      delta = true;
+      argc--, argv++;
+    } else if (argv[1][1] == 'A' && argv[1][2] == '\0')
+      apply = true;
     else if (argv[1][1] == 'u' && argv[1][2] == '\0')
       warmup = true;
     else if (argv[1][1] == 'U' && argv[1][2] == '\0') {
@@ -114,7 +152,7 @@ int main(int argc, char *argv[]) {
       argc = 0;
   }
 
-  if (argc < 2 || argc > 3)
+  if (argc < 2 || argc > 3 || (apply && (delta || cpflags || warmup)))
     usage(progname);
 
 #if defined(_WIN32) || defined(_WIN64)
@@ -131,13 +169,37 @@ int main(int argc, char *argv[]) {
 #endif /* !WINDOWS */
 
   if (!quiet) {
-    fprintf((argc == 2) ? stderr : stdout, "mdbx_copy %s (%s, T-%s)\nRunning for copy %s to %s...\n",
-            mdbx_version.git.describe, mdbx_version.git.datetime, mdbx_version.git.tree, argv[1],
-            (argc == 2) ? "stdout" : argv[2]);
+    if (apply)
+      fprintf(stdout, "mdbx_copy %s (%s, T-%s)\nRunning for apply delta %s to %s...\n", mdbx_version.git.describe,
+              mdbx_version.git.datetime, mdbx_version.git.tree, (argc == 2) ? "stdin" : argv[1], argv[argc - 1]);
+    else
+      fprintf((argc == 2) ? stderr : stdout, "mdbx_copy %s (%s, T-%s)\nRunning for %s %s to %s...\n",
+              mdbx_version.git.describe, mdbx_version.git.datetime, mdbx_version.git.tree, delta ? "delta" : "copy",
+              argv[1], (argc == 2) ? "stdout" : argv[2]);
     fflush(nullptr);
     mdbx_setup_debug(MDBX_LOG_NOTICE, MDBX_DBG_DONTCHANGE, logger);
   }
 
+  if (apply) {
+    mdbx_filehandle_t fd;
+    act = "opening delta";
+#if defined(_WIN32) || defined(_WIN64)
+    fd = GetStdHandle(STD_INPUT_HANDLE);
+#else
+    fd = fileno(stdin);
+#endif
+    rc = (argc == 2) ? MDBX_SUCCESS : open_file(argv[1], false, false, &fd);
+    if (rc == MDBX_SUCCESS) {
+      act = "applying delta";
+      rc = mdbx_env_apply_delta(argv[argc - 1], fd);
+      if (argc > 2)
+        close_file(fd);
+    }
+    if (rc)
+      fprintf(stderr, "%s: %s failed, error %d (%s)\n", progname, act, rc, mdbx_strerror(rc));
+    return rc ? EXIT_FAILURE : EXIT_SUCCESS;
+  }
+
   act = "opening environment";
   rc = mdbx_env_create(&env);
   if (rc == MDBX_SUCCESS)
@@ -148,7 +210,21 @@ int main(int argc, char *argv[]) {
     rc = mdbx_env_warmup(env, nullptr, warmup_flags, 3600 * 65536);
   }
 
-  if (!MDBX_IS_ERROR(rc)) {
+  if (!MDBX_IS_ERROR(rc) && delta) {
+    act = "copying delta";
+    mdbx_filehandle_t fd;
+#if defined(_WIN32) || defined(_WIN64)
+    fd = GetStdHandle(STD_OUTPUT_HANDLE);
+#else
+    fd = fileno(stdout);
+#endif
+    rc = (argc == 2) ? MDBX_SUCCESS : open_file(argv[2], true, (cpflags & MDBX_CP_OVERWRITE) != 0, &fd);
+    if (rc == MDBX_SUCCESS) {
+      rc = mdbx_env_copy_delta(env, since_txnid, fd);
+      if (argc > 2)
+        close_file(fd);
+    }
+  } else if (!MDBX_IS_ERROR(rc)) {
     act = "copying";
     if (argc == 2) {
       mdbx_filehandle_t fd;
@@ -21,8 +21,25 @@
 #define PRINT 1
 #define GLOBAL 2
 #define CONCISE 4
+#define BINARY 8
 static int mode = GLOBAL;
 
+/* The binary format: after the textual header each record is a little-endian
+ * 32-bit length followed by the key, then the same for the data. The length
+ * BINARY_SAMEKEY stands for the key of the previous record, and BINARY_END
+ * terminates the table data. The latter is followed by the 64-bit FNV-1a
+ * checksum of all preceding record bytes and then by the "DATA=END" line. */
+#define BINARY_END UINT32_C(0xFFFFFFFF)
+#define BINARY_SAMEKEY UINT32_C(0xFFFFFFFE)
+#define FNV1A64_INIT UINT64_C(0xcbf29ce484222325)
+static uint64_t checksum;
+
+static uint64_t fnv1a64(uint64_t hash, const void *ptr, size_t bytes) {
+  for (const uint8_t *c = ptr, *const end = c + bytes; c < end; ++c)
+    hash = (hash ^ *c) * UINT64_C(0x100000001b3);
+  return hash;
+}
+
 typedef struct flagbit {
   int bit;
   char *name;
@@ -38,6 +55,7 @@ flagbit dbflags[] = {{MDBX_REVERSEKEY, "reversekey"},
 
 #if defined(_WIN32) || defined(_WIN64)
 #include "wingetopt.h"
+#include <io.h>
 
 static volatile BOOL user_break;
 static BOOL WINAPI ConsoleBreakHandlerRoutine(DWORD dwCtrlType) {
@@ -73,6 +91,27 @@ static void dumpval(const MDBX_val *v) {
   putchar('\n');
 }
 
+static void dumpbin_u32(uint32_t value) {
+  const uint8_t bytes[4] = {(uint8_t)value, (uint8_t)(value >> 8), (uint8_t)(value >> 16), (uint8_t)(value >> 24)};
+  if (value != BINARY_END)
+    checksum = fnv1a64(checksum, bytes, sizeof(bytes));
+  fwrite(bytes, 1, sizeof(bytes), stdout);
+}
+
+static void dumpbin(const MDBX_val *v) {
+  dumpbin_u32((uint32_t)v->iov_len);
+  checksum = fnv1a64(checksum, v->iov_base, v->iov_len);
+  fwrite(v->iov_base, 1, v->iov_len, stdout);
+}
+
+static void dumpbin_end(void) {
+  dumpbin_u32(BINARY_END);
+  uint8_t bytes[8];
+  for (size_t i = 0; i < sizeof(bytes); ++i)
+    bytes[i] = (uint8_t)(checksum >> (i * 8));
+  fwrite(bytes, 1, sizeof(bytes), stdout);
+}
+
 bool quiet = false, rescue = false;
 const char *prog;
 static void error(const char *func, int rc) {
@@ -121,7 +160,9 @@ static int dump_tbl(MDBX_txn *txn, MDBX_dbi dbi, char *name) {
     if (canary.v)
       printf("canary=v%" PRIu64 ",x%" PRIu64 ",y%" PRIu64 ",z%" PRIu64 "\n", canary.v, canary.x, canary.y, canary.z);
   }
-  printf("format=%s\n", mode & PRINT ? "print" : "bytevalue");
+  printf("format=%s\n", (mode & BINARY) ? "binary" : (mode & PRINT) ? "print" : "bytevalue");
+  if (mode & BINARY)
+    printf("checksum=fnv1a64\n");
   if (name)
     printf("database=%s\n", name);
   printf("type=btree\n");
@@ -162,26 +203,39 @@ static int dump_tbl(MDBX_txn *txn, MDBX_dbi dbi, char *name) {
     }
   }
 
+  checksum = FNV1A64_INIT;
   while ((rc = mdbx_cursor_get(cursor, &key, &data, MDBX_NEXT)) == MDBX_SUCCESS) {
     if (user_break) {
       rc = MDBX_EINTR;
       break;
     }
-    dumpval(&key);
-    dumpval(&data);
+    if (mode & BINARY) {
+      dumpbin(&key);
+      dumpbin(&data);
+    } else {
+      dumpval(&key);
+      dumpval(&data);
+    }
     if ((flags & MDBX_DUPSORT) && (mode & CONCISE)) {
       while ((rc = mdbx_cursor_get(cursor, &key, &data, MDBX_NEXT_DUP)) == MDBX_SUCCESS) {
         if (user_break) {
           rc = MDBX_EINTR;
           break;
         }
-        putchar(' ');
-        dumpval(&data);
+        if (mode & BINARY) {
+          dumpbin_u32(BINARY_SAMEKEY);
+          dumpbin(&data);
+        } else {
+          putchar(' ');
+          dumpval(&data);
+        }
       }
       if (rc != MDBX_NOTFOUND)
         break;
     }
   }
+  if (mode & BINARY)
+    dumpbin_end();
   printf("DATA=END\n");
   if (rc == MDBX_NOTFOUND)
     rc = MDBX_SUCCESS;
@@ -195,7 +249,7 @@ static int dump_tbl(MDBX_txn *txn, MDBX_dbi dbi, char *name) {
 static void usage(void) {
   fprintf(stderr,
           "usage: %s "
-          "[-V] [-q] [-c] [-f file] [-l] [-p] [-r] [-a|-s table] [-u|U] "
+          "[-V] [-q] [-c] [-f file] [-l] [-p|-b] [-r] [-a|-s table] [-u|U] "
           "dbpath\n"
           "  -V\t\tprint version and exit\n"
           "  -q\t\tbe quiet\n"
@@ -204,6 +258,8 @@ static void usage(void) {
           "  -f\t\twrite to file instead of stdout\n"
           "  -l\t\tlist tables and exit\n"
           "  -p\t\tuse printable characters\n"
+          "  -b\t\tuse length-prefixed binary format with checksum,\n"
+          "  \t\tmuch faster but incompatible with Berkeley DB and LMDB\n"
           "  -r\t\trescue mode (ignore errors to dump corrupted DB)\n"
           "  -a\t\tdump main DB and all tables\n"
           "  -s name\tdump only the specified named table\n"
@@ -256,6 +312,7 @@ int main(int argc, char *argv[]) {
                      "l"
                      "n"
                      "p"
+                     "b"
                      "s:"
                      "V"
                      "r"
@@ -296,6 +353,9 @@ int main(int argc, char *argv[]) {
     case 'p':
       mode |= PRINT;
       break;
+    case 'b':
+      mode |= BINARY;
+      break;
     case 's':
       if (alldbs)
         usage();
@@ -319,9 +379,16 @@ int main(int argc, char *argv[]) {
     }
   }
 
-  if (optind != argc - 1)
+  if (optind != argc - 1 || (mode & (PRINT | BINARY)) == (PRINT | BINARY))
     usage();
 
+  if (mode & BINARY) {
+#if defined(_WIN32) || defined(_WIN64)
+    _setmode(_fileno(stdout), _O_BINARY);
+#endif /* WINDOWS */
+    setvbuf(stdout, nullptr, _IOFBF, MEGABYTE);
+  }
+
 #if defined(_WIN32) || defined(_WIN64)
   SetConsoleCtrlHandler(ConsoleBreakHandlerRoutine, true);
 #else
@@ -20,6 +20,7 @@
 
 #if defined(_WIN32) || defined(_WIN64)
 #include "wingetopt.h"
+#include <io.h>
 
 static volatile BOOL user_break;
 static BOOL WINAPI ConsoleBreakHandlerRoutine(DWORD dwCtrlType) {
@@ -39,7 +40,7 @@ static void signal_handler(int sig) {
 #endif /* !WINDOWS */
 
 static char *prog;
-static bool quiet = false;
+static bool quiet = false, rescue = false;
 static size_t lineno;
 static void error(const char *func, int rc) {
   if (!quiet) {
@@ -77,7 +78,7 @@ static char *valstr(char *line, const char *item) {
       fprintf(stderr, "%s: line %" PRIiSIZE ": unexpected line format for '%s'\n", prog, lineno, item);
     exit(EXIT_FAILURE);
   }
-  char *ptr = strchr(line, '\n');
+  char *ptr = strpbrk(line, "\r\n");
   if (ptr)
     *ptr = '\0';
   return line + len + 1;
@@ -118,12 +119,14 @@ static char *subname = nullptr;
 static int dbi_flags;
 static txnid_t txnid;
 static uint64_t sequence;
+static bool checksum;
 static MDBX_canary canary;
 static MDBX_envinfo envinfo;
 
 #define PRINT 1
 #define NOHDR 2
 #define GLOBAL 4
+#define BINARY 8
 static int mode = GLOBAL;
 
 static MDBX_val kbuf, dbuf;
@@ -152,6 +155,7 @@ static int readhdr(void) {
   dbi_flags = 0;
   txnid = 0;
   sequence = 0;
+  checksum = false;
 
   while (true) {
     errno = 0;
@@ -190,11 +194,15 @@ static int readhdr(void) {
     char *str = valstr(dbuf.iov_base, "format");
     if (str) {
       if (strcmp(str, "print") == 0) {
-        mode |= PRINT;
+        mode = (mode | PRINT) & ~BINARY;
         continue;
       }
       if (strcmp(str, "bytevalue") == 0) {
-        mode &= ~PRINT;
+        mode &= ~(PRINT | BINARY);
+        continue;
+      }
+      if (strcmp(str, "binary") == 0) {
+        mode = (mode | BINARY) & ~PRINT;
         continue;
       }
       if (!quiet)
@@ -202,6 +210,17 @@ static int readhdr(void) {
       exit(EXIT_FAILURE);
     }
 
+    str = valstr(dbuf.iov_base, "checksum");
+    if (str) {
+      if (strcmp(str, "fnv1a64") != 0) {
+        if (!quiet)
+          fprintf(stderr, "%s: line %" PRIiSIZE ": unsupported value '%s' for %s\n", prog, lineno, str, "checksum");
+        exit(EXIT_FAILURE);
+      }
+      checksum = true;
+      continue;
+    }
+
     str = valstr(dbuf.iov_base, "database");
     if (str) {
       if (*str) {
@@ -417,6 +436,8 @@ __hot static int readline(MDBX_val *out, MDBX_val *buf) {
   c1 = c2 = buf->iov_base;
   len = l2;
   c1[--len] = '\0';
+  if (len && c1[len - 1] == '\r')
+    c1[--len] = '\0';
   end = c1 + len;
 
   if (mode & PRINT) {
@@ -452,6 +473,454 @@ __hot static int readline(MDBX_val *out, MDBX_val *buf) {
   return MDBX_SUCCESS;
 }
 
+/* Commits the loading transaction from time to time to bound its dirty volume. */
+static int load_checkpoint(MDBX_env *env, MDBX_txn **txn, MDBX_cursor *mc, MDBX_dbi dbi, size_t *batch) {
+  MDBX_txn_info txn_info;
+  int err = mdbx_txn_info(*txn, &txn_info, false);
+  if (unlikely(err != MDBX_SUCCESS)) {
+    error("mdbx_txn_info", err);
+    return err;
+  }
+
+  if (*batch >= 10000 || txn_info.txn_space_dirty > MEGABYTE * 256) {
+    err = mdbx_txn_commit(*txn);
+    if (unlikely(err != MDBX_SUCCESS)) {
+      error("mdbx_txn_commit", err);
+      return err;
+    }
+    *batch = 0;
+
+    err = mdbx_txn_begin(env, nullptr, 0, txn);
+    if (unlikely(err != MDBX_SUCCESS)) {
+      error("mdbx_txn_begin", err);
+      return err;
+    }
+    err = mdbx_cursor_bind(*txn, mc, dbi);
+    if (unlikely(err != MDBX_SUCCESS)) {
+      error("mdbx_cursor_bind", err);
+      return err;
+    }
+  }
+  return MDBX_SUCCESS;
+}
+
+/*----------------------------------------------------------------------------*/
+/* The binary format: after the textual header each record is a little-endian
+ * 32-bit length followed by the key, then the same for the data. The length
+ * BINARY_SAMEKEY stands for the key of the previous record, and BINARY_END
+ * terminates the table data. The latter is followed by the 64-bit FNV-1a
+ * checksum of all preceding record bytes if "checksum=fnv1a64" is given,
+ * and then by the "DATA=END" line.
+ *
+ * Such input is read and parsed by a separate thread into batches of records,
+ * while the main thread puts them into the DB. The parser also notices when
+ * records go in the table order, so ones are put via MDBX_APPEND, and groups
+ * the same-key values of MDBX_DUPFIXED tables to be put via MDBX_MULTIPLE. */
+
+#define BINARY_END UINT32_C(0xFFFFFFFF)
+#define BINARY_SAMEKEY UINT32_C(0xFFFFFFFE)
+#define BINARY_BATCH_BYTES (MEGABYTE * 4)
+#define BINARY_BATCH_ITEMS 65536
+#define BINARY_QUEUE 4
+#define FNV1A64_INIT UINT64_C(0xcbf29ce484222325)
+
+static uint64_t fnv1a64(uint64_t hash, const void *ptr, size_t bytes) {
+  for (const uint8_t *c = ptr, *const end = c + bytes; c < end; ++c)
+    hash = (hash ^ *c) * UINT64_C(0x100000001b3);
+  return hash;
+}
+
+typedef struct binary_item {
+  /* offsets within the batch arena */
+  size_t key, key_len, data, data_len;
+  /* number of the adjacent same-size values to be put via MDBX_MULTIPLE */
+  size_t count;
+  /* the record follows the previous one in the table order */
+  bool ordered;
+} binary_item_t;
+
+typedef struct binary_batch {
+  uint8_t *arena;
+  size_t used, allocated;
+  binary_item_t *items;
+  size_t count;
+  bool last;
+  int err;
+} binary_batch_t;
+
+typedef struct binary_parser {
+#if defined(_WIN32) || defined(_WIN64)
+  CRITICAL_SECTION lock;
+  CONDITION_VARIABLE cond;
+#else
+  pthread_mutex_t lock;
+  pthread_cond_t cond;
+#endif /* !WINDOWS */
+  osal_thread_t thread;
+  binary_batch_t batches[BINARY_QUEUE];
+  /* counters of the filled and the consumed batches */
+  size_t head, tail;
+  volatile bool stop;
+
+  MDBX_cmp_func *keycmp, *datacmp;
+  bool dupsort, multiple;
+  size_t key_max, data_max;
+  uint64_t checksum;
+  /* the key and (for dupsort) the data of the previous record */
+  MDBX_val key, spare, data;
+  bool have_key;
+} binary_parser_t;
+
+static void binary_lock(binary_parser_t *parser) {
+#if defined(_WIN32) || defined(_WIN64)
+  EnterCriticalSection(&parser->lock);
+#else
+  pthread_mutex_lock(&parser->lock);
+#endif /* !WINDOWS */
+}
+
+static void binary_unlock(binary_parser_t *parser) {
+#if defined(_WIN32) || defined(_WIN64)
+  LeaveCriticalSection(&parser->lock);
+#else
+  pthread_mutex_unlock(&parser->lock);
+#endif /* !WINDOWS */
+}
+
+static void binary_wait(binary_parser_t *parser) {
+#if defined(_WIN32) || defined(_WIN64)
+  SleepConditionVariableCS(&parser->cond, &parser->lock, INFINITE);
+#else
+  pthread_cond_wait(&parser->cond, &parser->lock);
+#endif /* !WINDOWS */
+}
+
+static void binary_signal(binary_parser_t *parser) {
+#if defined(_WIN32) || defined(_WIN64)
+  WakeAllConditionVariable(&parser->cond);
+#else
+  pthread_cond_broadcast(&parser->cond);
+#endif /* !WINDOWS */
+}
+
+static int binary_read(binary_parser_t *parser, void *dst, size_t bytes) {
+  if (unlikely(fread(dst, 1, bytes, stdin) != bytes))
+    return badend();
+  parser->checksum = fnv1a64(parser->checksum, dst, bytes);
+  return MDBX_SUCCESS;
+}
+
+static int binary_read_u32(binary_parser_t *parser, uint32_t *value) {
+  uint8_t bytes[4];
+  if (unlikely(fread(bytes, 1, sizeof(bytes), stdin) != sizeof(bytes)))
+    return badend();
+  *value = bytes[0] | (uint32_t)bytes[1] << 8 | (uint32_t)bytes[2] << 16 | (uint32_t)bytes[3] << 24;
+  if (*value != BINARY_END)
+    parser->checksum = fnv1a64(parser->checksum, bytes, sizeof(bytes));
+  return MDBX_SUCCESS;
+}
+
+static int binary_reserve(binary_batch_t *batch, size_t bytes) {
+  if (batch->used + bytes > batch->allocated) {
+    size_t allocated = batch->allocated ? batch->allocated : BINARY_BATCH_BYTES + BINARY_BATCH_BYTES / 4;
+    while (allocated < batch->used + bytes)
+      allocated += allocated;
+    void *ptr = osal_realloc(batch->arena, allocated);
+    if (unlikely(!ptr))
+      return MDBX_ENOMEM;
+    batch->arena = ptr;
+    batch->allocated = allocated;
+  }
+  return MDBX_SUCCESS;
+}
+
+static int binary_finish(binary_parser_t *parser, binary_batch_t *batch) {
+  if (checksum) {
+    uint8_t bytes[8];
+    if (unlikely(fread(bytes, 1, sizeof(bytes), stdin) != sizeof(bytes)))
+      return badend();
+    uint64_t expected = 0;
+    for (size_t i = 0; i < sizeof(bytes); ++i)
+      expected |= (uint64_t)bytes[i] << (i * 8);
+    if (unlikely(expected != parser->checksum)) {
+      if (!quiet)
+        fprintf(stderr, "%s: line %" PRIiSIZE ": checksum mismatch for '%s'\n", prog, lineno,
+                subname ? subname : "@MAIN");
+      if (!rescue)
+        return MDBX_CORRUPTED;
+    }
+  }
+
+  char line[16];
+  errno = 0;
+  if (unlikely(!fgets(line, sizeof(line), stdin) || strncmp(line, "DATA=END", STRLENOF("DATA=END"))))
+    return badend();
+  lineno++;
+  batch->last = true;
+  return MDBX_SUCCESS;
+}
+
+static int binary_parse(binary_parser_t *parser, binary_batch_t *batch) {
+  batch->used = batch->count = 0;
+  batch->last = false;
+  while (batch->used < BINARY_BATCH_BYTES && batch->count < BINARY_BATCH_ITEMS) {
+    if (user_break)
+      return MDBX_EINTR;
+
+    uint32_t length;
+    int err = binary_read_u32(parser, &length);
+    if (unlikely(err != MDBX_SUCCESS))
+      return err;
+    if (length == BINARY_END)
+      return binary_finish(parser, batch);
+
+    bool samekey = length == BINARY_SAMEKEY, ordered = !parser->have_key;
+    if (samekey) {
+      if (unlikely(!parser->have_key))
+        return badend();
+    } else {
+      if (unlikely(length > parser->key_max)) {
+        if (!quiet)
+          fprintf(stderr, "%s: line %" PRIiSIZE ": invalid key length %u\n", prog, lineno, length);
+        return MDBX_BAD_VALSIZE;
+      }
+      parser->spare.iov_len = length;
+      err = binary_read(parser, parser->spare.iov_base, length);
+      if (unlikely(err != MDBX_SUCCESS))
+        return err;
+      if (parser->have_key) {
+        const int cmp = parser->keycmp(&parser->spare, &parser->key);
+        ordered = cmp > 0;
+        samekey = parser->key.iov_len == length && memcmp(parser->key.iov_base, parser->spare.iov_base, length) == 0;
+      }
+      if (!samekey) {
+        const MDBX_val swap = parser->key;
+        parser->key = parser->spare;
+        parser->spare = swap;
+        parser->have_key = true;
+      }
+    }
+
+    err = binary_read_u32(parser, &length);
+    if (unlikely(err != MDBX_SUCCESS))
+      return err;
+    if (unlikely(length > parser->data_max)) {
+      if (!quiet)
+        fprintf(stderr, "%s: line %" PRIiSIZE ": invalid data length %u\n", prog, lineno, length);
+      return MDBX_BAD_VALSIZE;
+    }
+
+    binary_item_t *const prev = batch->count ? &batch->items[batch->count - 1] : nullptr;
+    const bool adjacent = parser->multiple && samekey && prev && prev->data_len == length &&
+                          prev->data + prev->data_len * prev->count == batch->used;
+    size_t key_offset;
+    if (samekey && prev)
+      key_offset = prev->key;
+    else {
+      err = binary_reserve(batch, parser->key.iov_len);
+      if (unlikely(err != MDBX_SUCCESS))
+        return err;
+      key_offset = batch->used;
+      memcpy(batch->arena + batch->used, parser->key.iov_base, parser->key.iov_len);
+      batch->used += parser->key.iov_len;
+    }
+
+    /* the values for MDBX_MULTIPLE must be aligned in case of MDBX_INTEGERDUP */
+    const size_t data_offset = (adjacent || !parser->dupsort) ? batch->used : (batch->used + 7) & ~(size_t)7;
+    err = binary_reserve(batch, data_offset - batch->used + length);
+    if (unlikely(err != MDBX_SUCCESS))
+      return err;
+    const MDBX_val data = {.iov_base = batch->arena + data_offset, .iov_len = length};
+    err = binary_read(parser, data.iov_base, length);
+    if (unlikely(err != MDBX_SUCCESS))
+      return err;
+    batch->used = data_offset + length;
+
+    if (parser->dupsort) {
+      if (samekey)
+        ordered = parser->datacmp(&data, &parser->data) > 0;
+      parser->data.iov_len = length;
+      memcpy(parser->data.iov_base, data.iov_base, length);
+    }
+
+    if (adjacent && ordered && prev->ordered)
+      prev->count += 1;
+    else {
+      binary_item_t *const item = &batch->items[batch->count++];
+      item->key = key_offset;
+      item->key_len = parser->key.iov_len;
+      item->data = data_offset;
+      item->data_len = length;
+      item->count = 1;
+      item->ordered = ordered;
+    }
+  }
+  return MDBX_SUCCESS;
+}
+
+static THREAD_RESULT THREAD_CALL binary_parser_thread(void *arg) {
+  binary_parser_t *const parser = arg;
+  for (bool done = false; !done;) {
+    binary_lock(parser);
+    while (parser->head - parser->tail == BINARY_QUEUE && !parser->stop)
+      binary_wait(parser);
+    const bool stop = parser->stop;
+    binary_unlock(parser);
+    if (stop)
+      break;
+
+    binary_batch_t *const batch = &parser->batches[parser->head % BINARY_QUEUE];
+    batch->err = binary_parse(parser, batch);
+    done = batch->last || batch->err != MDBX_SUCCESS;
+
+    binary_lock(parser);
+    parser->head += 1;
+    binary_signal(parser);
+    binary_unlock(parser);
+  }
+  return (THREAD_RESULT)0;
+}
+
+static void binary_destroy(binary_parser_t *parser) {
+  for (size_t i = 0; i < BINARY_QUEUE; ++i) {
+    free(parser->batches[i].arena);
+    free(parser->batches[i].items);
+  }
+  free(parser->key.iov_base);
+  free(parser->spare.iov_base);
+  free(parser->data.iov_base);
+#if defined(_WIN32) || defined(_WIN64)
+  DeleteCriticalSection(&parser->lock);
+#else
+  pthread_cond_destroy(&parser->cond);
+  pthread_mutex_destroy(&parser->lock);
+#endif /* !WINDOWS */
+}
+
+static int binary_init(binary_parser_t *parser, MDBX_env *env, MDBX_put_flags_t putflags) {
+  memset(parser, 0, sizeof(*parser));
+#if defined(_WIN32) || defined(_WIN64)
+  InitializeCriticalSection(&parser->lock);
+  InitializeConditionVariable(&parser->cond);
+#else
+  pthread_mutex_init(&parser->lock, nullptr);
+  pthread_cond_init(&parser->cond, nullptr);
+#endif /* !WINDOWS */
+
+  parser->keycmp = mdbx_get_keycmp((MDBX_db_flags_t)dbi_flags);
+  parser->datacmp = mdbx_get_datacmp((MDBX_db_flags_t)dbi_flags);
+  parser->dupsort = (dbi_flags & MDBX_DUPSORT) != 0;
+  parser->multiple = (dbi_flags & MDBX_DUPFIXED) && !(putflags & MDBX_NOOVERWRITE);
+  parser->checksum = FNV1A64_INIT;
+  const intptr_t key_max = mdbx_env_get_maxkeysize_ex(env, (MDBX_db_flags_t)dbi_flags);
+  const intptr_t data_max = mdbx_env_get_maxvalsize_ex(env, (MDBX_db_flags_t)dbi_flags);
+  if (unlikely(key_max < 0 || data_max < 0)) {
+    binary_destroy(parser);
+    return MDBX_EINVAL;
+  }
+  parser->key_max = key_max;
+  parser->data_max = data_max;
+  parser->key.iov_base = osal_malloc(parser->key_max + 1);
+  parser->spare.iov_base = osal_malloc(parser->key_max + 1);
+  parser->data.iov_base = parser->dupsort ? osal_malloc(parser->data_max + 1) : nullptr;
+  bool ok = parser->key.iov_base && parser->spare.iov_base && (parser->data.iov_base || !parser->dupsort);
+  for (size_t i = 0; ok && i < BINARY_QUEUE; ++i)
+    ok = (parser->batches[i].items = osal_malloc(sizeof(binary_item_t) * BINARY_BATCH_ITEMS)) != nullptr;
+  if (unlikely(!ok)) {
+    binary_destroy(parser);
+    return MDBX_ENOMEM;
+  }
+
+#if defined(_WIN32) || defined(_WIN64)
+  parser->thread = CreateThread(nullptr, 0, binary_parser_thread, parser, 0, nullptr);
+  const int err = parser->thread ? MDBX_SUCCESS : (int)GetLastError();
+#else
+  const int err = pthread_create(&parser->thread, nullptr, binary_parser_thread, parser);
+#endif /* !WINDOWS */
+  if (unlikely(err != MDBX_SUCCESS))
+    binary_destroy(parser);
+  return err;
+}
+
+static void binary_fini(binary_parser_t *parser) {
+  binary_lock(parser);
+  parser->stop = true;
+  binary_signal(parser);
+  binary_unlock(parser);
+#if defined(_WIN32) || defined(_WIN64)
+  WaitForSingleObject(parser->thread, INFINITE);
+  CloseHandle(parser->thread);
+#else
+  pthread_join(parser->thread, nullptr);
+#endif /* !WINDOWS */
+  binary_destroy(parser);
+}
+
+static int load_binary(MDBX_env *env, MDBX_txn **txn, MDBX_cursor *mc, MDBX_dbi dbi, MDBX_put_flags_t putflags) {
+  binary_parser_t parser;
+  int err = binary_init(&parser, env, putflags);
+  if (unlikely(err != MDBX_SUCCESS)) {
+    error("binary_init", err);
+    return err;
+  }
+
+  const bool dupsort = (dbi_flags & MDBX_DUPSORT) != 0;
+  /* try to append ordered records, until it turns out the table already has greater ones */
+  bool append = !(putflags & MDBX_APPEND);
+  size_t batch_count = 0;
+  for (bool last = false; !last && err == MDBX_SUCCESS;) {
+    binary_lock(&parser);
+    while (parser.head == parser.tail)
+      binary_wait(&parser);
+    binary_unlock(&parser);
+
+    binary_batch_t *const batch = &parser.batches[parser.tail % BINARY_QUEUE];
+    err = batch->err;
+    last = batch->last;
+    for (size_t i = 0; err == MDBX_SUCCESS && i < batch->count; ++i) {
+      const binary_item_t *const item = &batch->items[i];
+      MDBX_val key = {.iov_base = batch->arena + item->key, .iov_len = item->key_len};
+      MDBX_val data[2] = {{.iov_base = batch->arena + item->data, .iov_len = item->data_len},
+                          {.iov_base = nullptr, .iov_len = item->count}};
+      MDBX_put_flags_t flags = putflags;
+      if (item->count > 1)
+        flags |= MDBX_MULTIPLE;
+      else if (append && item->ordered)
+        flags |= dupsort ? MDBX_APPEND | MDBX_APPENDDUP : MDBX_APPEND;
+
+      err = mdbx_cursor_put(mc, &key, data, flags);
+      if (err == MDBX_EKEYMISMATCH && flags != putflags && !(flags & MDBX_MULTIPLE)) {
+        append = false;
+        err = mdbx_cursor_put(mc, &key, data, putflags);
+      }
+      if (err == MDBX_KEYEXIST && putflags) {
+        err = MDBX_SUCCESS;
+        continue;
+      }
+      if (err == MDBX_BAD_VALSIZE && rescue) {
+        if (!quiet)
+          fprintf(stderr, "%s: skip record of '%s' due %s\n", prog, subname ? subname : "@MAIN", mdbx_strerror(err));
+        err = MDBX_SUCCESS;
+        continue;
+      }
+      if (unlikely(err != MDBX_SUCCESS)) {
+        error("mdbx_cursor_put", err);
+        break;
+      }
+      batch_count += item->count;
+      err = load_checkpoint(env, txn, mc, dbi, &batch_count);
+    }
+
+    binary_lock(&parser);
+    parser.tail += 1;
+    binary_signal(&parser);
+    binary_unlock(&parser);
+  }
+
+  binary_fini(&parser);
+  return err;
+}
+
 static void usage(void) {
   fprintf(stderr,
           "usage: %s "
@@ -485,7 +954,6 @@ int main(int argc, char *argv[]) {
   MDBX_dbi dbi;
   char *envname = nullptr;
   int envflags = MDBX_SAFE_NOSYNC | MDBX_ACCEDE, putflags = MDBX_UPSERT;
-  bool rescue = false;
   bool purge = false;
 
   prog = argv[0];
@@ -567,6 +1035,11 @@ int main(int argc, char *argv[]) {
   signal(SIGTERM, signal_handler);
 #endif /* !WINDOWS */
 
+#if defined(_WIN32) || defined(_WIN64)
+  /* the binary format requires, while the text one tolerates */
+  _setmode(_fileno(stdin), _O_BINARY);
+#endif /* WINDOWS */
+
   envname = argv[optind];
   if (!quiet) {
     printf("mdbx_load %s (%s, T-%s)\nRunning for %s...\n", mdbx_version.git.describe, mdbx_version.git.datetime,
@@ -617,8 +1090,8 @@ int main(int argc, char *argv[]) {
   if (envinfo.mi_geo.current | envinfo.mi_mapsize) {
     if (envinfo.mi_geo.current) {
       err = mdbx_env_set_geometry(env, (intptr_t)envinfo.mi_geo.lower, (intptr_t)envinfo.mi_geo.current,
-                                  (intptr_t)envinfo.mi_geo.upper, (intptr_t)envinfo.mi_geo.shrink,
-                                  (intptr_t)envinfo.mi_geo.grow,
+                                  (intptr_t)envinfo.mi_geo.upper, (intptr_t)envinfo.mi_geo.grow,
+                                  (intptr_t)envinfo.mi_geo.shrink,
                                   envinfo.mi_dxb_pagesize ? (intptr_t)envinfo.mi_dxb_pagesize : -1);
     } else {
       if (envinfo.mi_mapsize > MAX_MAPSIZE) {
@@ -729,9 +1202,14 @@ int main(int argc, char *argv[]) {
       goto bailout;
     }
 
-    int batch = 0;
+    size_t batch = 0;
     MDBX_val key = {.iov_base = nullptr, .iov_len = 0}, data = {.iov_base = nullptr, .iov_len = 0};
-    while (err == MDBX_SUCCESS) {
+    if (mode & BINARY) {
+      err = load_binary(env, &txn, mc, dbi, putflags);
+      if (unlikely(err != MDBX_SUCCESS))
+        goto bailout;
+    }
+    while (err == MDBX_SUCCESS && !(mode & BINARY)) {
       err = readline(&key, &kbuf);
       if (err == EOF)
         break;
@@ -758,32 +1236,9 @@ int main(int argc, char *argv[]) {
       }
       batch++;
 
-      MDBX_txn_info txn_info;
-      err = mdbx_txn_info(txn, &txn_info, false);
-      if (unlikely(err != MDBX_SUCCESS)) {
-        error("mdbx_txn_info", err);
+      err = load_checkpoint(env, &txn, mc, dbi, &batch);
+      if (unlikely(err != MDBX_SUCCESS))
         goto bailout;
-      }
-
-      if (batch == 10000 || txn_info.txn_space_dirty > MEGABYTE * 256) {
-        err = mdbx_txn_commit(txn);
-        if (unlikely(err != MDBX_SUCCESS)) {
-          error("mdbx_txn_commit", err);
-          goto bailout;
-        }
-        batch = 0;
-
-        err = mdbx_txn_begin(env, nullptr, 0, &txn);
-        if (unlikely(err != MDBX_SUCCESS)) {
-          error("mdbx_txn_begin", err);
-          goto bailout;
-        }
-        err = mdbx_cursor_bind(txn, mc, dbi);
-        if (unlikely(err != MDBX_SUCCESS)) {
-          error("mdbx_cursor_bind", err);
-          goto bailout;
-        }
-      }
     }
 
     mdbx_cursor_close(mc);
@@ -47,16 +47,22 @@ static void print_stat(MDBX_stat *ms) {
 
 static void usage(const char *prog) {
   fprintf(stderr,
-          "usage: %s [-V] [-q] [-e] [-f[f[f]]] [-r[r]] [-a|-s table] dbpath\n"
+          "usage: %s [-V] [-q] [-e] [-f[f[f]]] [-r[r]] [-l] [-a|-s table] [-w interval[,count] [-j]] dbpath\n"
           "  -V\t\tprint version and exit\n"
           "  -q\t\tbe quiet\n"
           "  -p\t\tshow statistics of page operations for current session\n"
           "  -e\t\tshow whole DB info\n"
           "  -f\t\tshow GC info\n"
           "  -r\t\tshow readers\n"
+          "  -l\t\tshow latency histograms of reading for current session\n"
           "  -a\t\tprint stat of main DB and all tables\n"
           "  -s table\tprint stat of only the specified named table\n"
-          "  \t\tby default print stat of only the main DB\n",
+          "  \t\tby default print stat of only the main DB\n"
+          "  -w interval[,count]\n"
+          "  \t\tmonitor rates of page operations, readers lag and GC backlog\n"
+          "  \t\tevery interval (seconds, or with `s`/`ms` suffix) until interrupted\n"
+          "  \t\tor count samples are printed\n"
+          "  -j\t\tprint monitoring samples as JSON lines\n",
           prog);
   exit(EXIT_FAILURE);
 }
@@ -107,6 +113,266 @@ static void logger(MDBX_log_level_t level, const char *function, int line, const
   }
 }
 
+/*----------------------------------------------------------------------------*/
+/* Live monitoring (-w interval[,count]) */
+
+#if defined(_WIN32) || defined(_WIN64)
+static double monotonic_seconds(void) {
+  LARGE_INTEGER Counter, Frequency;
+  return (QueryPerformanceFrequency(&Frequency) && QueryPerformanceCounter(&Counter))
+             ? Counter.QuadPart / (double)Frequency.QuadPart
+             : 0;
+}
+
+static void sleep_seconds(double seconds) { Sleep((DWORD)(seconds * 1e3 + 0.5)); }
+#else
+static double monotonic_seconds(void) {
+  struct timespec ts;
+  return clock_gettime(CLOCK_MONOTONIC, &ts) ? 0 : ts.tv_sec + ts.tv_nsec * 1e-9;
+}
+
+static void sleep_seconds(double seconds) {
+  struct timespec ts;
+  ts.tv_sec = (time_t)seconds;
+  ts.tv_nsec = (long)((seconds - ts.tv_sec) * 1e9);
+  /* a signal interrupts the sleep, then the caller checks user_break */
+  nanosleep(&ts, nullptr);
+}
+#endif /* !WINDOWS */
+
+/* Buckets of reader lag in transactions: 0, 1..9, 10..99, 100..999, 1000+ */
+#define LAG_BUCKETS 5
+
+typedef struct {
+  unsigned slots, active, parked, ousted;
+  uint64_t lag_max;
+  size_t retained_max;
+  unsigned lag_hist[LAG_BUCKETS];
+} readers_stat_t;
+
+typedef struct {
+  double timestamp;
+  MDBX_envinfo info;
+  readers_stat_t readers;
+  uint64_t gc_records, gc_pages, gc_reclaimable;
+} watch_sample_t;
+
+static int reader_collect_func(void *ctx, int num, int slot, mdbx_pid_t pid, mdbx_tid_t thread, uint64_t txnid,
+                               uint64_t lag, size_t bytes_used, size_t bytes_retained) {
+  (void)num;
+  (void)slot;
+  (void)pid;
+  (void)bytes_used;
+  readers_stat_t *const rs = ctx;
+  rs->slots += 1;
+  if (thread == (mdbx_tid_t)((uintptr_t)MDBX_TID_TXN_PARKED))
+    rs->parked += 1;
+  else if (thread == (mdbx_tid_t)((uintptr_t)MDBX_TID_TXN_OUSTED))
+    rs->ousted += 1;
+  if (txnid) {
+    rs->active += 1;
+    if (rs->lag_max < lag)
+      rs->lag_max = lag;
+    if (rs->retained_max < bytes_retained)
+      rs->retained_max = bytes_retained;
+    unsigned bucket = 0;
+    for (uint64_t edge = 1; bucket < LAG_BUCKETS - 1 && lag >= edge; edge *= 10)
+      ++bucket;
+    rs->lag_hist[bucket] += 1;
+  }
+  return user_break ? MDBX_RESULT_TRUE : MDBX_RESULT_FALSE;
+}
+
+static int watch_sample(MDBX_env *env, MDBX_txn *txn, watch_sample_t *sample) {
+  memset(sample, 0, sizeof(*sample));
+  int rc = mdbx_txn_renew(txn);
+  if (unlikely(rc != MDBX_SUCCESS)) {
+    error("mdbx_txn_renew", rc);
+    return rc;
+  }
+
+  sample->timestamp = monotonic_seconds();
+  rc = mdbx_env_info_ex(env, txn, &sample->info, sizeof(sample->info));
+  if (unlikely(rc != MDBX_SUCCESS)) {
+    error("mdbx_env_info_ex", rc);
+    goto bailout;
+  }
+
+  MDBX_cursor *cursor;
+  rc = mdbx_cursor_open(txn, FREE_DBI, &cursor);
+  if (unlikely(rc != MDBX_SUCCESS)) {
+    error("mdbx_cursor_open", rc);
+    goto bailout;
+  }
+  MDBX_val key, data;
+  while (MDBX_SUCCESS == (rc = mdbx_cursor_get(cursor, &key, &data, MDBX_NEXT))) {
+    if (user_break) {
+      rc = MDBX_EINTR;
+      break;
+    }
+    const pgno_t number = *(const pgno_t *)data.iov_base;
+    sample->gc_records += 1;
+    sample->gc_pages += number;
+    if (sample->info.mi_latter_reader_txnid > *(const txnid_t *)key.iov_base)
+      sample->gc_reclaimable += number;
+  }
+  mdbx_cursor_close(cursor);
+  if (rc != MDBX_NOTFOUND) {
+    if (rc != MDBX_EINTR)
+      error("mdbx_cursor_get", rc);
+    goto bailout;
+  }
+
+  /* The own snapshot is released before enumerating the readers,
+   * so the slot of this process is listed as inactive and not counted. */
+  rc = mdbx_txn_reset(txn);
+  if (unlikely(rc != MDBX_SUCCESS)) {
+    error("mdbx_txn_reset", rc);
+    return rc;
+  }
+  rc = mdbx_reader_list(env, reader_collect_func, &sample->readers);
+  if (MDBX_IS_ERROR(rc)) {
+    error("mdbx_reader_list", rc);
+    return rc;
+  }
+  return user_break ? MDBX_EINTR : MDBX_SUCCESS;
+
+bailout:
+  mdbx_txn_reset(txn);
+  return rc;
+}
+
+static void watch_print(const watch_sample_t *prev, const watch_sample_t *now, double elapsed, unsigned line,
+                        bool json) {
+  const double dt = now->timestamp - prev->timestamp;
+  const double rate = (dt > 0) ? 1 / dt : 0;
+#define DELTA(field) ((double)(now->info.field - prev->info.field) * rate)
+  /* total seconds spent waiting for the write lock per second,
+   * i.e. the average number of waiting threads */
+  const double wait =
+      (now->info.mi_wrt_lock.wait_seconds16dot16 - prev->info.mi_wrt_lock.wait_seconds16dot16) / 65536.0 * rate;
+  const unsigned pagesize = now->info.mi_dxb_pagesize;
+  const uint64_t retained_pages = now->readers.retained_max / pagesize;
+
+  if (json) {
+    printf("{\"time\":%" PRIu64 ",\"elapsed\":%.3f,\"interval\":%.3f,\"txnid\":%" PRIu64 ","
+           "\"rate\":{\"txn\":%.1f,\"newly\":%.1f,\"cow\":%.1f,\"clone\":%.1f,\"split\":%.1f,\"merge\":%.1f,"
+           "\"spill\":%.1f,\"unspill\":%.1f,\"wops\":%.1f,\"prefault\":%.1f,\"mincore\":%.1f,"
+           "\"msync\":%.1f,\"fsync\":%.1f},"
+           "\"wrt_lock\":{\"acquisitions\":%.1f,\"contended\":%.1f,\"wait\":%.3f,"
+           "\"waiters\":%u,\"max_waiters\":%u},"
+           "\"readers\":{\"slots\":%u,\"active\":%u,\"parked\":%u,\"ousted\":%u,\"lag_max\":%" PRIu64 ","
+           "\"lag_hist\":[%u,%u,%u,%u,%u],\"retained_max_pages\":%" PRIu64 "},"
+           "\"gc\":{\"records\":%" PRIu64 ",\"pages\":%" PRIu64 ",\"reclaimable\":%" PRIu64 "},"
+           "\"space\":{\"pagesize\":%u,\"allocated\":%" PRIu64 ",\"backed\":%" PRIu64 ",\"upper\":%" PRIu64 "}}\n",
+           (uint64_t)time(nullptr), elapsed, dt, now->info.mi_recent_txnid, DELTA(mi_recent_txnid),
+           DELTA(mi_pgop_stat.newly), DELTA(mi_pgop_stat.cow), DELTA(mi_pgop_stat.clone), DELTA(mi_pgop_stat.split),
+           DELTA(mi_pgop_stat.merge), DELTA(mi_pgop_stat.spill), DELTA(mi_pgop_stat.unspill), DELTA(mi_pgop_stat.wops),
+           DELTA(mi_pgop_stat.prefault), DELTA(mi_pgop_stat.mincore), DELTA(mi_pgop_stat.msync),
+           DELTA(mi_pgop_stat.fsync), DELTA(mi_wrt_lock.acquisitions), DELTA(mi_wrt_lock.contended), wait,
+           now->info.mi_wrt_lock.waiters, now->info.mi_wrt_lock.max_waiters, now->readers.slots,
+           now->readers.active, now->readers.parked, now->readers.ousted, now->readers.lag_max,
+           now->readers.lag_hist[0], now->readers.lag_hist[1], now->readers.lag_hist[2], now->readers.lag_hist[3],
+           now->readers.lag_hist[4], retained_pages, now->gc_records, now->gc_pages, now->gc_reclaimable, pagesize,
+           now->info.mi_last_pgno + 1, now->info.mi_geo.current / pagesize, now->info.mi_geo.upper / pagesize);
+  } else {
+    if (line % 20 == 0)
+      printf("%8s %7s %7s %7s %7s %7s %7s %7s %7s %7s %7s %5s %5s %8s %9s %10s %10s\n", "elapsed", "txn/s", "new/s",
+             "cow/s", "split/s", "merge/s", "spill/s", "wops/s", "fsync/s", "wlck/s", "cont/s", " wait", "rdrs",
+             "lag-max", "retained", "gc-pages", "reclaim");
+    printf("%8.1f %7.0f %7.0f %7.0f %7.0f %7.0f %7.0f %7.0f %7.0f %7.0f %7.0f %5.2f %5u %8" PRIu64 " %9" PRIu64
+           " %10" PRIu64 " %10" PRIu64 "\n",
+           elapsed, DELTA(mi_recent_txnid), DELTA(mi_pgop_stat.newly), DELTA(mi_pgop_stat.cow),
+           DELTA(mi_pgop_stat.split), DELTA(mi_pgop_stat.merge), DELTA(mi_pgop_stat.spill), DELTA(mi_pgop_stat.wops),
+           DELTA(mi_pgop_stat.fsync), DELTA(mi_wrt_lock.acquisitions), DELTA(mi_wrt_lock.contended),
+           wait, now->readers.active, now->readers.lag_max, retained_pages, now->gc_pages,
+           now->gc_reclaimable);
+  }
+#undef DELTA
+  fflush(stdout);
+}
+
+static int watch(MDBX_env *env, double interval, unsigned count, bool json) {
+  MDBX_txn *txn;
+  int rc = mdbx_txn_begin(env, nullptr, MDBX_TXN_RDONLY, &txn);
+  if (unlikely(rc != MDBX_SUCCESS)) {
+    error("mdbx_txn_begin", rc);
+    return rc;
+  }
+  rc = mdbx_txn_reset(txn);
+  if (unlikely(rc != MDBX_SUCCESS)) {
+    error("mdbx_txn_reset", rc);
+    goto bailout;
+  }
+
+  watch_sample_t samples[2];
+  rc = watch_sample(env, txn, &samples[0]);
+  const double start = samples[0].timestamp;
+  for (unsigned line = 0; rc == MDBX_SUCCESS && (!count || line < count); ++line) {
+    /* keep the sampling period stable regardless of the sampling cost */
+    const double deadline = start + interval * (line + 1);
+    for (double now = monotonic_seconds(); now < deadline && !user_break; now = monotonic_seconds())
+      sleep_seconds(deadline - now);
+    if (user_break) {
+      rc = MDBX_EINTR;
+      break;
+    }
+    watch_sample_t *const prev = &samples[line & 1], *const next = &samples[~line & 1];
+    rc = watch_sample(env, txn, next);
+    if (rc == MDBX_SUCCESS)
+      watch_print(prev, next, next->timestamp - start, line, json);
+  }
+
+  if (rc == MDBX_EINTR) {
+    /* interruption is the regular way to finish unlimited monitoring */
+    rc = MDBX_SUCCESS;
+  }
+
+bailout:
+  mdbx_txn_abort(txn);
+  return rc;
+}
+
+/* Верхняя граница интервала log2-гистограммы, в который попадает
+ * заданная доля замеров. */
+static uint64_t latency_percentile(const MDBX_latency_hist *hist, double fraction) {
+  const uint64_t target = (uint64_t)(hist->count * fraction + 0.5);
+  uint64_t accumulated = 0;
+  for (unsigned i = 0; i < MDBX_LATENCY_BUCKETS; ++i) {
+    accumulated += hist->buckets[i];
+    if (accumulated >= target && accumulated)
+      return UINT64_C(2) << i;
+  }
+  return UINT64_C(2) << (MDBX_LATENCY_BUCKETS - 1);
+}
+
+static int print_latency(MDBX_env *env) {
+  static const char *const names[MDBX_LATENCY_KINDS] = {"read-begin", "get", "seek", "faulted", "write-lock"};
+  printf("Latency (for current session, microseconds, upper bounds of log2 buckets):\n");
+  printf("  %-10s %12s %10s %10s %10s %10s %10s\n", "operation", "count", "mean", "p50", "p90", "p99", "max");
+  for (unsigned kind = 0; kind < MDBX_LATENCY_KINDS; ++kind) {
+    MDBX_latency_hist hist;
+    int rc = mdbx_env_latency_hist(env, (MDBX_latency_kind_t)kind, true, &hist, sizeof(hist));
+    if (rc == MDBX_ENOSYS) {
+      printf("  not available, libmdbx was built without MDBX_ENABLE_LATENCY_HIST\n");
+      return MDBX_SUCCESS;
+    }
+    if (unlikely(rc != MDBX_SUCCESS)) {
+      error("mdbx_env_latency_hist", rc);
+      return rc;
+    }
+    if (hist.count == 0)
+      continue;
+    unsigned top = MDBX_LATENCY_BUCKETS - 1;
+    while (top && !hist.buckets[top])
+      --top;
+    printf("  %-10s %12" PRIu64 " %10.1f %10.1f %10.1f %10.1f %10.1f\n", names[kind], hist.count,
+           hist.total_ns / 1e3 / hist.count, latency_percentile(&hist, 0.5) / 1e3,
+           latency_percentile(&hist, 0.9) / 1e3, latency_percentile(&hist, 0.99) / 1e3, (UINT64_C(2) << top) / 1e3);
+  }
+  return MDBX_SUCCESS;
+}
+
 int main(int argc, char *argv[]) {
   int opt, rc;
   MDBX_env *env;
@@ -116,8 +382,11 @@ int main(int argc, char *argv[]) {
   prog = argv[0];
   char *envname;
   char *table = nullptr;
-  bool alldbs = false, envinfo = false, pgop = false;
+  bool alldbs = false, envinfo = false, pgop = false, latency = false;
   int freinfo = 0, rdrinfo = 0;
+  double watch_interval = 0;
+  unsigned watch_count = 0;
+  bool json = false;
 
   if (argc < 2)
     usage(prog);
@@ -131,7 +400,10 @@ int main(int argc, char *argv[]) {
                        "f"
                        "n"
                        "r"
-                       "s:")) != EOF) {
+                       "l"
+                       "s:"
+                       "w:"
+                       "j")) != EOF) {
     switch (opt) {
     case 'V':
       printf("mdbx_stat version %d.%d.%d.%d\n"
@@ -166,17 +438,42 @@ int main(int argc, char *argv[]) {
     case 'r':
       rdrinfo += 1;
       break;
+    case 'l':
+      latency = true;
+      break;
     case 's':
       if (alldbs)
         usage(prog);
       table = optarg;
       break;
+    case 'w': {
+      char *end = nullptr;
+      watch_interval = strtod(optarg, &end);
+      if (end && strncmp(end, "ms", 2) == 0) {
+        watch_interval /= 1000;
+        end += 2;
+      } else if (end && *end == 's')
+        end += 1;
+      if (end && *end == ',') {
+        char *tail = nullptr;
+        const unsigned long n = strtoul(end + 1, &tail, 0);
+        if (!tail || *tail || n < 1 || n > UINT_MAX)
+          usage(prog);
+        watch_count = (unsigned)n;
+        end = tail;
+      }
+      if (!end || *end || !(watch_interval >= 0.01 && watch_interval <= 86400))
+        usage(prog);
+    } break;
+    case 'j':
+      json = true;
+      break;
     default:
       usage(prog);
     }
   }
 
-  if (optind != argc - 1)
+  if (optind != argc - 1 || (json && !watch_interval))
     usage(prog);
 
 #if defined(_WIN32) || defined(_WIN64)
@@ -194,7 +491,7 @@ int main(int argc, char *argv[]) {
 
   envname = argv[optind];
   envname = argv[optind];
-  if (!quiet) {
+  if (!quiet && !json) {
     printf("mdbx_stat %s (%s, T-%s)\nRunning for %s...\n", mdbx_version.git.describe, mdbx_version.git.datetime,
            mdbx_version.git.tree, envname);
     fflush(nullptr);
@@ -221,6 +518,11 @@ int main(int argc, char *argv[]) {
     goto env_close;
   }
 
+  if (watch_interval) {
+    rc = watch(env, watch_interval, watch_count, json);
+    goto env_close;
+  }
+
   rc = mdbx_txn_begin(env, nullptr, MDBX_TXN_RDONLY, &txn);
   if (unlikely(rc != MDBX_SUCCESS)) {
     error("mdbx_txn_begin", rc);
@@ -262,6 +564,18 @@ int main(int argc, char *argv[]) {
            mei.mi_pgop_stat.msync);
     printf("    fSync: %8" PRIu64 "\t// number of explicit fsync-to-disk operations (not a pages)\n",
            mei.mi_pgop_stat.fsync);
+    printf("Write-transaction Lock (for current session):\n");
+    printf("  Acquired: %8" PRIu64 "\t// number of the lock acquisitions\n", mei.mi_wrt_lock.acquisitions);
+    printf(" Contended: %8" PRIu64 "\t// number of acquisitions with waiting\n", mei.mi_wrt_lock.contended);
+    printf("    Waited: %8.3f\t// total waiting time in seconds\n", mei.mi_wrt_lock.wait_seconds16dot16 / 65536.0);
+    printf("   Waiters: %8u\t// current number of waiting threads\n", mei.mi_wrt_lock.waiters);
+    printf("  MaxWaits: %8u\t// peak number of waiting threads\n", mei.mi_wrt_lock.max_waiters);
+  }
+
+  if (latency) {
+    rc = print_latency(env);
+    if (unlikely(rc != MDBX_SUCCESS))
+      goto txn_abort;
   }
 
   if (envinfo) {
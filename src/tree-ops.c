@@ -438,6 +438,7 @@ static int page_merge(MDBX_cursor *csrc, MDBX_cursor *cdst) {
   const page_t *const psrc = csrc->pg[csrc->top];
   page_t *pdst = cdst->pg[cdst->top];
   DEBUG("merging page %" PRIaPGNO " into %" PRIaPGNO, psrc->pgno, pdst->pgno);
+  USDT_PROBE4(page_merge, csrc->txn->txnid, cursor_dbi(csrc), psrc->pgno, pdst->pgno);
 
   cASSERT(csrc, page_type(psrc) == page_type(pdst));
   cASSERT(csrc, csrc->clc == cdst->clc && csrc->tree == cdst->tree);
@@ -609,6 +610,9 @@ static int page_merge(MDBX_cursor *csrc, MDBX_cursor *cdst) {
 #if MDBX_ENABLE_PGOP_STAT
   cdst->txn->env->lck->pgops.merge.weak += 1;
 #endif /* MDBX_ENABLE_PGOP_STAT */
+#if MDBX_ENABLE_DBI_OPSTAT
+  opstat_add(&cursor_opstat(cdst)->merge, 1);
+#endif /* MDBX_ENABLE_DBI_OPSTAT */
 
   if (is_leaf(cdst->pg[cdst->top])) {
     /* LY: don't touch cursor if top-page is a LEAF */
@@ -965,6 +969,7 @@ int page_split(MDBX_cursor *mc, const MDBX_val *const newkey, MDBX_val *const ne
   page_t *const sister = npr.page;
   sister->dupfix_ksize = mp->dupfix_ksize;
   DEBUG("new sibling: page %" PRIaPGNO, sister->pgno);
+  USDT_PROBE4(page_split, mc->txn->txnid, cursor_dbi(mc), mp->pgno, sister->pgno);
 
   /* Usually when splitting the root page, the cursor
    * height is 1. But when called from tree_propagate_key,
@@ -1511,6 +1516,9 @@ done:
 #if MDBX_ENABLE_PGOP_STAT
     env->lck->pgops.split.weak += 1;
 #endif /* MDBX_ENABLE_PGOP_STAT */
+#if MDBX_ENABLE_DBI_OPSTAT
+    opstat_add(&cursor_opstat(mc)->split, 1);
+#endif /* MDBX_ENABLE_DBI_OPSTAT */
   }
 
   DEBUG("<< mp #%u, rc %d", mp->pgno, rc);
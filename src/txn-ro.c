@@ -6,10 +6,13 @@
 static inline int txn_ro_rslot(MDBX_txn *txn) {
   reader_slot_t *slot = txn->ro.slot;
   STATIC_ASSERT(sizeof(uintptr_t) <= sizeof(slot->tid));
+  /* Транзакция с MDBX_NOSTICKYTHREADS в режиме привязки к потокам
+   * удерживает разделяемый снимок и использует отдельный слот без TLS. */
+  const bool sticky = (txn->flags & MDBX_NOSTICKYTHREADS) == 0;
   if (likely(slot)) {
     if (likely(slot->pid.weak == txn->env->pid && slot->txnid.weak >= SAFE64_INVALID_THRESHOLD)) {
       tASSERT(txn, slot->pid.weak == osal_getpid());
-      tASSERT(txn, slot->tid.weak == ((txn->env->flags & MDBX_NOSTICKYTHREADS) ? 0 : osal_thread_self()));
+      tASSERT(txn, slot->tid.weak == (sticky ? osal_thread_self() : 0));
       return MDBX_SUCCESS;
     }
     return MDBX_BAD_RSLOT;
@@ -19,13 +22,13 @@ static inline int txn_ro_rslot(MDBX_txn *txn) {
     return MDBX_SUCCESS;
 
   MDBX_env *const env = txn->env;
-  if (env->flags & ENV_TXKEY) {
-    eASSERT(env, !(env->flags & MDBX_NOSTICKYTHREADS));
+  if (sticky) {
+    eASSERT(env, (env->flags & (MDBX_NOSTICKYTHREADS | ENV_TXKEY)) == ENV_TXKEY);
     slot = thread_rthc_get(env->me_txkey);
     if (likely(slot)) {
       if (likely(slot->pid.weak == env->pid && slot->txnid.weak >= SAFE64_INVALID_THRESHOLD)) {
         tASSERT(txn, slot->pid.weak == osal_getpid());
-        tASSERT(txn, slot->tid.weak == ((env->flags & MDBX_NOSTICKYTHREADS) ? 0 : osal_thread_self()));
+        tASSERT(txn, slot->tid.weak == osal_thread_self());
         txn->ro.slot = slot;
         return MDBX_SUCCESS;
       }
@@ -33,19 +36,27 @@ static inline int txn_ro_rslot(MDBX_txn *txn) {
         return MDBX_BAD_RSLOT;
       thread_rthc_set(env->me_txkey, nullptr);
     }
-  } else {
-    eASSERT(env, (env->flags & MDBX_NOSTICKYTHREADS));
   }
 
-  bsr_t brs = mvcc_bind_slot(env);
+  bsr_t brs = mvcc_bind_slot(env, sticky);
   if (likely(brs.err == MDBX_SUCCESS)) {
     tASSERT(txn, brs.slot->pid.weak == osal_getpid());
-    tASSERT(txn, brs.slot->tid.weak == ((env->flags & MDBX_NOSTICKYTHREADS) ? 0 : osal_thread_self()));
+    tASSERT(txn, brs.slot->tid.weak == (sticky ? osal_thread_self() : 0));
   }
   txn->ro.slot = brs.slot;
   return brs.err;
 }
 
+/* Проверяет что мета-страница содержит тот-же MVCC-снимок, который был
+ * прочитан при предыдущем запуске сброшенной транзакции, что позволяет
+ * повторно использовать его состояние без выборки и проверки когерентности. */
+static inline bool txn_ro_unchanged(const MDBX_txn *txn, const meta_ptr_t head) {
+  return head.txnid == txn->txnid && likely(txn->env->stuck_meta < 0) &&
+         memcmp(&txn->geo, &head.ptr_c->geometry, sizeof(txn->geo)) == 0 &&
+         memcmp(txn->dbs, &head.ptr_c->trees, sizeof(head.ptr_c->trees)) == 0 &&
+         memcmp(&txn->canary, &head.ptr_c->canary, sizeof(txn->canary)) == 0;
+}
+
 static inline int txn_ro_seize(MDBX_txn *txn) {
   /* Seek & fetch the last meta */
   troika_t troika = meta_tap(txn->env);
@@ -62,10 +73,10 @@ static inline int txn_ro_seize(MDBX_txn *txn) {
       atomic_store64(&r->snapshot_pages_retired, unaligned_peek_u64_volatile(4, head.ptr_v->pages_retired), mo_Relaxed);
       safe64_write(&r->txnid, head.txnid);
       eASSERT(env, r->pid.weak == osal_getpid());
-      eASSERT(env, r->tid.weak == ((env->flags & MDBX_NOSTICKYTHREADS) ? 0 : osal_thread_self()));
+      eASSERT(env, r->tid.weak == ((txn->flags & MDBX_NOSTICKYTHREADS) ? 0 : osal_thread_self()));
       eASSERT(env, r->txnid.weak == head.txnid ||
                        (r->txnid.weak >= SAFE64_INVALID_THRESHOLD && head.txnid < env->lck->cached_oldest.weak));
-      atomic_store32(&env->lck->rdt_refresh_flag, true, mo_AcquireRelease);
+      lck_rdt_changed(env->lck, r);
     } else {
       /* exclusive mode without lck */
       eASSERT(env, !env->lck_mmap.lck && env->lck == lckless_stub(env));
@@ -77,8 +88,13 @@ static inline int txn_ro_seize(MDBX_txn *txn) {
       continue;
     }
 
-    /* Snap the state from current meta-head */
-    int err = coherency_fetch_head(txn, head, &timestamp);
+    /* Snap the state from current meta-head, unless it is unchanged since
+     * the previous run of the reset txn. */
+    int err = MDBX_SUCCESS;
+    if (!txn->ro.reuse_n_dbi || !txn_ro_unchanged(txn, head)) {
+      txn->ro.reuse_n_dbi = 0;
+      err = coherency_fetch_head(txn, head, &timestamp);
+    }
     jitter4testing(false);
     if (unlikely(err != MDBX_SUCCESS)) {
       if (err != MDBX_RESULT_TRUE)
@@ -109,7 +125,8 @@ static inline int txn_ro_seize(MDBX_txn *txn) {
 int txn_ro_start(MDBX_txn *txn, unsigned flags) {
   MDBX_env *const env = txn->env;
   eASSERT(env, flags & MDBX_TXN_RDONLY);
-  eASSERT(env, (flags & ~(txn_ro_begin_flags | MDBX_WRITEMAP | MDBX_NOSTICKYTHREADS)) == 0);
+  eASSERT(env, (flags & ~(txn_ro_begin_flags | MDBX_WRITEMAP | MDBX_NOSTICKYTHREADS | txn_snapshot_holder)) == 0);
+  eASSERT(env, !(flags & txn_snapshot_holder) || (flags & MDBX_NOSTICKYTHREADS));
   txn->flags = flags;
 
   int err = txn_ro_rslot(txn);
@@ -131,8 +148,8 @@ int txn_ro_start(MDBX_txn *txn, unsigned flags) {
     return MDBX_SUCCESS;
   }
 
-  txn->owner = likely(r) ? (uintptr_t)r->tid.weak : ((env->flags & MDBX_NOSTICKYTHREADS) ? 0 : osal_thread_self());
-  if ((env->flags & MDBX_NOSTICKYTHREADS) == 0 && env->txn && unlikely(env->basal_txn->owner == txn->owner) &&
+  txn->owner = likely(r) ? (uintptr_t)r->tid.weak : ((flags & MDBX_NOSTICKYTHREADS) ? 0 : osal_thread_self());
+  if ((flags & MDBX_NOSTICKYTHREADS) == 0 && env->txn && unlikely(env->basal_txn->owner == txn->owner) &&
       (globals.runtime_flags & MDBX_DBG_LEGACY_OVERLAP) == 0) {
     err = MDBX_TXN_OVERLAPPING;
     goto bailout;
@@ -153,14 +170,60 @@ int txn_ro_start(MDBX_txn *txn, unsigned flags) {
 bailout:
   tASSERT(txn, err != MDBX_SUCCESS);
   txn->txnid = INVALID_TXNID;
-  if (likely(txn->ro.slot))
+  if (likely(txn->ro.slot)) {
     safe64_reset(&txn->ro.slot->txnid, true);
+    lck_rdt_changed(env->lck, txn->ro.slot);
+  }
   return err;
 }
 
+/* Запускает транзакцию-представление разделяемого снимка txn->ro.snapshot,
+ * ссылка на который уже захвачена вызывающей стороной. Слот в таблице
+ * читателей не используется, так как снимок удерживается транзакцией-владельцем. */
+int txn_ro_share(MDBX_txn *txn, unsigned flags) {
+  MDBX_env *const env = txn->env;
+  const MDBX_txn *const origin = txn->ro.snapshot->txn;
+  eASSERT(env, flags & MDBX_TXN_RDONLY);
+  eASSERT(env, (flags & ~(txn_ro_begin_flags | MDBX_WRITEMAP | MDBX_NOSTICKYTHREADS)) == 0);
+  eASSERT(env, txn->ro.slot == nullptr && origin->env == env);
+  eASSERT(env, (origin->flags & (MDBX_TXN_RDONLY | MDBX_TXN_FINISHED)) == MDBX_TXN_RDONLY);
+  txn->flags = flags;
+  txn->ro.reuse_n_dbi = 0;
+
+  txn->owner = (flags & MDBX_NOSTICKYTHREADS) ? 0 : osal_thread_self();
+  if ((flags & MDBX_NOSTICKYTHREADS) == 0 && env->txn && unlikely(env->basal_txn->owner == txn->owner) &&
+      (globals.runtime_flags & MDBX_DBG_LEGACY_OVERLAP) == 0) {
+    txn->txnid = INVALID_TXNID;
+    return MDBX_TXN_OVERLAPPING;
+  }
+
+  txn->txnid = origin->txnid;
+  txn->geo = origin->geo;
+  memcpy(txn->dbs, origin->dbs, CORE_DBS * sizeof(tree_t));
+  txn->canary = origin->canary;
+  return MDBX_SUCCESS;
+}
+
+void txn_ro_snapshot_release(MDBX_snapshot *snapshot) {
+  tASSERT(snapshot->txn, snapshot->signature == snapshot_signature && snapshot->refs.weak > 0);
+  if (atomic_sub32(&snapshot->refs, 1) == 1) {
+    int err = txn_end(snapshot->txn, TXN_END_ABORT | TXN_END_SLOT | TXN_END_FREE);
+    if (unlikely(err != MDBX_SUCCESS))
+      ERROR("%s, err %d", "failed to release a shared snapshot", err);
+    snapshot->signature = 0;
+    osal_free(snapshot);
+  }
+}
+
 int txn_ro_end(MDBX_txn *txn, unsigned mode) {
   MDBX_env *const env = txn->env;
   tASSERT(txn, (txn->flags & txn_may_have_cursors) == 0);
+  if ((txn->flags & MDBX_TXN_FINISHED) == 0)
+    /* keep the DBI-handles states for a zero-work renewal if the snapshot remains unchanged */
+    txn->ro.reuse_n_dbi = ((mode & TXN_END_OPMASK) == TXN_END_RESET &&
+                           (txn->flags & (MDBX_TXN_ERROR | MDBX_TXN_PARKED)) == 0 && !txn->ro.snapshot)
+                              ? txn->n_dbi
+                              : 0;
   txn->n_dbi = 0; /* prevent further DBI activity */
   if (txn->ro.slot) {
     reader_slot_t *slot = txn->ro.slot;
@@ -186,13 +249,13 @@ int txn_ro_end(MDBX_txn *txn, unsigned mode) {
         dxb_sanitize_tail(env, nullptr);
         atomic_store32(&slot->snapshot_pages_used, 0, mo_Relaxed);
         safe64_reset(&slot->txnid, true);
-        atomic_store32(&env->lck->rdt_refresh_flag, true, mo_Relaxed);
+        lck_rdt_changed(env->lck, slot);
       } else {
         eASSERT(env, slot->pid.weak == env->pid);
         eASSERT(env, slot->txnid.weak >= SAFE64_INVALID_THRESHOLD);
       }
       if (mode & TXN_END_SLOT) {
-        if ((env->flags & ENV_TXKEY) == 0)
+        if ((env->flags & ENV_TXKEY) == 0 || (txn->flags & MDBX_NOSTICKYTHREADS))
           atomic_store32(&slot->pid, 0, mo_Relaxed);
         txn->ro.slot = nullptr;
       }
@@ -202,6 +265,12 @@ int txn_ro_end(MDBX_txn *txn, unsigned mode) {
   if (txn->flags & txn_shrink_allowed)
     imports.srwl_ReleaseShared(&env->remap_guard);
 #endif
+  if (txn->ro.snapshot) {
+    /* the view of a shared snapshot, which may be the last reference */
+    MDBX_snapshot *const snapshot = txn->ro.snapshot;
+    txn->ro.snapshot = nullptr;
+    txn_ro_snapshot_release(snapshot);
+  }
   txn->flags = ((mode & TXN_END_OPMASK) != TXN_END_OUSTED) ? MDBX_TXN_RDONLY | MDBX_TXN_FINISHED
                                                            : MDBX_TXN_RDONLY | MDBX_TXN_FINISHED | MDBX_TXN_OUSTED;
   txn->owner = 0;
@@ -234,7 +303,7 @@ int txn_ro_park(MDBX_txn *txn, bool autounpark) {
   }
 
   atomic_store64(&rslot->tid, MDBX_TID_TXN_PARKED, mo_AcquireRelease);
-  atomic_store32(&txn->env->lck->rdt_refresh_flag, true, mo_Relaxed);
+  lck_rdt_changed(txn->env->lck, rslot);
   txn->flags += autounpark ? MDBX_TXN_PARKED | MDBX_TXN_AUTOUNPARK : MDBX_TXN_PARKED;
   return MDBX_SUCCESS;
 }
@@ -130,7 +130,7 @@ int txn_renew(MDBX_txn *txn, unsigned flags) {
 
   flags |= env->flags & (MDBX_NOSTICKYTHREADS | MDBX_WRITEMAP);
   if (flags & MDBX_TXN_RDONLY) {
-    rc = txn_ro_start(txn, flags);
+    rc = likely(!txn->ro.snapshot) ? txn_ro_start(txn, flags) : txn_ro_share(txn, flags);
     if (unlikely(rc != MDBX_SUCCESS))
       goto bailout;
     ENSURE(env, txn->txnid >=
@@ -174,17 +174,28 @@ int txn_renew(MDBX_txn *txn, unsigned flags) {
   /* Setup db info */
   tASSERT(txn, txn->dbs[FREE_DBI].flags == MDBX_INTEGERKEY);
   tASSERT(txn, check_table_flags(txn->dbs[MAIN_DBI].flags));
-  VALGRIND_MAKE_MEM_UNDEFINED(txn->dbi_state, env->max_dbi);
+  if ((flags & MDBX_TXN_RDONLY) && txn->ro.reuse_n_dbi) {
+    /* MVCC-снимок не изменился с момента сброса транзакции, поэтому можно
+     * использовать ранее загруженное состояние DBI-хендлов, за исключением
+     * закрытых или переоткрытых в ходе предыдущего запуска. */
+    txn->n_dbi = txn->ro.reuse_n_dbi;
+    TXN_FOREACH_DBI_USER(txn, i) {
+      if (txn->dbi_state[i] & DBI_OLDEN)
+        txn->dbi_state[i] = 0;
+    }
+  } else {
+    VALGRIND_MAKE_MEM_UNDEFINED(txn->dbi_state, env->max_dbi);
 #if MDBX_ENABLE_DBI_SPARSE
-  txn->n_dbi = CORE_DBS;
-  VALGRIND_MAKE_MEM_UNDEFINED(txn->dbi_sparse,
-                              ceil_powerof2(env->max_dbi, CHAR_BIT * sizeof(txn->dbi_sparse[0])) / CHAR_BIT);
-  txn->dbi_sparse[0] = (1u << CORE_DBS) - 1;
+    txn->n_dbi = CORE_DBS;
+    VALGRIND_MAKE_MEM_UNDEFINED(txn->dbi_sparse,
+                                ceil_powerof2(env->max_dbi, CHAR_BIT * sizeof(txn->dbi_sparse[0])) / CHAR_BIT);
+    txn->dbi_sparse[0] = (1u << CORE_DBS) - 1;
 #else
-  txn->n_dbi = (env->n_dbi < 8) ? env->n_dbi : 8;
-  if (txn->n_dbi > CORE_DBS)
-    memset(txn->dbi_state + CORE_DBS, 0, txn->n_dbi - CORE_DBS);
+    txn->n_dbi = (env->n_dbi < 8) ? env->n_dbi : 8;
+    if (txn->n_dbi > CORE_DBS)
+      memset(txn->dbi_state + CORE_DBS, 0, txn->n_dbi - CORE_DBS);
 #endif /* MDBX_ENABLE_DBI_SPARSE */
+  }
   txn->dbi_state[FREE_DBI] = DBI_LINDO | DBI_VALID;
   txn->dbi_state[MAIN_DBI] = DBI_LINDO | DBI_VALID;
   txn->cursors[FREE_DBI] = nullptr;
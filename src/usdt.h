@@ -0,0 +1,69 @@
+/// \copyright SPDX-License-Identifier: Apache-2.0
+/// \author Леонид Юрьев aka Leonid Yuriev <leo@yuriev.ru> \date 2025
+
+#pragma once
+
+#include "essentials.h"
+
+/* Статические точки трассировки (USDT) в стиле DTrace/SystemTap.
+ *
+ * При сборке с MDBX_ENABLE_USDT=1 каждая точка порождает единственную
+ * инструкцию NOP и описание в секции .note.stapsdt, которые без подключения
+ * трассировщика не влекут накладных расходов, а при подключении (bpftrace,
+ * perf, SystemTap) позволяют получить аргументы, например:
+ *
+ *   bpftrace -e 'usdt:./libmdbx.so:mdbx:commit { @[arg2] = hist(arg3); }'
+ *
+ * Длительности передаются в наносекундах и замеряются только в медленных
+ * путях (фиксация транзакции, переработка GC, вытеснение страниц, изменение
+ * размера БД и т.п.), где стоимость чтения часов пренебрежимо мала.
+ * Без MDBX_ENABLE_USDT макросы раскрываются в пустые операторы, а их
+ * аргументы не вычисляются.
+ *
+ * Точки провайдера mdbx и их аргументы:
+ *  - txn_begin(txnid, flags), txn_abort(txnid, flags);
+ *  - commit(txnid, err, whole_ns) для всех транзакций;
+ *  - commit_phases(txnid, prep_ns, gc_ns, audit_ns, write_ns, sync_ns)
+ *    для пишущих транзакций, см. MDBX_commit_latency;
+ *  - page_split(txnid, dbi, pgno, new_pgno),
+ *    page_merge(txnid, dbi, src_pgno, dst_pgno);
+ *  - spill(txnid, entries, npages, ns), unspill(txnid, pgno, npages);
+ *  - gc_alloc(txnid, dbi, num, alloc_flags, err, ns) для медленного пути
+ *    выделения страниц, т.е. при исчерпании loose- и repnl-страниц;
+ *  - kick_laggards(txnid, straggler, oldest, retry, ns);
+ *  - dxb_resize(prev_pgno, size_pgno, limit_pgno, mode, err, ns);
+ *  - coherency_timeout(pgno, waited_ns, err). */
+
+#if MDBX_ENABLE_USDT
+#if defined(__has_include)
+#if !__has_include(<sys/sdt.h>)
+#error "MDBX_ENABLE_USDT requires the <sys/sdt.h>, e.g. from the systemtap-sdt-dev package"
+#endif
+#endif /* __has_include */
+#include <sys/sdt.h>
+
+#define USDT_PROBE(name) DTRACE_PROBE(mdbx, name)
+#define USDT_PROBE1(name, a1) DTRACE_PROBE1(mdbx, name, a1)
+#define USDT_PROBE2(name, a1, a2) DTRACE_PROBE2(mdbx, name, a1, a2)
+#define USDT_PROBE3(name, a1, a2, a3) DTRACE_PROBE3(mdbx, name, a1, a2, a3)
+#define USDT_PROBE4(name, a1, a2, a3, a4) DTRACE_PROBE4(mdbx, name, a1, a2, a3, a4)
+#define USDT_PROBE5(name, a1, a2, a3, a4, a5) DTRACE_PROBE5(mdbx, name, a1, a2, a3, a4, a5)
+#define USDT_PROBE6(name, a1, a2, a3, a4, a5, a6) DTRACE_PROBE6(mdbx, name, a1, a2, a3, a4, a5, a6)
+
+#define usdt_monotime() osal_monotime()
+#define usdt_ns_since(monotime) osal_monotime_to_ns(osal_monotime() - (monotime))
+#else
+#define USDT_NOOP                                                                                                      \
+  do {                                                                                                                 \
+  } while (0)
+#define USDT_PROBE(name) USDT_NOOP
+#define USDT_PROBE1(name, a1) USDT_NOOP
+#define USDT_PROBE2(name, a1, a2) USDT_NOOP
+#define USDT_PROBE3(name, a1, a2, a3) USDT_NOOP
+#define USDT_PROBE4(name, a1, a2, a3, a4) USDT_NOOP
+#define USDT_PROBE5(name, a1, a2, a3, a4, a5) USDT_NOOP
+#define USDT_PROBE6(name, a1, a2, a3, a4, a5, a6) USDT_NOOP
+
+#define usdt_monotime() UINT64_C(0)
+#define usdt_ns_since(monotime) UINT64_C(0)
+#endif /* MDBX_ENABLE_USDT */
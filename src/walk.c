@@ -29,6 +29,66 @@ static page_type_t walk_subpage_type(const page_t *sp) {
   }
 }
 
+typedef struct walk_range {
+  pgno_t pgno, npages;
+  /* the index of referencing node, since a corrupted page may refer to the same page twice */
+  size_t order;
+} walk_range_t;
+
+#define WALK_RANGE_CMP(first, last)                                                                                    \
+  ((first).pgno < (last).pgno || ((first).pgno == (last).pgno && (first).order < (last).order))
+SORT_IMPL(walk_range_sort, false, walk_range_t, WALK_RANGE_CMP)
+
+__cold static void walk_prefetch_flush(const MDBX_env *env, walk_range_t *begin, walk_range_t *end) {
+  walk_range_sort(begin, end);
+  pgno_t pgno = begin->pgno, edge = begin->pgno + begin->npages;
+  while (++begin < end) {
+    if (begin->pgno > edge) {
+      dxb_prefetch(env, pgno, edge - pgno);
+      pgno = begin->pgno;
+    }
+    if (edge < begin->pgno + begin->npages)
+      edge = begin->pgno + begin->npages;
+  }
+  dxb_prefetch(env, pgno, edge - pgno);
+}
+
+/* Advises the pages referenced by the given one, i.e. the next frontier of
+ * a traversal, in ascending physical order with adjacent ones coalesced.
+ * So on a cold cache the tree-ordered traversal is served by a few sequential
+ * reads instead of a lot of random ones. */
+__cold void walk_prefetch(const MDBX_txn *txn, const page_t *mp) {
+  if (is_dupfix_leaf(mp) || !(mp->flags & (P_BRANCH | P_LEAF)))
+    return;
+
+  walk_range_t batch[256], *end = batch;
+  const size_t nkeys = page_numkeys(mp);
+  for (size_t i = 0; i < nkeys; ++i) {
+    const node_t *node = page_node(mp, i);
+    walk_range_t range = {.pgno = P_INVALID, .npages = 1, .order = i};
+    if (is_branch(mp))
+      range.pgno = node_pgno(node);
+    else if (node_flags(node) == N_BIG) {
+      range.pgno = node_largedata_pgno(node);
+      range.npages = largechunk_npages(txn->env, node_ds(node));
+    } else if ((node_flags(node) & N_TREE) && node_ds(node) == sizeof(tree_t))
+      range.pgno = peek_pgno(ptr_disp(node_data(node), offsetof(tree_t, root)));
+
+    /* skip empty trees, as well as any garbage of a corrupted page */
+    if (range.pgno < NUM_METAS || range.pgno >= txn->geo.first_unallocated)
+      continue;
+    if (range.npages > txn->geo.first_unallocated - range.pgno)
+      range.npages = txn->geo.first_unallocated - range.pgno;
+    *end = range;
+    if (++end == batch + ARRAY_LENGTH(batch)) {
+      walk_prefetch_flush(txn->env, batch, end);
+      end = batch;
+    }
+  }
+  if (end > batch)
+    walk_prefetch_flush(txn->env, batch, end);
+}
+
 /* Depth-first tree traversal. */
 __cold static int walk_pgno(walk_ctx_t *ctx, walk_tbl_t *tbl, const pgno_t pgno, txnid_t parent_txnid,
                             const pgno_t parent_pgno) {
@@ -37,6 +97,8 @@ __cold static int walk_pgno(walk_ctx_t *ctx, walk_tbl_t *tbl, const pgno_t pgno,
   int err = page_get(ctx->cursor, pgno, &mp, parent_txnid);
 
   const page_type_t type = walk_page_type(mp);
+  if ((ctx->options & prefetch_children) && err == MDBX_SUCCESS && (type == page_branch || type == page_leaf))
+    walk_prefetch(ctx->txn, mp);
   const size_t nentries = mp ? page_numkeys(mp) : 0;
   size_t header_size = (mp && !is_dupfix_leaf(mp)) ? PAGEHDRSZ + mp->lower : PAGEHDRSZ;
   size_t payload_size = 0;
@@ -198,6 +260,8 @@ __cold static int walk_pgno(walk_ctx_t *ctx, walk_tbl_t *tbl, const pgno_t pgno,
         ERROR("%s/%d: %s %u", "MDBX_CORRUPTED", MDBX_CORRUPTED, "invalid sub-tree node size", (unsigned)node_ds(node));
         assert(err == MDBX_CORRUPTED);
         err = MDBX_CORRUPTED;
+      } else if (ctx->options & dont_walk_tables) {
+        /* the named tables will be walked separately by the caller */
       } else {
         tree_t aligned_db;
         memcpy(&aligned_db, node_data(node), sizeof(aligned_db));
@@ -15,7 +15,12 @@ typedef int walk_func(const size_t pgno, const unsigned number, void *const ctx,
                       const MDBX_error_t err, const size_t nentries, const size_t payload_bytes,
                       const size_t header_bytes, const size_t unused_bytes, const size_t parent_pgno);
 
-typedef enum walk_options { dont_check_keys_ordering = 1 } walk_options_t;
+typedef enum walk_options {
+  dont_check_keys_ordering = 1,
+  dont_walk_tables = 2,
+  /* advise the children of each visited page in advance, for cold-cache traversals */
+  prefetch_children = 4
+} walk_options_t;
 
 MDBX_INTERNAL int walk_pages(MDBX_txn *txn, walk_func *visitor, void *user, walk_options_t options);
 
@@ -29,3 +34,5 @@ typedef struct walk_ctx {
 } walk_ctx_t;
 
 MDBX_INTERNAL int walk_tbl(walk_ctx_t *ctx, walk_tbl_t *tbl);
+
+MDBX_INTERNAL void walk_prefetch(const MDBX_txn *txn, const page_t *mp);
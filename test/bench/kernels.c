@@ -0,0 +1,870 @@
+/// \copyright SPDX-License-Identifier: Apache-2.0
+/// \author Леонид Юрьев aka Leonid Yuriev <leo@yuriev.ru> \date 2025
+///
+/// mdbx_bench_kernels - microbenchmarks of internal hot kernels,
+/// built against the amalgamated internals of libmdbx.
+///
+
+#include "../../src/alloy.c"
+
+/*-----------------------------------------------------------------------------*/
+
+static struct {
+  bool json, list;
+  const char *filter;
+  const char *pathname;
+  unsigned repeat;
+  double target_ns;
+} opt = {false, false, nullptr, "mdbx_bench_kernels.db", 7, 20e6};
+
+static double timer_overhead_ns;
+static volatile size_t sink;
+static bool first_result = true;
+
+static uint64_t clock_ns(void) {
+#if defined(_WIN32) || defined(_WIN64)
+  static LARGE_INTEGER frequency;
+  LARGE_INTEGER counter;
+  if (!frequency.QuadPart)
+    QueryPerformanceFrequency(&frequency);
+  QueryPerformanceCounter(&counter);
+  return (uint64_t)(counter.QuadPart * 1e9 / frequency.QuadPart);
+#else
+  struct timespec ts;
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return ts.tv_sec * UINT64_C(1000000000) + ts.tv_nsec;
+#endif
+}
+
+static uint64_t prng_state = 42;
+static uint64_t prng(void) {
+  uint64_t z = (prng_state += UINT64_C(0x9E3779B97F4A7C15));
+  z = (z ^ (z >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+  z = (z ^ (z >> 27)) * UINT64_C(0x94D049BB133111EB);
+  return z ^ (z >> 31);
+}
+
+/* A benchmark case: the run() should perform the given number of operations
+ * and return the elapsed nanoseconds it has measured, so that kernels which
+ * mutate their input can restore it outside of the measured region. */
+typedef struct bench_case bench_case_t;
+struct bench_case {
+  const char *kernel;
+  char variant[32], distribution[32];
+  size_t size, items_per_op;
+  /* kernel is timed around each operation, so the timer overhead should be subtracted */
+  bool timed_per_op;
+  uint64_t (*run)(bench_case_t *bc, size_t iterations);
+  void *data, *pristine, *aux;
+  size_t param;
+};
+
+static bool selected(const char *kernel, const char *variant, const char *distribution) {
+  if (!opt.filter)
+    return true;
+  char name[128];
+  snprintf(name, sizeof(name), "%s/%s/%s", kernel, variant ? variant : "", distribution ? distribution : "");
+  return strstr(name, opt.filter) != nullptr;
+}
+
+/* Checks the case against the filter and reseeds the PRNG, so the data of
+ * each case doesn't depend on which other cases were selected. */
+static bool case_prepare(const bench_case_t *bc) {
+  prng_state = bc->size;
+  return selected(bc->kernel, bc->variant, bc->distribution);
+}
+
+static int cmp_double(const void *a, const void *b) {
+  const double x = *(const double *)a, y = *(const double *)b;
+  return (x > y) - (x < y);
+}
+
+static void measure(bench_case_t *bc) {
+  if (!selected(bc->kernel, bc->variant, bc->distribution))
+    return;
+  if (opt.list) {
+    printf("%s/%s/%s/%zu\n", bc->kernel, bc->variant, bc->distribution, bc->size);
+    return;
+  }
+
+  /* calibrate the number of iterations to fit the target duration */
+  size_t iterations = 1;
+  uint64_t elapsed;
+  while ((elapsed = bc->run(bc, iterations)) < opt.target_ns / 16 && iterations < SIZE_MAX / 4)
+    iterations <<= 1;
+  if (elapsed < 1)
+    elapsed = 1;
+  const double scale = opt.target_ns / opt.repeat / elapsed;
+  if (scale > 1)
+    iterations = (size_t)(iterations * scale);
+
+  double samples[64];
+  for (unsigned i = 0; i < opt.repeat; ++i) {
+    samples[i] = (double)bc->run(bc, iterations) / iterations;
+    if (bc->timed_per_op)
+      samples[i] = (samples[i] > timer_overhead_ns) ? samples[i] - timer_overhead_ns : 0;
+  }
+  qsort(samples, opt.repeat, sizeof(samples[0]), cmp_double);
+  const double min = samples[0];
+  const double median = (opt.repeat & 1) ? samples[opt.repeat / 2]
+                                         : (samples[opt.repeat / 2 - 1] + samples[opt.repeat / 2]) / 2;
+
+  if (opt.json) {
+    printf("%s\n    {\"kernel\":\"%s\",\"variant\":\"%s\",\"distribution\":\"%s\",\"size\":%zu,\"iterations\":%zu,"
+           "\"ns_per_op\":{\"min\":%.3f,\"median\":%.3f},\"ns_per_item\":%.4f}",
+           first_result ? "" : ",", bc->kernel, bc->variant, bc->distribution, bc->size, iterations, min, median,
+           min / bc->items_per_op);
+    first_result = false;
+  } else
+    printf("%-20s %-16s %-14s %8zu %12.1f %12.1f %10.3f\n", bc->kernel, bc->variant, bc->distribution, bc->size, min,
+           median, min / bc->items_per_op);
+  fflush(stdout);
+}
+
+/*-----------------------------------------------------------------------------*/
+/* cmp_* comparators */
+
+#define CMP_PAIRS 1024
+
+static uint64_t run_cmp(bench_case_t *bc, size_t iterations) {
+  MDBX_cmp_func *const cmp = (MDBX_cmp_func *)bc->aux;
+  const MDBX_val *const pairs = bc->data;
+  int acc = 0;
+  const uint64_t begin = clock_ns();
+  for (size_t i = 0; i < iterations; ++i) {
+    const size_t n = (i % CMP_PAIRS) * 2;
+    acc += cmp(&pairs[n], &pairs[n + 1]);
+  }
+  const uint64_t end = clock_ns();
+  sink += acc;
+  return end - begin;
+}
+
+static void bench_cmp(void) {
+  static const struct {
+    const char *name;
+    MDBX_cmp_func *func;
+    bool integer;
+  } comparators[] = {{"cmp_int_align4", cmp_int_align4, true},
+                     {"cmp_int_align2", cmp_int_align2, true},
+                     {"cmp_int_unaligned", cmp_int_unaligned, true},
+                     {"cmp_lexical", cmp_lexical, false},
+                     {"cmp_reverse", cmp_reverse, false},
+                     {"cmp_lenfast", cmp_lenfast, false}};
+  static const size_t lengths[] = {4, 8, 16, 64, 256};
+  static const char *const distributions[] = {"random", "prefix"};
+
+  for (size_t c = 0; c < ARRAY_LENGTH(comparators); ++c)
+    for (size_t l = 0; l < ARRAY_LENGTH(lengths); ++l) {
+      const size_t len = lengths[l];
+      if (comparators[c].integer != (len <= 8))
+        continue;
+      for (size_t d = 0; d < ARRAY_LENGTH(distributions); ++d) {
+        const bool prefix = d == 1;
+        if (comparators[c].integer && prefix)
+          continue;
+        bench_case_t bc = {.kernel = comparators[c].name, .size = len, .items_per_op = 1, .run = run_cmp};
+        snprintf(bc.variant, sizeof(bc.variant), "%s", "scalar");
+        snprintf(bc.distribution, sizeof(bc.distribution), "%s", distributions[d]);
+        if (!case_prepare(&bc))
+          continue;
+        bc.aux = (void *)comparators[c].func;
+        /* keys are placed at odd offsets to model unaligned nodes for the unaligned comparator */
+        const size_t stride = ceil_powerof2(len + 1, 8);
+        uint8_t *const bytes = osal_malloc(CMP_PAIRS * 2 * stride);
+        MDBX_val *const pairs = osal_malloc(CMP_PAIRS * 2 * sizeof(MDBX_val));
+        for (size_t i = 0; i < CMP_PAIRS * 2; ++i) {
+          uint8_t *const key = bytes + i * stride + (comparators[c].func == cmp_int_unaligned);
+          for (size_t j = 0; j < len; ++j)
+            key[j] = prefix ? (uint8_t)(j * 7) : (uint8_t)prng();
+          if (prefix)
+            key[len - 1] = (uint8_t)prng();
+          pairs[i].iov_base = key;
+          pairs[i].iov_len = len;
+        }
+        bc.data = pairs;
+        measure(&bc);
+        osal_free(pairs);
+        osal_free(bytes);
+      }
+    }
+}
+
+/*-----------------------------------------------------------------------------*/
+/* pnl_sort() and pnl_merge() */
+
+static const size_t pnl_sizes[] = {64, 1024, 16384, 262144};
+
+static void pnl_fill_unique(pnl_t pnl, size_t len) {
+  /* unique page numbers without sequences, in random order */
+  for (size_t i = 0; i < len; ++i)
+    pnl[i + 1] = (pgno_t)(NUM_METAS + i * 3 + prng() % 2);
+  for (size_t i = len; i > 1; --i) {
+    const size_t j = prng() % i;
+    const pgno_t t = pnl[i];
+    pnl[i] = pnl[j + 1];
+    pnl[j + 1] = t;
+  }
+  pnl_setsize(pnl, len);
+}
+
+static uint64_t run_pnl_sort(bench_case_t *bc, size_t iterations) {
+  pnl_t pnl = bc->data;
+  const_pnl_t pristine = bc->pristine;
+  uint64_t elapsed = 0;
+  for (size_t i = 0; i < iterations; ++i) {
+    memcpy(pnl, pristine, MDBX_PNL_SIZEOF(pristine));
+    const uint64_t begin = clock_ns();
+    pnl_sort_nochk(pnl);
+    elapsed += clock_ns() - begin;
+  }
+  sink += pnl[1];
+  return elapsed;
+}
+
+static uint64_t run_pnl_merge(bench_case_t *bc, size_t iterations) {
+  pnl_t dst = bc->data;
+  const_pnl_t pristine = bc->pristine;
+  const pnl_t src = bc->aux;
+  uint64_t elapsed = 0;
+  for (size_t i = 0; i < iterations; ++i) {
+    memcpy(dst, pristine, MDBX_PNL_SIZEOF(pristine));
+    const uint64_t begin = clock_ns();
+    sink += pnl_merge(dst, src);
+    elapsed += clock_ns() - begin;
+  }
+  return elapsed;
+}
+
+static void bench_pnl(void) {
+  static const char *const sort_distributions[] = {"random", "sorted", "reversed", "runs"};
+  for (size_t s = 0; s < ARRAY_LENGTH(pnl_sizes); ++s)
+    for (size_t d = 0; d < ARRAY_LENGTH(sort_distributions); ++d) {
+      const size_t len = pnl_sizes[s];
+      bench_case_t bc = {
+          .kernel = "pnl_sort", .size = len, .items_per_op = len, .timed_per_op = true, .run = run_pnl_sort};
+      snprintf(bc.variant, sizeof(bc.variant), "%s", (len < MDBX_RADIXSORT_THRESHOLD) ? "sort" : "radix");
+      snprintf(bc.distribution, sizeof(bc.distribution), "%s", sort_distributions[d]);
+      if (!case_prepare(&bc))
+        continue;
+      pnl_t pristine = pnl_alloc(len), pnl = pnl_alloc(len);
+      pnl_fill_unique(pristine, len);
+      if (d == 1 || d == 2 || d == 3)
+        pnl_sort_nochk(pristine);
+      if (d == 2)
+        for (size_t i = 1, j = len; i < j; ++i, --j) {
+          const pgno_t t = pristine[i];
+          pristine[i] = pristine[j];
+          pristine[j] = t;
+        }
+      if (d == 3)
+        /* sorted runs of 64 pages in random order, like after appending spans */
+        for (size_t i = len / 64; i > 1; --i) {
+          const size_t j = prng() % i;
+          for (size_t k = 1; k <= 64; ++k) {
+            const pgno_t t = pristine[(i - 1) * 64 + k];
+            pristine[(i - 1) * 64 + k] = pristine[j * 64 + k];
+            pristine[j * 64 + k] = t;
+          }
+        }
+      bc.data = pnl;
+      bc.pristine = pristine;
+      measure(&bc);
+      pnl_free(pnl);
+      pnl_free(pristine);
+    }
+
+  static const char *const merge_distributions[] = {"interleaved", "append"};
+  for (size_t s = 0; s < ARRAY_LENGTH(pnl_sizes); ++s)
+    for (size_t ratio = 1; ratio <= 8; ratio *= 8)
+      for (size_t d = 0; d < ARRAY_LENGTH(merge_distributions); ++d) {
+        const size_t dst_len = pnl_sizes[s], src_len = dst_len / ratio;
+        bench_case_t bc = {.kernel = "pnl_merge",
+                           .size = dst_len,
+                           .items_per_op = dst_len + src_len,
+                           .timed_per_op = true,
+                           .run = run_pnl_merge};
+        snprintf(bc.variant, sizeof(bc.variant), "src=1/%zu", ratio);
+        snprintf(bc.distribution, sizeof(bc.distribution), "%s", merge_distributions[d]);
+        if (!case_prepare(&bc))
+          continue;
+        pnl_t all = pnl_alloc(dst_len + src_len);
+        pnl_t pristine = pnl_alloc(dst_len), src = pnl_alloc(src_len), dst = pnl_alloc(dst_len + src_len);
+        pnl_fill_unique(all, dst_len + src_len);
+        pnl_sort_nochk(all);
+        size_t n_dst = 0, n_src = 0;
+        for (size_t i = 1; i <= dst_len + src_len; ++i) {
+          const bool to_src =
+              (d == 0) ? (n_src < src_len && (n_dst == dst_len || prng() % (dst_len + src_len) < src_len))
+                       : /* src pages all go ahead of dst ones in the list order */ (i <= src_len);
+          if (to_src)
+            src[++n_src] = all[i];
+          else
+            pristine[++n_dst] = all[i];
+        }
+        pnl_setsize(src, n_src);
+        pnl_setsize(pristine, n_dst);
+        bc.data = dst;
+        bc.pristine = pristine;
+        bc.aux = src;
+        measure(&bc);
+        pnl_free(all);
+        pnl_free(pristine);
+        pnl_free(src);
+        pnl_free(dst);
+      }
+}
+
+/*-----------------------------------------------------------------------------*/
+/* dpl_sort_slowpath() and dpl_search() on a standalone dirty-pages list */
+
+static const page_t dpl_stub_page = {INVALID_TXNID, 0, P_LEAF, {0}, 0};
+
+static MDBX_txn *dpl_txn_create(size_t len, size_t unsorted_tail) {
+  MDBX_txn *txn = osal_calloc(1, sizeof(MDBX_txn));
+  if (!txn || !dpl_reserve(txn, len + CURSOR_STACK_SIZE + 1)) {
+    fprintf(stderr, "dpl_reserve() failed\n");
+    exit(EXIT_FAILURE);
+  }
+  dpl_t *dl = txn->wr.dirtylist;
+  dpl_clear(dl);
+  for (size_t i = 1; i <= len; ++i) {
+    dl->items[i].ptr = (page_t *)&dpl_stub_page;
+    dl->items[i].pgno = (pgno_t)(NUM_METAS + (i - 1) * 3 + prng() % 2);
+    dl->items[i].npages = 1;
+  }
+  dpl_setlen(dl, len);
+  dl->sorted = len;
+  /* shuffle the tail which is treated as unsorted */
+  for (size_t i = unsorted_tail; i > 1; --i) {
+    const size_t j = len - unsorted_tail + 1 + prng() % i;
+    const dp_t t = dl->items[len - unsorted_tail + i];
+    dl->items[len - unsorted_tail + i] = dl->items[j];
+    dl->items[j] = t;
+  }
+  dl->sorted = len - unsorted_tail;
+  return txn;
+}
+
+static void dpl_txn_destroy(MDBX_txn *txn) {
+  dpl_free(txn);
+  osal_free(txn);
+}
+
+static uint64_t run_dpl_sort(bench_case_t *bc, size_t iterations) {
+  MDBX_txn *const txn = bc->data;
+  const dpl_t *const pristine = bc->pristine;
+  dpl_t *const dl = txn->wr.dirtylist;
+  const size_t bytes = sizeof(dpl_t) + (pristine->length + 2) * sizeof(dp_t);
+  uint64_t elapsed = 0;
+  for (size_t i = 0; i < iterations; ++i) {
+    const size_t detent = dl->detent;
+    memcpy(dl, pristine, bytes);
+    dl->detent = detent;
+    const uint64_t begin = clock_ns();
+    sink += dpl_sort_slowpath(txn)->length;
+    elapsed += clock_ns() - begin;
+  }
+  return elapsed;
+}
+
+static uint64_t run_dpl_search(bench_case_t *bc, size_t iterations) {
+  const MDBX_txn *const txn = bc->data;
+  const pgno_t *const queries = bc->aux;
+  size_t acc = 0;
+  const uint64_t begin = clock_ns();
+  for (size_t i = 0; i < iterations; ++i)
+    acc += dpl_search(txn, queries[i & 1023]);
+  const uint64_t end = clock_ns();
+  sink += acc;
+  return end - begin;
+}
+
+static void bench_dpl(void) {
+  static const size_t sizes[] = {64, 1024, 16384, 131072};
+  static const char *const sort_distributions[] = {"random", "tail=1/8"};
+  for (size_t s = 0; s < ARRAY_LENGTH(sizes); ++s)
+    for (size_t d = 0; d < ARRAY_LENGTH(sort_distributions); ++d) {
+      const size_t len = sizes[s], unsorted = d ? len / 8 : len;
+      bench_case_t bc = {
+          .kernel = "dpl_sort_slowpath", .size = len, .items_per_op = len, .timed_per_op = true, .run = run_dpl_sort};
+      snprintf(bc.variant, sizeof(bc.variant), "%s",
+               (unsorted >= MDBX_RADIXSORT_THRESHOLD) ? "radix" : (d ? "mergesort" : "sort"));
+      snprintf(bc.distribution, sizeof(bc.distribution), "%s", sort_distributions[d]);
+      if (!case_prepare(&bc))
+        continue;
+      MDBX_txn *const txn = dpl_txn_create(len, unsorted);
+      const size_t bytes = sizeof(dpl_t) + (len + 2) * sizeof(dp_t);
+      dpl_t *const pristine = osal_malloc(bytes);
+      memcpy(pristine, txn->wr.dirtylist, bytes);
+      bc.data = txn;
+      bc.pristine = pristine;
+      measure(&bc);
+      osal_free(pristine);
+      dpl_txn_destroy(txn);
+    }
+
+  static const char *const search_distributions[] = {"sorted", "tail=4"};
+  for (size_t s = 0; s < ARRAY_LENGTH(sizes); ++s)
+    for (size_t d = 0; d < ARRAY_LENGTH(search_distributions); ++d) {
+      const size_t len = sizes[s];
+      bench_case_t bc = {.kernel = "dpl_search", .size = len, .items_per_op = 1, .run = run_dpl_search};
+      snprintf(bc.variant, sizeof(bc.variant), "%s", "bsearch");
+      snprintf(bc.distribution, sizeof(bc.distribution), "%s", search_distributions[d]);
+      if (!case_prepare(&bc))
+        continue;
+      MDBX_txn *const txn = dpl_txn_create(len, d ? 4 : 0);
+      pgno_t *const queries = osal_malloc(1024 * sizeof(pgno_t));
+      for (size_t i = 0; i < 1024; ++i)
+        queries[i] = txn->wr.dirtylist->items[1 + prng() % len].pgno;
+      bc.data = txn;
+      bc.aux = queries;
+      measure(&bc);
+      osal_free(queries);
+      dpl_txn_destroy(txn);
+    }
+}
+
+/*-----------------------------------------------------------------------------*/
+/* rkl_* */
+
+static uint64_t run_rkl_push(bench_case_t *bc, size_t iterations) {
+  rkl_t *const rkl = bc->data;
+  const txnid_t *const ids = bc->aux;
+  uint64_t elapsed = 0;
+  for (size_t i = 0; i < iterations; ++i) {
+    rkl_clear(rkl);
+    const uint64_t begin = clock_ns();
+    for (size_t j = 0; j < bc->size; ++j)
+      if (unlikely(rkl_push(rkl, ids[j]) != MDBX_SUCCESS)) {
+        fprintf(stderr, "rkl_push() failed\n");
+        exit(EXIT_FAILURE);
+      }
+    elapsed += clock_ns() - begin;
+  }
+  sink += rkl_len(rkl);
+  return elapsed;
+}
+
+static uint64_t run_rkl_contain(bench_case_t *bc, size_t iterations) {
+  const rkl_t *const rkl = bc->data;
+  const txnid_t *const queries = bc->aux;
+  size_t acc = 0;
+  const uint64_t begin = clock_ns();
+  for (size_t i = 0; i < iterations; ++i)
+    acc += rkl_contain(rkl, queries[i & 1023]);
+  const uint64_t end = clock_ns();
+  sink += acc;
+  return end - begin;
+}
+
+static uint64_t run_rkl_iterate(bench_case_t *bc, size_t iterations) {
+  const rkl_t *const rkl = bc->data;
+  txnid_t acc = 0;
+  const uint64_t begin = clock_ns();
+  for (size_t i = 0; i < iterations; ++i) {
+    rkl_iter_t iter = rkl_iterator(rkl, false);
+    for (txnid_t id; (id = rkl_turn(&iter, false)) != 0;)
+      acc += id;
+  }
+  const uint64_t end = clock_ns();
+  sink += (size_t)acc;
+  return end - begin;
+}
+
+static void bench_rkl(void) {
+  static const size_t sizes[] = {16, 256, 4096, 65536};
+  /* "solid" ids form a continuous interval, "sparse" ones are random with
+   * holes, "mixed" has a half of ids in a few continuous runs */
+  static const char *const distributions[] = {"solid", "sparse", "mixed"};
+  for (size_t s = 0; s < ARRAY_LENGTH(sizes); ++s)
+    for (size_t d = 0; d < ARRAY_LENGTH(distributions); ++d) {
+      const size_t len = sizes[s];
+      prng_state = len;
+      txnid_t *const ids = osal_malloc(len * sizeof(txnid_t)), *const shuffled = osal_malloc(len * sizeof(txnid_t));
+      for (size_t i = 0; i < len; ++i)
+        ids[i] = (d == 0) ? MIN_TXNID + i : MIN_TXNID + i * 3 + prng() % 2;
+      if (d == 2)
+        for (size_t i = len / 2; i < len; ++i)
+          ids[i] = ids[i - 1] + 1 + (i % 64 == 0);
+      memcpy(shuffled, ids, len * sizeof(txnid_t));
+      for (size_t i = len; i > 1; --i) {
+        const size_t j = prng() % i;
+        const txnid_t t = shuffled[i - 1];
+        shuffled[i - 1] = shuffled[j];
+        shuffled[j] = t;
+      }
+
+      rkl_t rkl;
+      rkl_init(&rkl);
+      bench_case_t bc = {
+          .kernel = "rkl_push", .size = len, .items_per_op = len, .timed_per_op = true, .run = run_rkl_push};
+      snprintf(bc.variant, sizeof(bc.variant), "%s", "ascending");
+      snprintf(bc.distribution, sizeof(bc.distribution), "%s", distributions[d]);
+      bc.data = &rkl;
+      bc.aux = ids;
+      measure(&bc);
+      if (len <= 4096) {
+        /* an insertion in the middle moves the tail, so the random order is quadratic */
+        snprintf(bc.variant, sizeof(bc.variant), "%s", "shuffled");
+        bc.aux = shuffled;
+        measure(&bc);
+      }
+
+      rkl_clear(&rkl);
+      for (size_t i = 0; i < len; ++i)
+        if (rkl_push(&rkl, ids[i]) != MDBX_SUCCESS) {
+          fprintf(stderr, "rkl_push() failed\n");
+          exit(EXIT_FAILURE);
+        }
+      txnid_t *const queries = osal_malloc(1024 * sizeof(txnid_t));
+      for (size_t i = 0; i < 1024; ++i)
+        queries[i] = ids[prng() % len] + (i & 1) /* a half of misses for sparse ids */;
+      bench_case_t contain = {.kernel = "rkl_contain", .size = len, .items_per_op = 1, .run = run_rkl_contain};
+      snprintf(contain.variant, sizeof(contain.variant), "%s", "lookup");
+      snprintf(contain.distribution, sizeof(contain.distribution), "%s", distributions[d]);
+      contain.data = &rkl;
+      contain.aux = queries;
+      measure(&contain);
+
+      bench_case_t iterate = {.kernel = "rkl_turn", .size = len, .items_per_op = len, .run = run_rkl_iterate};
+      snprintf(iterate.variant, sizeof(iterate.variant), "%s", "forward");
+      snprintf(iterate.distribution, sizeof(iterate.distribution), "%s", distributions[d]);
+      iterate.data = &rkl;
+      measure(&iterate);
+
+      osal_free(queries);
+      rkl_destroy(&rkl);
+      osal_free(shuffled);
+      osal_free(ids);
+    }
+}
+
+/*-----------------------------------------------------------------------------*/
+/* scan4seq_* variants */
+
+typedef pgno_t *(scan4seq_func)(pgno_t *range, const size_t len, const size_t seq);
+
+static pgno_t *scan4seq_dispatch(pgno_t *range, const size_t len, const size_t seq) {
+  return scan4seq_impl(range, len, seq);
+}
+
+static uint64_t run_scan4seq(bench_case_t *bc, size_t iterations) {
+  scan4seq_func *const scan = (scan4seq_func *)bc->aux;
+  const pnl_t pnl = bc->data;
+  const size_t len = pnl_size(pnl);
+  size_t acc = 0;
+  const uint64_t begin = clock_ns();
+  for (size_t i = 0; i < iterations; ++i)
+    acc += (size_t)scan(MDBX_PNL_EDGE(pnl), len, bc->param);
+  const uint64_t end = clock_ns();
+  sink += acc;
+  return end - begin;
+}
+
+static void bench_scan4seq(void) {
+  static const struct {
+    const char *name;
+    scan4seq_func *func;
+    const char *cpu_feature;
+  } variants[] = {{"fallback", scan4seq_fallback, nullptr},
+#if !MDBX_PNL_ASCENDING
+#ifdef MDBX_ATTRIBUTE_TARGET_SSE2
+                  {"sse2", scan4seq_sse2, "sse2"},
+#endif
+#ifdef MDBX_ATTRIBUTE_TARGET_AVX2
+                  {"avx2", scan4seq_avx2, "avx2"},
+#endif
+#ifdef MDBX_ATTRIBUTE_TARGET_AVX512BW
+                  {"avx512bw", scan4seq_avx512bw, "avx512bw"},
+#endif
+#if (defined(__ARM_NEON) || defined(__ARM_NEON__)) && (__BYTE_ORDER__ == __ORDER_LITTLE_ENDIAN__)
+                  {"neon", scan4seq_neon, nullptr},
+#endif
+#endif /* !MDBX_PNL_ASCENDING */
+                  {"dispatch", scan4seq_dispatch, nullptr}};
+  static const size_t sizes[] = {64, 1024, 16384, 131072};
+  static const size_t seqs[] = {1, 3, 15};
+  /* "miss" means no sequence at all, i.e. a whole list is scanned,
+   * "middle" means the single suitable sequence in the middle of the list */
+  static const char *const distributions[] = {"miss", "middle"};
+
+  for (size_t v = 0; v < ARRAY_LENGTH(variants); ++v) {
+#if MDBX_HAVE_BUILTIN_CPU_SUPPORTS
+    if (variants[v].cpu_feature) {
+      __builtin_cpu_init();
+      if ((strcmp(variants[v].cpu_feature, "sse2") == 0 && !__builtin_cpu_supports("sse2")) ||
+          (strcmp(variants[v].cpu_feature, "avx2") == 0 && !__builtin_cpu_supports("avx2")) ||
+          (strcmp(variants[v].cpu_feature, "avx512bw") == 0 && !__builtin_cpu_supports("avx512bw")))
+        continue;
+    }
+#else
+    if (variants[v].cpu_feature && strcmp(variants[v].cpu_feature, "sse2") != 0)
+      /* no runtime detection of CPU features, so only the baseline is safe */
+      continue;
+#endif /* MDBX_HAVE_BUILTIN_CPU_SUPPORTS */
+    for (size_t s = 0; s < ARRAY_LENGTH(sizes); ++s)
+      for (size_t q = 0; q < ARRAY_LENGTH(seqs); ++q)
+        for (size_t d = 0; d < ARRAY_LENGTH(distributions); ++d) {
+          const size_t len = sizes[s], seq = seqs[q];
+          bench_case_t bc = {.kernel = "scan4seq", .size = len, .items_per_op = len, .run = run_scan4seq};
+          snprintf(bc.variant, sizeof(bc.variant), "%s", variants[v].name);
+          snprintf(bc.distribution, sizeof(bc.distribution), "%s,seq=%zu", distributions[d], seq + 1);
+          if (!case_prepare(&bc))
+            continue;
+          pnl_t pnl = pnl_alloc(len);
+          pnl_fill_unique(pnl, len);
+          pnl_sort_nochk(pnl);
+          if (d == 1) {
+            /* make a run of seq+1 adjacent pages in the middle, the list
+             * stays sorted since neighbours differ at least by 2 */
+            const size_t mid = len / 2 - seq / 2;
+            for (size_t i = 1; i <= seq; ++i)
+              pnl[mid + i] = MDBX_PNL_ASCENDING ? pnl[mid] + (pgno_t)i : pnl[mid] - (pgno_t)i;
+            for (size_t i = mid + seq + 1; i <= len; ++i)
+              if (!MDBX_PNL_ORDERED(pnl[i - 1] + (MDBX_PNL_ASCENDING ? 1 : -1), pnl[i])) {
+                pnl[i] = MDBX_PNL_ASCENDING ? pnl[i - 1] + 2 : pnl[i - 1] - 2;
+              }
+          }
+          bc.data = pnl;
+          bc.aux = (void *)variants[v].func;
+          bc.param = seq;
+          measure(&bc);
+          pnl_free(pnl);
+        }
+  }
+}
+
+/*-----------------------------------------------------------------------------*/
+/* page_copy() */
+
+static uint64_t run_page_copy(bench_case_t *bc, size_t iterations) {
+  page_t *const dst = bc->data;
+  const page_t *const src = bc->aux;
+  const uint64_t begin = clock_ns();
+  for (size_t i = 0; i < iterations; ++i)
+    page_copy(dst, src, bc->size);
+  const uint64_t end = clock_ns();
+  sink += dst->lower;
+  return end - begin;
+}
+
+static void bench_page_copy(void) {
+  static const size_t sizes[] = {4096, 16384, 65536};
+  static const struct {
+    const char *name;
+    unsigned used_percent;
+  } fills[] = {{"full", 100}, {"half", 50}, {"sparse", 10}};
+  for (size_t s = 0; s < ARRAY_LENGTH(sizes); ++s)
+    for (size_t f = 0; f < ARRAY_LENGTH(fills); ++f) {
+      const size_t size = sizes[s];
+      bench_case_t bc = {.kernel = "page_copy", .size = size, .items_per_op = size, .run = run_page_copy};
+      snprintf(bc.variant, sizeof(bc.variant), "%s", "leaf");
+      snprintf(bc.distribution, sizeof(bc.distribution), "%s", fills[f].name);
+      if (!case_prepare(&bc))
+        continue;
+      page_t *const src = osal_malloc(size), *const dst = osal_malloc(size);
+      memset(src, 0x5A, size);
+      memset(dst, 0, size);
+      src->flags = P_LEAF;
+      src->dupfix_ksize = 0;
+      const size_t room = size - PAGEHDRSZ, used = room * fills[f].used_percent / 100;
+      /* entries take about a tenth of the used space, the nodes take the rest */
+      src->lower = (indx_t)(used / 10 & ~(size_t)1);
+      src->upper = (indx_t)(room - (used - src->lower));
+      bc.data = dst;
+      bc.aux = src;
+      measure(&bc);
+      osal_free(src);
+      osal_free(dst);
+    }
+}
+
+/*-----------------------------------------------------------------------------*/
+/* node_search() within real pages of a temporary database */
+
+static uint64_t run_node_search(bench_case_t *bc, size_t iterations) {
+  MDBX_cursor *const mc = bc->data;
+  const MDBX_val *const queries = bc->aux;
+  size_t acc = 0;
+  const uint64_t begin = clock_ns();
+  for (size_t i = 0; i < iterations; ++i)
+    acc += node_search(mc, &queries[i & 1023]).exact;
+  const uint64_t end = clock_ns();
+  sink += acc;
+  return end - begin;
+}
+
+static void check_rc(int rc, const char *what) {
+  if (unlikely(rc != MDBX_SUCCESS)) {
+    fprintf(stderr, "%s() failed, error %d %s\n", what, rc, mdbx_strerror(rc));
+    exit(EXIT_FAILURE);
+  }
+}
+
+static void bench_node_search(void) {
+  static const struct {
+    const char *name;
+    MDBX_db_flags_t flags;
+    size_t key_len;
+  } tables[] = {{"int8", MDBX_INTEGERKEY, 8}, {"lex16", MDBX_DB_DEFAULTS, 16}, {"lex64", MDBX_DB_DEFAULTS, 64}};
+  static const intptr_t pagesizes[] = {4096, 65536};
+  const size_t records = 100000;
+
+  for (size_t p = 0; p < ARRAY_LENGTH(pagesizes); ++p) {
+    /* avoid making a database when no one case would be selected */
+    bool wanted = false;
+    for (size_t t = 0; t < ARRAY_LENGTH(tables); ++t) {
+      char variant[32];
+      snprintf(variant, sizeof(variant), "%s@%zuk", tables[t].name, (size_t)pagesizes[p] / 1024);
+      if (selected("node_search", variant, "leaf") || selected("node_search", variant, "branch")) {
+        wanted = true;
+        if (opt.list)
+          printf("node_search/%s/{leaf,branch}/*\n", variant);
+      }
+    }
+    if (!wanted || opt.list)
+      continue;
+    prng_state = (uint64_t)pagesizes[p];
+    MDBX_env *env;
+    check_rc(mdbx_env_create(&env), "mdbx_env_create");
+    check_rc(mdbx_env_set_maxdbs(env, ARRAY_LENGTH(tables)), "mdbx_env_set_maxdbs");
+    check_rc(mdbx_env_set_geometry(env, -1, -1, -1, -1, -1, pagesizes[p]), "mdbx_env_set_geometry");
+    mdbx_env_delete(opt.pathname, MDBX_ENV_JUST_DELETE);
+    check_rc(mdbx_env_open(env, opt.pathname, MDBX_NOSUBDIR | MDBX_SAFE_NOSYNC | MDBX_EXCLUSIVE, 0644),
+             "mdbx_env_open");
+
+    MDBX_txn *txn;
+    MDBX_dbi dbi[ARRAY_LENGTH(tables)];
+    uint8_t *const keys = osal_malloc(1024 * 64 * ARRAY_LENGTH(tables));
+    check_rc(mdbx_txn_begin(env, nullptr, MDBX_TXN_READWRITE, &txn), "mdbx_txn_begin");
+    for (size_t t = 0; t < ARRAY_LENGTH(tables); ++t) {
+      check_rc(mdbx_dbi_open(txn, tables[t].name, tables[t].flags | MDBX_CREATE, &dbi[t]), "mdbx_dbi_open");
+      for (size_t i = 0; i < records; ++i) {
+        uint8_t key_bytes[64];
+        const uint64_t number = prng();
+        for (size_t j = 0; j < tables[t].key_len; j += 8)
+          memcpy(key_bytes + j, &number, 8);
+        MDBX_val key = {key_bytes, tables[t].key_len}, data = {key_bytes, 8};
+        check_rc(mdbx_put(txn, dbi[t], &key, &data, MDBX_UPSERT), "mdbx_put");
+      }
+    }
+    check_rc(mdbx_txn_commit(txn), "mdbx_txn_commit");
+
+    check_rc(mdbx_txn_begin(env, nullptr, MDBX_TXN_RDONLY, &txn), "mdbx_txn_begin");
+    for (size_t t = 0; t < ARRAY_LENGTH(tables); ++t) {
+      MDBX_cursor *mc;
+      check_rc(mdbx_cursor_open(txn, dbi[t], &mc), "mdbx_cursor_open");
+      MDBX_val key, data;
+      /* position to a leaf in the middle of the tree */
+      check_rc(mdbx_cursor_get(mc, &key, &data, MDBX_FIRST), "mdbx_cursor_get");
+      for (size_t i = 0; i < records / 2; i += 64)
+        mdbx_cursor_get(mc, &key, &data, MDBX_NEXT);
+      check_rc(mdbx_cursor_get(mc, &key, &data, MDBX_GET_CURRENT), "mdbx_cursor_get");
+      const intptr_t leaf_top = mc->top;
+
+      for (intptr_t level = leaf_top; level >= 0; level = (level == leaf_top && leaf_top > 0) ? 0 : -1) {
+        mc->top = (int8_t)level;
+        const page_t *const mp = mc->pg[level];
+        const size_t nkeys = page_numkeys(mp);
+        bench_case_t bc = {.kernel = "node_search", .size = nkeys, .items_per_op = 1, .run = run_node_search};
+        snprintf(bc.variant, sizeof(bc.variant), "%s@%zuk", tables[t].name, (size_t)pagesizes[p] / 1024);
+        snprintf(bc.distribution, sizeof(bc.distribution), "%s", is_leaf(mp) ? "leaf" : "branch");
+        /* queries are keys present on the page, a half of them is altered to miss */
+        MDBX_val *const queries = osal_malloc(1024 * sizeof(MDBX_val));
+        uint8_t *const key_space = keys + t * 1024 * 64;
+        for (size_t i = 0; i < 1024; ++i) {
+          const size_t n = (size_t)(is_leaf(mp) ? 0 : 1) + prng() % (nkeys - (is_leaf(mp) ? 0 : 1));
+          const node_t *const node = page_node(mp, n);
+          const size_t len = node_ks(node);
+          memcpy(key_space + i * 64, node_key(node), len);
+          if (i & 1)
+            key_space[i * 64 + (tables[t].flags & MDBX_INTEGERKEY ? 0 : len - 1)] ^= 1;
+          queries[i].iov_base = key_space + i * 64;
+          queries[i].iov_len = len;
+        }
+        bc.data = mc;
+        bc.aux = queries;
+        measure(&bc);
+        osal_free(queries);
+      }
+      mc->top = (int8_t)leaf_top;
+      mdbx_cursor_close(mc);
+    }
+    mdbx_txn_abort(txn);
+    osal_free(keys);
+    check_rc(mdbx_env_close(env), "mdbx_env_close");
+    mdbx_env_delete(opt.pathname, MDBX_ENV_JUST_DELETE);
+  }
+}
+
+/*-----------------------------------------------------------------------------*/
+
+static void usage(const char *prog) {
+  fprintf(stderr,
+          "usage: %s [--json] [--quick] [--list] [--filter=SUBSTRING] [--repeat=N] [--time=MS] [--pathname=PATH]\n"
+          "  --json\t\tprint results as JSON for regression tracking\n"
+          "  --quick\t\tshort measurements, e.g. for a smoke test\n"
+          "  --list\t\tlist cases instead of running\n"
+          "  --filter=S\t\trun only cases which kernel/variant/distribution contain S\n"
+          "  --repeat=N\t\tnumber of samples for each case, the minimum and median are reported\n"
+          "  --time=MS\t\ttarget duration of all samples of a case in milliseconds\n"
+          "  --pathname=PATH\ttemporary database for node_search() cases\n",
+          prog);
+  exit(EXIT_FAILURE);
+}
+
+int main(int argc, const char *argv[]) {
+  for (int i = 1; i < argc; ++i) {
+    const char *const arg = argv[i];
+    if (strcmp(arg, "--json") == 0)
+      opt.json = true;
+    else if (strcmp(arg, "--list") == 0)
+      opt.list = true;
+    else if (strcmp(arg, "--quick") == 0) {
+      opt.repeat = 3;
+      opt.target_ns = 1e6;
+    } else if (strncmp(arg, "--filter=", 9) == 0 && arg[9])
+      opt.filter = arg + 9;
+    else if (strncmp(arg, "--pathname=", 11) == 0 && arg[11])
+      opt.pathname = arg + 11;
+    else if (strncmp(arg, "--repeat=", 9) == 0 && atoi(arg + 9) > 0 && atoi(arg + 9) <= 63)
+      opt.repeat = (unsigned)atoi(arg + 9);
+    else if (strncmp(arg, "--time=", 7) == 0 && atof(arg + 7) > 0)
+      opt.target_ns = atof(arg + 7) * 1e6;
+    else
+      usage(argv[0]);
+  }
+
+  /* the overhead of a pair of clock readings, which is included in the
+   * results of kernels measured per operation */
+  uint64_t best = UINT64_MAX;
+  for (int i = 0; i < 1000; ++i) {
+    const uint64_t begin = clock_ns();
+    const uint64_t spent = clock_ns() - begin;
+    best = (spent < best) ? spent : best;
+  }
+  timer_overhead_ns = (double)best;
+
+  if (opt.json)
+    printf("{\"benchmark\":\"mdbx_bench_kernels\",\"version\":\"%d.%d.%d.%d\",\"git\":\"%s\",\"compiler\":\"%s\","
+           "\"target\":\"%s\",\"timer_overhead_ns\":%.1f,\"repeat\":%u,\"results\":[",
+           mdbx_version.major, mdbx_version.minor, mdbx_version.patch, mdbx_version.tweak, mdbx_version.git.describe,
+           mdbx_build.compiler, mdbx_build.target, timer_overhead_ns, opt.repeat);
+  else if (!opt.list)
+    printf("%-20s %-16s %-14s %8s %12s %12s %10s\n", "kernel", "variant", "distribution", "size", "ns/op(min)",
+           "ns/op(med)", "ns/item");
+  fflush(stdout);
+
+  bench_cmp();
+  bench_pnl();
+  bench_dpl();
+  bench_rkl();
+  bench_scan4seq();
+  bench_page_copy();
+  bench_node_search();
+
+  if (opt.json)
+    printf("\n]}\n");
+  return EXIT_SUCCESS;
+}
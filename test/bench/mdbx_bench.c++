@@ -0,0 +1,991 @@
+/// \copyright SPDX-License-Identifier: Apache-2.0
+/// \author Леонид Юрьев aka Leonid Yuriev <leo@yuriev.ru> \date 2025
+///
+/// mdbx_bench - YCSB-style throughput and latency benchmark,
+/// which uses only the public C API of libmdbx.
+///
+
+#include "mdbx.h"
+
+#include "../distribution.h++"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cerrno>
+#include <cinttypes>
+#include <climits>
+#include <cmath>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(_WIN32) || defined(_WIN64)
+#include <intrin.h>
+#else
+#include <sys/types.h>
+#include <sys/wait.h>
+#include <unistd.h>
+#endif
+
+#if defined(_MSC_VER)
+#pragma warning(disable : 4996) /* The POSIX name is deprecated... */
+#endif
+
+/*----------------------------------------------------------------------------*/
+/* Log-linear latency histogram in the manner of HdrHistogram:
+ * values below 128 are counted exactly, larger values are grouped by powers
+ * of two each divided into 64 sub-buckets, i.e. the relative error of any
+ * reported value is less than 1/64 (two significant decimal digits). */
+
+struct histogram {
+  enum { sub_bits = 6, sub_count = 1 << sub_bits, buckets = (64 - sub_bits + 1) * sub_count };
+  uint64_t counts[buckets];
+  uint64_t total, sum, min, max;
+
+  void clear() {
+    memset(this, 0, sizeof(*this));
+    min = UINT64_MAX;
+  }
+
+  static unsigned log2floor(uint64_t value) {
+#if defined(__GNUC__) || defined(__clang__)
+    return 63 - __builtin_clzll(value);
+#elif defined(_MSC_VER) && (defined(_M_X64) || defined(_M_ARM64))
+    unsigned long index;
+    _BitScanReverse64(&index, value);
+    return index;
+#else
+    unsigned index = 0;
+    while (value >>= 1)
+      ++index;
+    return index;
+#endif
+  }
+
+  static size_t index_of(uint64_t value) {
+    if (value < 2 * sub_count)
+      return size_t(value);
+    const unsigned shift = log2floor(value) - sub_bits;
+    return size_t(shift) * sub_count + size_t(value >> shift);
+  }
+
+  static uint64_t highest_equivalent(size_t index) {
+    if (index < 2 * sub_count)
+      return index;
+    const unsigned shift = unsigned(index / sub_count - 1);
+    const uint64_t mantissa = index % sub_count + sub_count;
+    return ((mantissa + 1) << shift) - 1;
+  }
+
+  void record(uint64_t value) {
+    counts[index_of(value)] += 1;
+    total += 1;
+    sum += value;
+    min = std::min(min, value);
+    max = std::max(max, value);
+  }
+
+  void merge(const histogram &other) {
+    for (size_t i = 0; i < buckets; ++i)
+      counts[i] += other.counts[i];
+    total += other.total;
+    sum += other.sum;
+    min = std::min(min, other.min);
+    max = std::max(max, other.max);
+  }
+
+  uint64_t percentile(double percent) const {
+    if (!total)
+      return 0;
+    const uint64_t rank = std::max(uint64_t(1), uint64_t(std::ceil(total * percent / 100)));
+    uint64_t accumulated = 0;
+    for (size_t i = 0; i < buckets; ++i) {
+      accumulated += counts[i];
+      if (accumulated >= rank)
+        return std::min(highest_equivalent(i), max);
+    }
+    return max;
+  }
+
+  double mean() const { return total ? double(sum) / total : 0; }
+};
+
+/*----------------------------------------------------------------------------*/
+
+static uint64_t splitmix64(uint64_t &state) {
+  uint64_t z = (state += UINT64_C(0x9E3779B97F4A7C15));
+  z = (z ^ (z >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+  z = (z ^ (z >> 27)) * UINT64_C(0x94D049BB133111EB);
+  return z ^ (z >> 31);
+}
+
+/* A bijective mix of 64-bit numbers, which scatters keys of consecutive
+ * records over the whole key space like the hashed keys of YCSB do. */
+static uint64_t scatter(uint64_t x) {
+  x = (x ^ (x >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+  x = (x ^ (x >> 27)) * UINT64_C(0x94D049BB133111EB);
+  return x ^ (x >> 31);
+}
+
+struct prng {
+  uint64_t state;
+  explicit prng(uint64_t seed) : state(seed) {}
+  uint64_t next() { return splitmix64(state); }
+  /* uniform in [0, 1) */
+  double real() { return (next() >> 11) * (1.0 / 9007199254740992.0); }
+  uint64_t below(uint64_t bound) { return bound ? next() % bound : 0; }
+};
+
+/*----------------------------------------------------------------------------*/
+
+enum op_kind { op_read, op_update, op_insert, op_scan, op_rmw, op_commit, op_kinds };
+static const char *const op_names[op_kinds] = {"read", "update", "insert", "scan", "rmw", "commit"};
+
+/* The key distributions are shared with the mdbx_test's keygen. */
+using distribution = keygen::distribution;
+
+struct workload {
+  const char *name, *alias;
+  unsigned mix[op_commit];
+  distribution::kind dist;
+};
+
+static const workload workloads[] = {
+    /*                    read update insert scan rmw */
+    {"a", "update-heavy", {50, 50, 0, 0, 0}, distribution::zipfian},
+    {"b", "read-mostly", {95, 5, 0, 0, 0}, distribution::zipfian},
+    {"c", "read-only", {100, 0, 0, 0, 0}, distribution::zipfian},
+    {"d", "insert-latest", {95, 0, 5, 0, 0}, distribution::latest},
+    {"e", "scan", {0, 0, 5, 95, 0}, distribution::zipfian},
+    {"f", "read-modify-write", {50, 0, 0, 0, 50}, distribution::zipfian},
+    {"load", "insert-only", {0, 0, 100, 0, 0}, distribution::uniform}};
+
+struct config {
+  std::string pathname = "mdbx_bench.db";
+  const workload *wl = &workloads[0];
+  unsigned mix[op_commit];
+  distribution::kind dist = distribution::zipfian;
+  bool dist_given = false;
+  double zipf_theta = 0.99;
+  double hot_ops = 0.9, hot_keys = 0.1;
+  uint64_t jitter = 16, prefixes = 16;
+  uint64_t records = 100000;
+  uint64_t operations = 1000000;
+  double duration = 0;
+  unsigned threads = 1, processes = 1;
+  unsigned value_min = 100, value_max = 100;
+  unsigned scan_length = 100;
+  unsigned batch = 1, load_batch = 10000;
+  bool ordered_keys = false, reuse = false, json = false;
+  MDBX_env_flags_t env_flags = MDBX_NOSUBDIR;
+  const char *sync_name = "durable";
+  intptr_t pagesize = -1, size_upper = -1;
+  uint64_t seed = 1;
+  std::vector<std::pair<MDBX_option_t, uint64_t>> options;
+  std::vector<std::string> option_names;
+} cfg;
+
+static const struct {
+  const char *name;
+  MDBX_option_t option;
+} option_names[] = {{"max_readers", MDBX_opt_max_readers},
+                    {"sync_bytes", MDBX_opt_sync_bytes},
+                    {"sync_period", MDBX_opt_sync_period},
+                    {"rp_augment_limit", MDBX_opt_rp_augment_limit},
+                    {"loose_limit", MDBX_opt_loose_limit},
+                    {"dp_reserve_limit", MDBX_opt_dp_reserve_limit},
+                    {"txn_dp_limit", MDBX_opt_txn_dp_limit},
+                    {"txn_dp_initial", MDBX_opt_txn_dp_initial},
+                    {"spill_max_denominator", MDBX_opt_spill_max_denominator},
+                    {"spill_min_denominator", MDBX_opt_spill_min_denominator},
+                    {"spill_parent4child_denominator", MDBX_opt_spill_parent4child_denominator},
+                    {"merge_threshold_16dot16_percent", MDBX_opt_merge_threshold_16dot16_percent},
+                    {"writethrough_threshold", MDBX_opt_writethrough_threshold},
+                    {"prefault_write_enable", MDBX_opt_prefault_write_enable},
+                    {"gc_time_limit", MDBX_opt_gc_time_limit},
+                    {"prefer_waf_insteadof_balance", MDBX_opt_prefer_waf_insteadof_balance},
+                    {"subpage_limit", MDBX_opt_subpage_limit},
+                    {"subpage_room_threshold", MDBX_opt_subpage_room_threshold},
+                    {"subpage_reserve_prereq", MDBX_opt_subpage_reserve_prereq},
+                    {"subpage_reserve_limit", MDBX_opt_subpage_reserve_limit}};
+
+static void usage(const char *prog) {
+  fprintf(stderr,
+          "usage: %s [options]\n"
+          "  --workload=NAME\t\ta|update-heavy (50%% read, 50%% update),\n"
+          "  \t\t\t\tb|read-mostly (95%% read, 5%% update),\n"
+          "  \t\t\t\tc|read-only, d|insert-latest (95%% read, 5%% insert),\n"
+          "  \t\t\t\te|scan (95%% scan, 5%% insert),\n"
+          "  \t\t\t\tf|read-modify-write (50%% read, 50%% rmw),\n"
+          "  \t\t\t\tload|insert-only\n"
+          "  --mix=R,U,I,S,M\t\tcustom percentages of read, update, insert, scan, rmw\n"
+          "  --distribution=NAME\t\tuniform, zipfian, hotspot, sequential, latest or prefix\n"
+          "  --zipf-theta=N\t\tskew of zipfian, latest and prefix distributions, default 0.99\n"
+          "  --hot-ops=N\t\t\tfraction of operations on the hot set for hotspot, default 0.9\n"
+          "  --hot-keys=N\t\t\tfraction of records in the hot set for hotspot, default 0.1\n"
+          "  --jitter=N\t\t\tmax deviation from the cursor for sequential, default 16\n"
+          "  --prefixes=N\t\t\tnumber of key prefixes for prefix, default 16\n"
+          "  --records=N\t\t\tnumber of records to load, default 100000\n"
+          "  --operations=N\t\ttotal number of operations, default 1000000\n"
+          "  --duration=SECONDS\t\tlimit run by time instead of operations\n"
+          "  --threads=N\t\t\tnumber of threads in each process\n"
+          "  --processes=N\t\t\tnumber of processes (not supported on Windows)\n"
+          "  --value-size=N[..M]\t\tsize of values, fixed or uniform in range\n"
+          "  --scan-length=N\t\tmaximal number of records per scan, default 100\n"
+          "  --batch=N\t\t\tgroup up to N consecutive writes into one transaction\n"
+          "  --load-batch=N\t\tnumber of records per transaction during load\n"
+          "  --ordered-keys\t\tuse sequential keys instead of scattered ones\n"
+          "  --sync=MODE\t\t\tdurable, nometasync, safe-nosync or utterly-nosync\n"
+          "  --writemap, --lifo, --nordahead, --nomeminit\n"
+          "  \t\t\t\tthe corresponding environment flags\n"
+          "  --pagesize=N\t\t\tdatabase page size for a new database\n"
+          "  --size-upper=N\t\tupper limit of the database size in bytes\n"
+          "  --option=NAME=VALUE\t\tset an option by mdbx_env_set_option(),\n"
+          "  \t\t\t\te.g. --option=rp_augment_limit=65536\n"
+          "  --pathname=PATH\t\tdatabase file, default mdbx_bench.db\n"
+          "  --reuse\t\t\tuse an existing database without (re)loading\n"
+          "  --seed=N\t\t\tseed of pseudo-random generators\n"
+          "  --json\t\t\tprint results as a single JSON object\n",
+          prog);
+  exit(EXIT_FAILURE);
+}
+
+static bool parse_u64(const char *str, uint64_t &value) {
+  char *end = nullptr;
+  value = strtoull(str, &end, 0);
+  if (end && end != str) {
+    switch (*end) {
+    case 'K':
+    case 'k':
+      value <<= 10;
+      ++end;
+      break;
+    case 'M':
+    case 'm':
+      value <<= 20;
+      ++end;
+      break;
+    case 'G':
+    case 'g':
+      value <<= 30;
+      ++end;
+      break;
+    }
+  }
+  return end && end != str && *end == '\0';
+}
+
+static unsigned parse_unsigned(const char *prog, const char *str, unsigned lower, unsigned upper) {
+  uint64_t value;
+  if (!parse_u64(str, value) || value < lower || value > upper) {
+    fprintf(stderr, "%s: invalid value '%s', expected %u..%u\n", prog, str, lower, upper);
+    exit(EXIT_FAILURE);
+  }
+  return unsigned(value);
+}
+
+static void parse_args(int argc, char *argv[]) {
+  const char *const prog = argv[0];
+  memcpy(cfg.mix, cfg.wl->mix, sizeof(cfg.mix));
+  bool mix_given = false;
+  for (int i = 1; i < argc; ++i) {
+    std::string arg = argv[i];
+    if (arg.compare(0, 2, "--") != 0)
+      usage(prog);
+    std::string value;
+    const size_t eq = arg.find('=');
+    if (eq != std::string::npos) {
+      value = arg.substr(eq + 1);
+      arg.resize(eq);
+    }
+    const char *const v = value.c_str();
+    const bool has_value = eq != std::string::npos;
+    uint64_t number;
+
+    if (arg == "--workload" && has_value) {
+      cfg.wl = nullptr;
+      for (const auto &w : workloads)
+        if (value == w.name || value == w.alias)
+          cfg.wl = &w;
+      if (!cfg.wl)
+        usage(prog);
+      if (!mix_given)
+        memcpy(cfg.mix, cfg.wl->mix, sizeof(cfg.mix));
+    } else if (arg == "--mix" && has_value) {
+      unsigned parsed[op_commit], sum = 0;
+      if (sscanf(v, "%u,%u,%u,%u,%u", &parsed[0], &parsed[1], &parsed[2], &parsed[3], &parsed[4]) != 5)
+        usage(prog);
+      for (unsigned k = 0; k < op_commit; ++k)
+        sum += parsed[k];
+      if (sum != 100) {
+        fprintf(stderr, "%s: the mix percentages should sum up to 100\n", prog);
+        exit(EXIT_FAILURE);
+      }
+      memcpy(cfg.mix, parsed, sizeof(cfg.mix));
+      mix_given = true;
+    } else if (arg == "--distribution" && has_value) {
+      if (!distribution::parse(v, cfg.dist))
+        usage(prog);
+      cfg.dist_given = true;
+    } else if (arg == "--zipf-theta" && has_value) {
+      cfg.zipf_theta = atof(v);
+      if (!(cfg.zipf_theta > 0 && cfg.zipf_theta < 1))
+        usage(prog);
+    } else if (arg == "--hot-ops" && has_value) {
+      cfg.hot_ops = atof(v);
+      if (!(cfg.hot_ops >= 0 && cfg.hot_ops <= 1))
+        usage(prog);
+    } else if (arg == "--hot-keys" && has_value) {
+      cfg.hot_keys = atof(v);
+      if (!(cfg.hot_keys > 0 && cfg.hot_keys <= 1))
+        usage(prog);
+    } else if (arg == "--jitter" && has_value && parse_u64(v, number))
+      cfg.jitter = number;
+    else if (arg == "--prefixes" && has_value && parse_u64(v, number) && number > 0)
+      cfg.prefixes = number;
+    else if (arg == "--records" && has_value && parse_u64(v, number) && number > 0)
+      cfg.records = number;
+    else if (arg == "--operations" && has_value && parse_u64(v, number))
+      cfg.operations = number;
+    else if (arg == "--duration" && has_value) {
+      cfg.duration = atof(v);
+      if (!(cfg.duration > 0))
+        usage(prog);
+    } else if (arg == "--threads" && has_value)
+      cfg.threads = parse_unsigned(prog, v, 1, 1024);
+    else if (arg == "--processes" && has_value)
+      cfg.processes = parse_unsigned(prog, v, 1, 1024);
+    else if (arg == "--value-size" && has_value) {
+      const size_t dots = value.find("..");
+      cfg.value_min = parse_unsigned(prog, value.substr(0, dots).c_str(), 1, 1 << 24);
+      cfg.value_max = (dots == std::string::npos) ? cfg.value_min
+                                                  : parse_unsigned(prog, value.substr(dots + 2).c_str(), 1, 1 << 24);
+      if (cfg.value_min > cfg.value_max)
+        usage(prog);
+    } else if (arg == "--scan-length" && has_value)
+      cfg.scan_length = parse_unsigned(prog, v, 1, 1 << 24);
+    else if (arg == "--batch" && has_value)
+      cfg.batch = parse_unsigned(prog, v, 1, 1 << 24);
+    else if (arg == "--load-batch" && has_value)
+      cfg.load_batch = parse_unsigned(prog, v, 1, 1 << 24);
+    else if (arg == "--ordered-keys" && !has_value)
+      cfg.ordered_keys = true;
+    else if (arg == "--sync" && has_value) {
+      cfg.env_flags &= ~(MDBX_NOMETASYNC | MDBX_SAFE_NOSYNC | MDBX_UTTERLY_NOSYNC);
+      if (value == "durable")
+        cfg.sync_name = "durable";
+      else if (value == "nometasync")
+        cfg.env_flags |= MDBX_NOMETASYNC, cfg.sync_name = "nometasync";
+      else if (value == "safe-nosync")
+        cfg.env_flags |= MDBX_SAFE_NOSYNC, cfg.sync_name = "safe-nosync";
+      else if (value == "utterly-nosync")
+        cfg.env_flags |= MDBX_UTTERLY_NOSYNC, cfg.sync_name = "utterly-nosync";
+      else
+        usage(prog);
+    } else if (arg == "--writemap" && !has_value)
+      cfg.env_flags |= MDBX_WRITEMAP;
+    else if (arg == "--lifo" && !has_value)
+      cfg.env_flags |= MDBX_LIFORECLAIM;
+    else if (arg == "--nordahead" && !has_value)
+      cfg.env_flags |= MDBX_NORDAHEAD;
+    else if (arg == "--nomeminit" && !has_value)
+      cfg.env_flags |= MDBX_NOMEMINIT;
+    else if (arg == "--pagesize" && has_value)
+      cfg.pagesize = intptr_t(parse_unsigned(prog, v, 256, 65536));
+    else if (arg == "--size-upper" && has_value && parse_u64(v, number) && number <= uint64_t(INTPTR_MAX))
+      cfg.size_upper = intptr_t(number);
+    else if (arg == "--option" && has_value) {
+      const size_t eq2 = value.find('=');
+      bool found = false;
+      if (eq2 != std::string::npos && parse_u64(v + eq2 + 1, number))
+        for (const auto &o : option_names)
+          if (value.compare(0, eq2, o.name) == 0 && strlen(o.name) == eq2) {
+            cfg.options.emplace_back(o.option, number);
+            cfg.option_names.push_back(value);
+            found = true;
+          }
+      if (!found) {
+        fprintf(stderr, "%s: unknown or invalid option '%s'\n", prog, v);
+        exit(EXIT_FAILURE);
+      }
+    } else if (arg == "--pathname" && has_value && !value.empty())
+      cfg.pathname = value;
+    else if (arg == "--reuse" && !has_value)
+      cfg.reuse = true;
+    else if (arg == "--seed" && has_value && parse_u64(v, number))
+      cfg.seed = number;
+    else if (arg == "--json" && !has_value)
+      cfg.json = true;
+    else
+      usage(prog);
+  }
+
+  if (!cfg.dist_given)
+    cfg.dist = cfg.wl->dist;
+#if defined(_WIN32) || defined(_WIN64)
+  if (cfg.processes > 1) {
+    fprintf(stderr, "%s: multiple processes are not supported on Windows\n", prog);
+    exit(EXIT_FAILURE);
+  }
+#endif
+  if (!cfg.operations && !cfg.duration)
+    usage(prog);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static const char *prog;
+
+static void failure(const char *what, int err) {
+  fprintf(stderr, "%s: %s() failed, error %d %s\n", prog, what, err, mdbx_strerror(err));
+  fflush(stderr);
+  exit(EXIT_FAILURE);
+}
+
+static MDBX_env *env_open(bool create) {
+  MDBX_env *env;
+  int err = mdbx_env_create(&env);
+  if (err != MDBX_SUCCESS)
+    failure("mdbx_env_create", err);
+
+  err = mdbx_env_set_option(env, MDBX_opt_max_readers, std::max(cfg.threads * cfg.processes + 2u, 126u));
+  if (err != MDBX_SUCCESS)
+    failure("mdbx_env_set_option(max_readers)", err);
+  for (const auto &o : cfg.options)
+    if (o.first == MDBX_opt_max_readers && (err = mdbx_env_set_option(env, o.first, o.second)) != MDBX_SUCCESS)
+      failure("mdbx_env_set_option", err);
+
+  if (create) {
+    err = mdbx_env_set_geometry(env, -1, -1, cfg.size_upper, -1, -1, cfg.pagesize);
+    if (err != MDBX_SUCCESS)
+      failure("mdbx_env_set_geometry", err);
+  }
+
+  err = mdbx_env_open(env, cfg.pathname.c_str(), create ? cfg.env_flags : cfg.env_flags | MDBX_ACCEDE, 0644);
+  if (err != MDBX_SUCCESS)
+    failure("mdbx_env_open", err);
+
+  for (const auto &o : cfg.options)
+    if (o.first != MDBX_opt_max_readers && (err = mdbx_env_set_option(env, o.first, o.second)) != MDBX_SUCCESS)
+      failure("mdbx_env_set_option", err);
+  return env;
+}
+
+struct key_buf {
+  uint8_t bytes[8];
+  MDBX_val val() { return MDBX_val{bytes, sizeof(bytes)}; }
+};
+
+/* Keys are stored big-endian so that the default lexicographic order of keys
+ * matches the numeric one, which enables MDBX_APPEND for ordered keys. */
+static key_buf make_key(uint64_t index) {
+  const uint64_t number = cfg.ordered_keys ? index : scatter(index);
+  key_buf key;
+  for (unsigned i = 0; i < 8; ++i)
+    key.bytes[i] = uint8_t(number >> (56 - i * 8));
+  return key;
+}
+
+/* Pool of random bytes from which values are taken at random offsets. */
+static std::vector<uint8_t> value_pool;
+
+static MDBX_val make_value(prng &rnd) {
+  const size_t length = cfg.value_min + size_t(rnd.below(cfg.value_max - cfg.value_min + 1));
+  const size_t offset = size_t(rnd.below(value_pool.size() - length + 1));
+  return MDBX_val{&value_pool[offset], length};
+}
+
+static double load(MDBX_env *env) {
+  const auto started = std::chrono::steady_clock::now();
+  prng rnd(cfg.seed);
+  MDBX_txn *txn = nullptr;
+  MDBX_dbi dbi = 0;
+  for (uint64_t i = 0; i < cfg.records; ++i) {
+    if (!txn) {
+      int err = mdbx_txn_begin(env, nullptr, MDBX_TXN_READWRITE, &txn);
+      if (err != MDBX_SUCCESS)
+        failure("mdbx_txn_begin", err);
+      if (!dbi && (err = mdbx_dbi_open(txn, nullptr, MDBX_DB_DEFAULTS, &dbi)) != MDBX_SUCCESS)
+        failure("mdbx_dbi_open", err);
+    }
+    key_buf key = make_key(i);
+    MDBX_val k = key.val(), v = make_value(rnd);
+    int err = mdbx_put(txn, dbi, &k, &v, cfg.ordered_keys ? MDBX_APPEND : MDBX_UPSERT);
+    if (err != MDBX_SUCCESS)
+      failure("mdbx_put", err);
+    if ((i + 1) % cfg.load_batch == 0 || i + 1 == cfg.records) {
+      err = mdbx_txn_commit(txn);
+      if (err != MDBX_SUCCESS)
+        failure("mdbx_txn_commit", err);
+      txn = nullptr;
+    }
+  }
+  return std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+}
+
+/*----------------------------------------------------------------------------*/
+
+struct results {
+  histogram latency[op_kinds];
+  uint64_t notfound[op_kinds];
+  uint64_t scanned;
+  double seconds;
+
+  void clear() {
+    for (auto &h : latency)
+      h.clear();
+    memset(notfound, 0, sizeof(notfound));
+    scanned = 0;
+    seconds = 0;
+  }
+
+  void merge(const results &other) {
+    for (size_t i = 0; i < op_kinds; ++i) {
+      latency[i].merge(other.latency[i]);
+      notfound[i] += other.notfound[i];
+    }
+    scanned += other.scanned;
+    seconds = std::max(seconds, other.seconds);
+  }
+
+  uint64_t operations() const {
+    uint64_t total = 0;
+    for (size_t i = 0; i < op_commit; ++i)
+      total += latency[i].total;
+    return total;
+  }
+};
+
+struct process_state {
+  MDBX_env *env;
+  MDBX_dbi dbi;
+  unsigned process_index;
+  distribution access;
+  /* number of records inserted by this process during the run */
+  std::atomic<uint64_t> inserted{0};
+  std::atomic<bool> stop{false};
+  std::chrono::steady_clock::time_point deadline;
+};
+
+class worker {
+  process_state &ps;
+  prng rnd;
+  results &res;
+  uint64_t quota;
+  MDBX_txn *rtxn = nullptr, *wtxn = nullptr;
+  unsigned pending = 0;
+  volatile uint8_t sink = 0;
+
+  /* The own copy of the distribution, since the sequential one has a cursor. */
+  distribution access;
+
+  uint64_t existing() const { return cfg.records + ps.inserted.load(std::memory_order_relaxed) * cfg.processes; }
+
+  uint64_t choose() { return access.next(rnd.state, existing()); }
+
+  void check(int err, const char *what) {
+    if (err != MDBX_SUCCESS)
+      failure(what, err);
+  }
+
+  MDBX_txn *read_begin() {
+    if (wtxn)
+      return wtxn;
+    if (!rtxn)
+      check(mdbx_txn_begin(ps.env, nullptr, MDBX_TXN_RDONLY, &rtxn), "mdbx_txn_begin");
+    else
+      check(mdbx_txn_renew(rtxn), "mdbx_txn_renew");
+    return rtxn;
+  }
+
+  void read_end(MDBX_txn *txn) {
+    if (txn == rtxn)
+      check(mdbx_txn_reset(rtxn), "mdbx_txn_reset");
+  }
+
+  MDBX_txn *write_begin() {
+    if (!wtxn)
+      check(mdbx_txn_begin(ps.env, nullptr, MDBX_TXN_READWRITE, &wtxn), "mdbx_txn_begin");
+    return wtxn;
+  }
+
+  void commit() {
+    const auto started = std::chrono::steady_clock::now();
+    check(mdbx_txn_commit(wtxn), "mdbx_txn_commit");
+    res.latency[op_commit].record(uint64_t(
+        std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - started).count()));
+    wtxn = nullptr;
+    pending = 0;
+  }
+
+  /* the batch is committed by run() outside of the timing of an operation,
+   * so the commit latency is recorded only in the own histogram */
+  void write_end() { ++pending; }
+
+  op_kind choose_op() {
+    unsigned dice = unsigned(rnd.below(100));
+    for (unsigned i = 0; i < op_commit; ++i) {
+      if (dice < cfg.mix[i])
+        return op_kind(i);
+      dice -= cfg.mix[i];
+    }
+    return op_read;
+  }
+
+  void perform(op_kind op) {
+    MDBX_val data;
+    int err;
+    switch (op) {
+    default:
+    case op_read: {
+      key_buf key = make_key(choose());
+      MDBX_val k = key.val();
+      MDBX_txn *txn = read_begin();
+      err = mdbx_get(txn, ps.dbi, &k, &data);
+      if (err == MDBX_SUCCESS)
+        sink = uint8_t(sink + *static_cast<const uint8_t *>(data.iov_base));
+      else if (err == MDBX_NOTFOUND)
+        res.notfound[op] += 1;
+      else
+        failure("mdbx_get", err);
+      read_end(txn);
+    } break;
+    case op_update: {
+      key_buf key = make_key(choose());
+      MDBX_val k = key.val(), v = make_value(rnd);
+      check(mdbx_put(write_begin(), ps.dbi, &k, &v, MDBX_UPSERT), "mdbx_put");
+      write_end();
+    } break;
+    case op_insert: {
+      const uint64_t seq = ps.inserted.fetch_add(1, std::memory_order_relaxed);
+      key_buf key = make_key(cfg.records + seq * cfg.processes + ps.process_index);
+      MDBX_val k = key.val(), v = make_value(rnd);
+      check(mdbx_put(write_begin(), ps.dbi, &k, &v, MDBX_UPSERT), "mdbx_put");
+      write_end();
+    } break;
+    case op_scan: {
+      key_buf key = make_key(choose());
+      MDBX_val k = key.val();
+      MDBX_txn *txn = read_begin();
+      MDBX_cursor *cursor;
+      check(mdbx_cursor_open(txn, ps.dbi, &cursor), "mdbx_cursor_open");
+      const uint64_t length = 1 + rnd.below(cfg.scan_length);
+      MDBX_cursor_op cursor_op = MDBX_SET_RANGE;
+      for (uint64_t n = 0; n < length; ++n, cursor_op = MDBX_NEXT) {
+        err = mdbx_cursor_get(cursor, &k, &data, cursor_op);
+        if (err == MDBX_NOTFOUND) {
+          res.notfound[op] += !n;
+          break;
+        }
+        check(err, "mdbx_cursor_get");
+        sink = uint8_t(sink + *static_cast<const uint8_t *>(data.iov_base));
+        res.scanned += 1;
+      }
+      mdbx_cursor_close(cursor);
+      read_end(txn);
+    } break;
+    case op_rmw: {
+      key_buf key = make_key(choose());
+      MDBX_val k = key.val();
+      MDBX_txn *txn = write_begin();
+      err = mdbx_get(txn, ps.dbi, &k, &data);
+      if (err == MDBX_NOTFOUND)
+        res.notfound[op] += 1;
+      else
+        check(err, "mdbx_get");
+      MDBX_val v = make_value(rnd);
+      check(mdbx_put(txn, ps.dbi, &k, &v, MDBX_UPSERT), "mdbx_put");
+      write_end();
+    } break;
+    }
+  }
+
+public:
+  worker(process_state &ps, uint64_t seed, results &res, uint64_t quota)
+      : ps(ps), rnd(seed), res(res), quota(quota), access(ps.access) {}
+
+  void run() {
+    const auto started = std::chrono::steady_clock::now();
+    for (uint64_t n = 0; !quota || n < quota; ++n) {
+      if (cfg.duration && (n & 63) == 0 &&
+          (ps.stop.load(std::memory_order_relaxed) || std::chrono::steady_clock::now() >= ps.deadline))
+        break;
+      const op_kind op = choose_op();
+      /* a batch of writes is not kept open across reads and scans, so that
+       * they are served by read-only transactions as usual */
+      if (wtxn && (op == op_read || op == op_scan))
+        commit();
+      const auto begin = std::chrono::steady_clock::now();
+      perform(op);
+      res.latency[op].record(uint64_t(
+          std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - begin).count()));
+      if (wtxn && pending >= cfg.batch)
+        commit();
+    }
+    if (wtxn)
+      commit();
+    if (rtxn)
+      mdbx_txn_abort(rtxn);
+    res.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+  }
+};
+
+static void run_process(MDBX_env *env, unsigned process_index, const distribution &access, results &total) {
+  process_state ps;
+  ps.env = env;
+  ps.process_index = process_index;
+  ps.access = access;
+  ps.deadline = std::chrono::steady_clock::now() + std::chrono::duration_cast<std::chrono::steady_clock::duration>(
+                                                       std::chrono::duration<double>(cfg.duration));
+  MDBX_txn *txn;
+  int err = mdbx_txn_begin(env, nullptr, MDBX_TXN_RDONLY, &txn);
+  if (err != MDBX_SUCCESS)
+    failure("mdbx_txn_begin", err);
+  err = mdbx_dbi_open(txn, nullptr, MDBX_DB_ACCEDE, &ps.dbi);
+  if (err != MDBX_SUCCESS)
+    failure("mdbx_dbi_open", err);
+  mdbx_txn_abort(txn);
+
+  const unsigned workers = cfg.threads * cfg.processes;
+  std::vector<results> per_thread(cfg.threads);
+  std::vector<std::thread> threads;
+  for (unsigned t = 0; t < cfg.threads; ++t) {
+    per_thread[t].clear();
+    const unsigned id = process_index * cfg.threads + t;
+    /* spread the remainder of operations over the first workers */
+    const uint64_t quota = cfg.operations ? cfg.operations / workers + (id < cfg.operations % workers) : 0;
+    threads.emplace_back([&ps, &per_thread, t, id, quota]() {
+      worker w(ps, cfg.seed * UINT64_C(0x2545F4914F6CDD1D) + id + 1, per_thread[t], quota);
+      w.run();
+    });
+  }
+  for (auto &thread : threads)
+    thread.join();
+  for (const auto &r : per_thread)
+    total.merge(r);
+}
+
+/*----------------------------------------------------------------------------*/
+
+static void print_results(const results &res, double load_seconds, const MDBX_envinfo &before,
+                          const MDBX_envinfo &after) {
+  const uint64_t operations = res.operations();
+  const double seconds = res.seconds;
+#define DELTA(field) (after.field - before.field)
+
+  if (cfg.json) {
+    printf("{\"workload\":\"%s\",\"mix\":{\"read\":%u,\"update\":%u,\"insert\":%u,\"scan\":%u,\"rmw\":%u},"
+           "\"distribution\":\"%s\",\"zipf_theta\":%g,\"records\":%" PRIu64 ",\"threads\":%u,\"processes\":%u,"
+           "\"value_size\":[%u,%u],\"batch\":%u,\"sync\":\"%s\",\"writemap\":%s,\"pagesize\":%u,\"options\":[",
+           cfg.wl->alias, cfg.mix[op_read], cfg.mix[op_update], cfg.mix[op_insert], cfg.mix[op_scan], cfg.mix[op_rmw],
+           distribution::name(cfg.dist), cfg.zipf_theta, cfg.records, cfg.threads, cfg.processes, cfg.value_min,
+           cfg.value_max, cfg.batch, cfg.sync_name, (cfg.env_flags & MDBX_WRITEMAP) ? "true" : "false",
+           after.mi_dxb_pagesize);
+    for (size_t i = 0; i < cfg.option_names.size(); ++i)
+      printf("%s\"%s\"", i ? "," : "", cfg.option_names[i].c_str());
+    printf("],\"load\":{\"seconds\":%.3f,\"ops_per_sec\":%.1f},", load_seconds,
+           load_seconds > 0 ? cfg.records / load_seconds : 0.0);
+    printf("\"run\":{\"seconds\":%.3f,\"operations\":%" PRIu64 ",\"ops_per_sec\":%.1f,\"scanned\":%" PRIu64
+           ",\"latency_us\":{",
+           seconds, operations, seconds > 0 ? operations / seconds : 0.0, res.scanned);
+    bool first = true;
+    for (size_t i = 0; i < op_kinds; ++i) {
+      const histogram &h = res.latency[i];
+      if (!h.total)
+        continue;
+      printf("%s\"%s\":{\"count\":%" PRIu64 ",\"notfound\":%" PRIu64 ",\"mean\":%.3f,\"min\":%.3f,\"p50\":%.3f,"
+             "\"p90\":%.3f,\"p99\":%.3f,\"p99.9\":%.3f,\"p99.99\":%.3f,\"max\":%.3f}",
+             first ? "" : ",", op_names[i], h.total, res.notfound[i], h.mean() / 1e3, h.min / 1e3,
+             h.percentile(50) / 1e3, h.percentile(90) / 1e3, h.percentile(99) / 1e3, h.percentile(99.9) / 1e3,
+             h.percentile(99.99) / 1e3, h.max / 1e3);
+      first = false;
+    }
+    printf("}},\"pgops\":{\"newly\":%" PRIu64 ",\"cow\":%" PRIu64 ",\"clone\":%" PRIu64 ",\"split\":%" PRIu64
+           ",\"merge\":%" PRIu64 ",\"spill\":%" PRIu64 ",\"unspill\":%" PRIu64 ",\"wops\":%" PRIu64
+           ",\"prefault\":%" PRIu64 ",\"mincore\":%" PRIu64 ",\"msync\":%" PRIu64 ",\"fsync\":%" PRIu64 "},",
+           DELTA(mi_pgop_stat.newly), DELTA(mi_pgop_stat.cow), DELTA(mi_pgop_stat.clone), DELTA(mi_pgop_stat.split),
+           DELTA(mi_pgop_stat.merge), DELTA(mi_pgop_stat.spill), DELTA(mi_pgop_stat.unspill),
+           DELTA(mi_pgop_stat.wops), DELTA(mi_pgop_stat.prefault), DELTA(mi_pgop_stat.mincore),
+           DELTA(mi_pgop_stat.msync), DELTA(mi_pgop_stat.fsync));
+    printf("\"wrt_lock\":{\"acquisitions\":%" PRIu64 ",\"contended\":%" PRIu64 ",\"wait_seconds\":%.3f},"
+           "\"txnid\":%" PRIu64 ",\"allocated_pages\":%" PRIu64 "}\n",
+           DELTA(mi_wrt_lock.acquisitions), DELTA(mi_wrt_lock.contended),
+           (after.mi_wrt_lock.wait_seconds16dot16 - before.mi_wrt_lock.wait_seconds16dot16) / 65536.0,
+           DELTA(mi_recent_txnid), after.mi_last_pgno + 1);
+  } else {
+    printf("Workload %s (%s): read %u%%, update %u%%, insert %u%%, scan %u%%, rmw %u%%, %s distribution\n",
+           cfg.wl->name, cfg.wl->alias, cfg.mix[op_read], cfg.mix[op_update], cfg.mix[op_insert], cfg.mix[op_scan],
+           cfg.mix[op_rmw], distribution::name(cfg.dist));
+    printf("  %" PRIu64 " records, values %u..%u bytes, %u process(es) x %u thread(s), batch %u, sync %s%s, "
+           "pagesize %u\n",
+           cfg.records, cfg.value_min, cfg.value_max, cfg.processes, cfg.threads, cfg.batch, cfg.sync_name,
+           (cfg.env_flags & MDBX_WRITEMAP) ? "+writemap" : "", after.mi_dxb_pagesize);
+    for (const auto &name : cfg.option_names)
+      printf("  option %s\n", name.c_str());
+    if (load_seconds > 0)
+      printf("Load: %.3f seconds, %.1f records/s\n", load_seconds, cfg.records / load_seconds);
+    printf("Run: %.3f seconds, %" PRIu64 " operations, %.1f ops/s\n", seconds, operations,
+           seconds > 0 ? operations / seconds : 0.0);
+    printf("  %-7s %10s %9s %9s %9s %9s %9s %9s %9s %9s\n", "latency", "count", "notfound", "mean", "p50", "p90",
+           "p99", "p99.9", "p99.99", "max");
+    for (size_t i = 0; i < op_kinds; ++i) {
+      const histogram &h = res.latency[i];
+      if (h.total)
+        printf("  %-7s %10" PRIu64 " %9" PRIu64 " %9.1f %9.1f %9.1f %9.1f %9.1f %9.1f %9.1f (us)\n", op_names[i],
+               h.total, res.notfound[i], h.mean() / 1e3, h.percentile(50) / 1e3, h.percentile(90) / 1e3,
+               h.percentile(99) / 1e3, h.percentile(99.9) / 1e3, h.percentile(99.99) / 1e3, h.max / 1e3);
+    }
+    if (res.scanned)
+      printf("  scanned %" PRIu64 " records\n", res.scanned);
+    printf("Page operations: new %" PRIu64 ", cow %" PRIu64 ", clone %" PRIu64 ", split %" PRIu64 ", merge %" PRIu64
+           ", spill %" PRIu64 ", unspill %" PRIu64 ", wops %" PRIu64 ", prefault %" PRIu64 ", mincore %" PRIu64
+           ", msync %" PRIu64 ", fsync %" PRIu64 "\n",
+           DELTA(mi_pgop_stat.newly), DELTA(mi_pgop_stat.cow), DELTA(mi_pgop_stat.clone), DELTA(mi_pgop_stat.split),
+           DELTA(mi_pgop_stat.merge), DELTA(mi_pgop_stat.spill), DELTA(mi_pgop_stat.unspill),
+           DELTA(mi_pgop_stat.wops), DELTA(mi_pgop_stat.prefault), DELTA(mi_pgop_stat.mincore),
+           DELTA(mi_pgop_stat.msync), DELTA(mi_pgop_stat.fsync));
+    printf("Write lock: %" PRIu64 " acquisitions, %" PRIu64 " contended, %.3f seconds waited\n",
+           DELTA(mi_wrt_lock.acquisitions), DELTA(mi_wrt_lock.contended),
+           (after.mi_wrt_lock.wait_seconds16dot16 - before.mi_wrt_lock.wait_seconds16dot16) / 65536.0);
+    printf("Transactions committed: %" PRIu64 ", allocated pages: %" PRIu64 "\n", DELTA(mi_recent_txnid),
+           after.mi_last_pgno + 1);
+  }
+#undef DELTA
+  fflush(stdout);
+}
+
+#if !(defined(_WIN32) || defined(_WIN64))
+static void write_fully(int fd, const void *ptr, size_t bytes) {
+  const char *p = static_cast<const char *>(ptr);
+  while (bytes) {
+    const ssize_t n = write(fd, p, bytes);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      failure("write", errno);
+    p += n;
+    bytes -= size_t(n);
+  }
+}
+
+static bool read_fully(int fd, void *ptr, size_t bytes) {
+  char *p = static_cast<char *>(ptr);
+  while (bytes) {
+    const ssize_t n = read(fd, p, bytes);
+    if (n < 0 && errno == EINTR)
+      continue;
+    if (n <= 0)
+      return false;
+    p += n;
+    bytes -= size_t(n);
+  }
+  return true;
+}
+#endif /* !Windows */
+
+int main(int argc, char *argv[]) {
+  prog = argv[0];
+  parse_args(argc, argv);
+
+  value_pool.resize(size_t(cfg.value_max) * 2 + 4096);
+  prng fill(cfg.seed ^ UINT64_C(0x5851F42D4C957F2D));
+  for (auto &byte : value_pool)
+    byte = uint8_t(fill.next());
+
+  if (!cfg.reuse) {
+    const int err = mdbx_env_delete(cfg.pathname.c_str(), MDBX_ENV_JUST_DELETE);
+    if (err != MDBX_SUCCESS && err != MDBX_RESULT_TRUE)
+      failure("mdbx_env_delete", err);
+  }
+
+  /* The environment is kept open by the main process during the whole run,
+   * so the session counters of page operations in the LCK are not reset
+   * while worker processes open and close it. */
+  MDBX_env *env = env_open(!cfg.reuse);
+  const double load_seconds = cfg.reuse ? 0 : load(env);
+
+  distribution::params params;
+  params.what = cfg.dist;
+  params.theta = cfg.zipf_theta;
+  params.hot_ops = cfg.hot_ops;
+  params.hot_items = cfg.hot_keys;
+  params.jitter = cfg.jitter;
+  params.prefixes = cfg.prefixes;
+  const distribution access(params, cfg.records);
+
+  MDBX_envinfo before, after;
+  int err = mdbx_env_info_ex(env, nullptr, &before, sizeof(before));
+  if (err != MDBX_SUCCESS)
+    failure("mdbx_env_info_ex", err);
+
+  results *total = new results;
+  total->clear();
+  if (cfg.processes == 1)
+    run_process(env, 0, access, *total);
+  else {
+#if defined(_WIN32) || defined(_WIN64)
+    failure("CreateProcess", MDBX_ENOSYS);
+#else
+    fflush(nullptr);
+    std::vector<pid_t> children;
+    std::vector<int> pipes;
+    for (unsigned p = 0; p < cfg.processes; ++p) {
+      int fds[2];
+      if (pipe(fds))
+        failure("pipe", errno);
+      const pid_t pid = fork();
+      if (pid < 0)
+        failure("fork", errno);
+      if (pid == 0) {
+        /* The inherited handle of the parent's environment must not be used
+         * nor closed by a child, so a child opens its own one. */
+        close(fds[0]);
+        MDBX_env *child_env = env_open(false);
+        results *own = new results;
+        own->clear();
+        run_process(child_env, p, access, *own);
+        mdbx_env_close(child_env);
+        write_fully(fds[1], own, sizeof(*own));
+        close(fds[1]);
+        _exit(EXIT_SUCCESS);
+      }
+      close(fds[1]);
+      children.push_back(pid);
+      pipes.push_back(fds[0]);
+    }
+    results *own = new results;
+    bool failed = false;
+    for (unsigned p = 0; p < cfg.processes; ++p) {
+      if (read_fully(pipes[p], own, sizeof(*own)))
+        total->merge(*own);
+      else
+        failed = true;
+      close(pipes[p]);
+      int status;
+      if (waitpid(children[p], &status, 0) != children[p] || !WIFEXITED(status) || WEXITSTATUS(status) != 0)
+        failed = true;
+    }
+    delete own;
+    if (failed) {
+      fprintf(stderr, "%s: some of worker processes failed\n", prog);
+      return EXIT_FAILURE;
+    }
+#endif /* !Windows */
+  }
+
+  err = mdbx_env_info_ex(env, nullptr, &after, sizeof(after));
+  if (err != MDBX_SUCCESS)
+    failure("mdbx_env_info_ex", err);
+  print_results(*total, load_seconds, before, after);
+  delete total;
+
+  err = mdbx_env_close(env);
+  if (err != MDBX_SUCCESS)
+    failure("mdbx_env_close", err);
+  return EXIT_SUCCESS;
+}
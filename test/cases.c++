@@ -108,6 +108,20 @@ void keycase_setup(const char *casename, actor_params &params) {
     params.keygen.keycase = kc_dashes;
     // TODO
     log_notice("<<< keycase_setup(%s): done", casename);
+  } else if (strcmp(casename, "zipfian") == 0 || strcmp(casename, "hotspot") == 0) {
+    log_notice(">>> keycase_setup(%s)", casename);
+    params.keygen.keycase = (casename[0] == 'z') ? kc_zipfian : kc_hotspot;
+    log_notice("<<< keycase_setup(%s): done", casename);
+  } else if (strcmp(casename, "sequential") == 0 || strcmp(casename, "latest") == 0 ||
+             strcmp(casename, "prefix") == 0) {
+    log_notice(">>> keycase_setup(%s)", casename);
+    params.keygen.keycase = (casename[0] == 's') ? kc_sequential : (casename[0] == 'l') ? kc_latest : kc_prefix;
+    /* для этих распределений важна локальность, поэтому порядок ключей
+     * должен следовать порядку номеров без перемешивания */
+    params.keygen.mesh = 0;
+    params.keygen.rotate = 0;
+    params.keygen.offset = 0;
+    log_notice("<<< keycase_setup(%s): done", casename);
   } else if (strcmp(casename, "custom") == 0) {
     log_notice("=== keycase_setup(%s): skip", casename);
     params.keygen.keycase = kc_custom;
@@ -0,0 +1,29 @@
+# Copyright (c) 2012-2025 Леонид Юрьев aka Leonid Yuriev <leo@yuriev.ru> ###############################################
+# SPDX-License-Identifier: Apache-2.0
+
+# Запускает две команды и сравнивает их коды завершения и вывод, за исключением
+# строк, соответствующих регулярному выражению SKIP (например, с затраченным временем).
+# Использование: cmake -DFIRST="cmd;args" -DSECOND="cmd;args" [-DSKIP=regex] -P compare_outputs.cmake
+
+if(NOT FIRST OR NOT SECOND)
+  message(FATAL_ERROR "Both FIRST and SECOND commands should be given")
+endif()
+
+foreach(which FIRST SECOND)
+  execute_process(
+    COMMAND ${${which}}
+    RESULT_VARIABLE ${which}_rc
+    OUTPUT_VARIABLE ${which}_out
+    ERROR_VARIABLE ${which}_out)
+  if(SKIP)
+    string(REGEX REPLACE "[^\n]*${SKIP}[^\n]*" "" ${which}_out "${${which}_out}")
+  endif()
+endforeach()
+
+if(NOT FIRST_rc STREQUAL SECOND_rc)
+  message(FATAL_ERROR "Exit codes differ: ${FIRST_rc} for `${FIRST}` and ${SECOND_rc} for `${SECOND}`")
+endif()
+if(NOT FIRST_out STREQUAL SECOND_out)
+  message(FATAL_ERROR "Outputs differ:\n--- ${FIRST}\n${FIRST_out}\n+++ ${SECOND}\n${SECOND_out}")
+endif()
+message(STATUS "Both outputs are the same, exit code ${FIRST_rc}")
@@ -421,6 +421,8 @@ void dump(const char *title) {
                 i->params.keygen.rotate, i->params.keygen.offset, i->params.keygen.split,
                 i->params.keygen.width - i->params.keygen.split);
     log_verbose("keygen.zerofill: %s\n", i->params.keygen.zero_fill ? "Yes" : "No");
+    log_verbose("keygen.distribution: skew %u%%, hotspot %u%%/%u%%, jitter %u, prefixes %u\n", i->params.keygen.skew,
+                i->params.keygen.hot_ops, i->params.keygen.hot_keys, i->params.keygen.jitter, i->params.keygen.prefixes);
     log_verbose("key: minlen %u, maxlen %u\n", i->params.keylen_min, i->params.keylen_max);
     log_verbose("data: minlen %u, maxlen %u\n", i->params.datalen_min, i->params.datalen_max);
 
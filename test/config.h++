@@ -23,7 +23,8 @@ enum actor_testcase {
   ac_copy,
   ac_append,
   ac_ttl,
-  ac_nested
+  ac_nested,
+  ac_readscale
 };
 
 enum actor_status {
@@ -42,8 +43,12 @@ const char *status2str(actor_status status);
 enum keygen_case {
   kc_random, /* [ 6.. 2.. 7.. 4.. 0.. 1.. 5.. 3.. ] */
   kc_dashes, /* [ 0123.. 4567.. ] */
+  kc_zipfian,    /* перекос по закону Ципфа */
+  kc_hotspot,    /* x% операций над y% ключей */
+  kc_sequential, /* последовательно со случайным разбросом */
+  kc_latest,     /* чаще всего последние ключи */
+  kc_prefix,     /* группы ключей с общим префиксом */
   kc_custom,
-  /* TODO: more cases */
 };
 
 const char *keygencase2str(const keygen_case);
@@ -214,6 +219,15 @@ struct keygen_params_pod {
    *  Ненулевое значение параметра split фактически включает генерацию значений,
    *  при этом значение split определяет сколько бит исходного абстрактного
    *  номера будет отрезано для генерации значения.
+   *
+   * skew, hot_ops, hot_keys, jitter и prefixes:
+   *  Параметры неравномерных распределений (см. distribution.h++), которые
+   *  задаются посредством keycase и используются акторами для выбора
+   *  номеров уже существующих записей. Параметр skew задает перекос
+   *  (theta * 100) для zipfian, latest и prefix, параметры hot_ops и hot_keys
+   *  задают в процентах долю операций над долей "горячих" ключей для
+   *  hotspot, jitter задает разброс для sequential, а prefixes количество
+   *  групп ключей с общим префиксом для prefix.
    */
 
   uint8_t width{0};
@@ -224,6 +238,11 @@ struct keygen_params_pod {
   uint64_t offset{0};
   keygen_case keycase{kc_random};
   bool zero_fill{false};
+  uint8_t skew{99};
+  uint8_t hot_ops{90};
+  uint8_t hot_keys{10};
+  unsigned jitter{16};
+  unsigned prefixes{16};
 };
 
 struct actor_params_pod {
@@ -0,0 +1,168 @@
+/// \author Леонид Юрьев aka Leonid Yuriev <leo@yuriev.ru> \date 2025
+/// \copyright SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstring>
+
+namespace keygen {
+
+/* Неравномерные распределения выбора элементов из множества [0, n).
+ *
+ * Равномерный перебор ключей не воспроизводит поведение движка под
+ * реальной нагрузкой: разделение страниц, переработка GC и вытеснение
+ * грязных страниц существенно зависят от перекоса в обращениях к данным.
+ * Поэтому здесь реализованы следующие распределения:
+ *  - uniform: равномерное;
+ *  - zipfian: по закону Ципфа с параметром theta, наиболее популярен
+ *    элемент 0 (алгоритм Gray et al. "Quickly Generating Billion-Record
+ *    Synthetic Databases", как в YCSB);
+ *  - hotspot: доля hot_ops операций приходится на первые hot_items
+ *    элементов, остальные операции равномерно распределены по прочим;
+ *  - sequential: последовательный перебор с циклическим переходом через
+ *    конец и случайным отклонением не более jitter;
+ *  - latest: наиболее популярны последние элементы, популярность
+ *    убывает по закону Ципфа от конца (как "latest" в YCSB);
+ *  - prefix: элементы поровну разбиты на группы с общим префиксом
+ *    (например "арендатор + идентификатор"), группа выбирается по закону
+ *    Ципфа, а элемент внутри группы равномерно.
+ *
+ * Заголовок не зависит от остального кода тестов, так как также
+ * используется в mdbx_bench. */
+
+class distribution {
+public:
+  enum kind { uniform, zipfian, hotspot, sequential, latest, prefix };
+
+  struct params {
+    kind what{uniform};
+    double theta{0.99};
+    double hot_ops{0.9};
+    double hot_items{0.1};
+    uint64_t jitter{16};
+    uint64_t prefixes{16};
+  };
+
+  static const char *name(kind what) {
+    static const char *const names[] = {"uniform", "zipfian", "hotspot", "sequential", "latest", "prefix"};
+    return (unsigned(what) < sizeof(names) / sizeof(names[0])) ? names[what] : "?";
+  }
+
+  static bool parse(const char *str, kind &what) {
+    for (unsigned i = uniform; i <= prefix; ++i)
+      if (strcmp(str, name(kind(i))) == 0) {
+        what = kind(i);
+        return true;
+      }
+    return false;
+  }
+
+  distribution() = default;
+  distribution(const params &setup_params, uint64_t items) { setup(setup_params, items); }
+
+  void setup(const params &setup_params, uint64_t items) {
+    params_ = setup_params;
+    items_ = std::max(items, uint64_t(1));
+    cursor_ = 0;
+    params_.theta = std::min(std::max(params_.theta, 0.01), 0.999);
+    params_.hot_ops = std::min(std::max(params_.hot_ops, 0.0), 1.0);
+    params_.hot_items = std::min(std::max(params_.hot_items, 0.0), 1.0);
+    params_.prefixes = std::min(std::max(params_.prefixes, uint64_t(1)), items_);
+    if (params_.what == zipfian || params_.what == latest)
+      zipf_setup(items_);
+    else if (params_.what == prefix)
+      zipf_setup(params_.prefixes);
+  }
+
+  const params &get_params() const { return params_; }
+  uint64_t items() const { return items_; }
+
+  /* Возвращает номер элемента в [0, items), где items может отличаться от
+   * заданного при setup(), например расти по мере вставок для latest. */
+  uint64_t next(uint64_t &state, uint64_t items) {
+    if (items < 2)
+      return 0;
+    switch (params_.what) {
+    default:
+    case uniform:
+      return below(state, items);
+    case zipfian:
+      return zipf(state) % items;
+    case hotspot: {
+      const uint64_t hot = std::min(std::max(uint64_t(items * params_.hot_items), uint64_t(1)), items);
+      if (hot == items || real(state) < params_.hot_ops)
+        return below(state, hot);
+      return hot + below(state, items - hot);
+    }
+    case sequential: {
+      const uint64_t jitter = std::min(params_.jitter, items - 1);
+      const uint64_t position = cursor_++ % items;
+      return (position + items - jitter + below(state, jitter * 2 + 1)) % items;
+    }
+    case latest: {
+      const uint64_t back = zipf(state);
+      return (back < items) ? items - 1 - back : items - 1;
+    }
+    case prefix: {
+      const uint64_t groups = std::min(params_.prefixes, items);
+      const uint64_t group_size = items / groups;
+      return zipf(state) % groups * group_size + below(state, group_size);
+    }
+    }
+  }
+
+  uint64_t next(uint64_t &state) { return next(state, items_); }
+
+  static uint64_t splitmix64(uint64_t &state) {
+    uint64_t z = (state += UINT64_C(0x9E3779B97F4A7C15));
+    z = (z ^ (z >> 30)) * UINT64_C(0xBF58476D1CE4E5B9);
+    z = (z ^ (z >> 27)) * UINT64_C(0x94D049BB133111EB);
+    return z ^ (z >> 31);
+  }
+
+private:
+  params params_;
+  uint64_t items_{1}, cursor_{0};
+  uint64_t zipf_items_{0};
+  double alpha_{0}, zetan_{0}, eta_{0}, half_pow_theta_{0};
+
+  static double real(uint64_t &state) { return (splitmix64(state) >> 11) * (1.0 / 9007199254740992.0); }
+  static uint64_t below(uint64_t &state, uint64_t bound) { return bound ? splitmix64(state) % bound : 0; }
+
+  /* Для больших n точная сумма заменяется интегральной оценкой хвоста,
+   * чтобы настройка не занимала заметного времени. */
+  static double zeta(uint64_t n, double theta) {
+    const uint64_t exact = std::min(n, uint64_t(1) << 20);
+    double sum = 0;
+    for (uint64_t i = 0; i < exact; ++i)
+      sum += 1 / std::pow(double(i + 1), theta);
+    if (n > exact)
+      sum += (std::pow(double(n) + 0.5, 1 - theta) - std::pow(double(exact) + 0.5, 1 - theta)) / (1 - theta);
+    return sum;
+  }
+
+  void zipf_setup(uint64_t n) {
+    const double theta = params_.theta;
+    zipf_items_ = n;
+    alpha_ = 1 / (1 - theta);
+    zetan_ = zeta(n, theta);
+    half_pow_theta_ = 1 + std::pow(0.5, theta);
+    eta_ = (n > 2) ? (1 - std::pow(2.0 / n, 1 - theta)) / (1 - zeta(2, theta) / zetan_) : 0;
+  }
+
+  uint64_t zipf(uint64_t &state) const {
+    const double u = real(state);
+    const double uz = u * zetan_;
+    if (uz < 1 || zipf_items_ < 2)
+      return 0;
+    if (uz < half_pow_theta_ || zipf_items_ < 3)
+      return 1;
+    const uint64_t item = uint64_t(zipf_items_ * std::pow(eta_ * u - eta_ + 1, alpha_));
+    return std::min(item, zipf_items_ - 1);
+  }
+};
+
+} /* namespace keygen */
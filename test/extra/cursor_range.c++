@@ -0,0 +1,138 @@
+/// \author Леонид Юрьев aka Leonid Yuriev <leo@yuriev.ru> \date 2025
+/// \copyright SPDX-License-Identifier: Apache-2.0
+
+#include "mdbx.h++"
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+#if defined(__cpp_lib_ranges) && __cpp_lib_ranges >= 201911L
+static_assert(std::ranges::input_range<mdbx::cursor_range>, "cursor_range must be an input range");
+static_assert(std::ranges::view<mdbx::cursor_range>, "cursor_range must be a view");
+#endif /* __cpp_lib_ranges */
+
+using reference_t = std::vector<std::pair<std::string, std::string>>;
+
+static std::string make_key(unsigned n) {
+  char buf[16];
+  snprintf(buf, sizeof(buf), "k%06u", n);
+  return buf;
+}
+
+static bool check(mdbx::cursor_range &&view, const reference_t &reference, const std::string &from,
+                  const std::string &to, bool backward, const char *caption) {
+  reference_t expected;
+  for (const auto &pair : reference)
+    if ((from.empty() || pair.first >= from) && (to.empty() || pair.first < to))
+      expected.push_back(pair);
+  if (backward)
+    std::reverse(expected.begin(), expected.end());
+
+  size_t n = 0;
+  for (const mdbx::pair &pair : view) {
+    if (n >= expected.size()) {
+      std::cerr << caption << ": unexpected extra pair " << pair << "\n";
+      return false;
+    }
+    if (pair.key != mdbx::slice(expected[n].first) || pair.value != mdbx::slice(expected[n].second)) {
+      std::cerr << caption << ": mismatch at " << n << ", got " << pair << ", expected {" << expected[n].first << ", "
+                << expected[n].second << "}\n";
+      return false;
+    }
+    ++n;
+  }
+  if (n != expected.size()) {
+    std::cerr << caption << ": got " << n << " pairs, expected " << expected.size() << "\n";
+    return false;
+  }
+  return true;
+}
+
+static mdbx::slice bound(const std::string &key) { return key.empty() ? mdbx::slice::invalid() : mdbx::slice(key); }
+
+static bool doit() {
+  mdbx::path db_filename = "test-cursor-range";
+  mdbx::env::remove(db_filename);
+  mdbx::env_managed env(db_filename, mdbx::env_managed::create_parameters(), mdbx::env::operate_parameters(3));
+
+  reference_t single, multi;
+  auto txn = env.start_write();
+  auto plain_map = txn.create_map("single", mdbx::key_mode::usual, mdbx::value_mode::single);
+  auto multi_map = txn.create_map("multi", mdbx::key_mode::usual, mdbx::value_mode::multi);
+  for (unsigned i = 0; i < 10000; ++i) {
+    const std::string key = make_key(i * 2 + 1), value = "v" + std::to_string(i * 7 % 1000);
+    txn.insert(plain_map, mdbx::slice(key), mdbx::slice(value));
+    single.emplace_back(key, value);
+    if (i % 100 == 0)
+      for (unsigned j = 0; j < 1 + i % 7; ++j) {
+        const std::string dup = "d" + std::to_string(j);
+        txn.upsert(multi_map, mdbx::slice(key), mdbx::slice(dup));
+        multi.emplace_back(key, dup);
+      }
+  }
+  txn.commit();
+
+  static const struct {
+    const char *from, *to;
+  } bounds[] = {{"", ""},           {"k000100", "k000200"}, {"k000101", "k000101"}, {"k012345", ""},
+                {"", "k000777"},    {"k019990", "k020001"}, {"k999999", ""},        {"", "k000000"},
+                {"k000200", "k000100"}, {"k000001", "k000129"}};
+
+  txn = env.start_read();
+  for (const auto &b : bounds)
+    for (bool backward : {false, true}) {
+      auto cursor = txn.open_cursor(plain_map);
+      if (!check(cursor.range(bound(b.from), bound(b.to), backward), single, b.from, b.to, backward, "single") ||
+          !check(txn.scan(multi_map, bound(b.from), bound(b.to), backward), multi, b.from, b.to, backward, "multi"))
+        return false;
+    }
+
+  // partial iteration, restart and move of a view
+  auto cursor = txn.open_cursor(plain_map);
+  auto view = cursor.range();
+  auto it = view.begin();
+  for (size_t i = 0; i < 1000; ++i)
+    ++it;
+  if ((*it).key != mdbx::slice(single[1000].first)) {
+    std::cerr << "partial: unexpected position " << *it << "\n";
+    return false;
+  }
+  mdbx::cursor_range moved(std::move(view));
+  size_t left = 0;
+  for (auto i = moved.begin(); i != moved.end(); ++i)
+    ++left;
+  if (left != single.size() - 1000 || !moved.empty() || !view.empty()) {
+    std::cerr << "moved: unexpected " << left << " pairs left\n";
+    return false;
+  }
+  if (!check(cursor.range(true), single, "", "", true, "restart"))
+    return false;
+
+#if defined(__cpp_lib_ranges) && __cpp_lib_ranges >= 201911L
+  size_t odd_values = 0;
+  for (const mdbx::pair &pair : txn.scan(plain_map) | std::views::filter([](const mdbx::pair &pair) {
+                                  return pair.value.length() % 2 != 0;
+                                }) | std::views::take(100))
+    odd_values += pair.value.length() % 2;
+  if (odd_values != 100) {
+    std::cerr << "ranges: unexpected " << odd_values << " values\n";
+    return false;
+  }
+#endif /* __cpp_lib_ranges */
+
+  txn.abort();
+  return true;
+}
+
+int main(int argc, char *argv[]) {
+  (void)argc;
+  (void)argv;
+  try {
+    return doit() ? EXIT_SUCCESS : EXIT_FAILURE;
+  } catch (const std::exception &ex) {
+    std::cerr << "Exception: " << ex.what() << "\n";
+    return EXIT_FAILURE;
+  }
+}
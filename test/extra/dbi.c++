@@ -1,6 +1,7 @@
 #include "mdbx.h++"
 
 #include <iostream>
+#include <vector>
 
 mdbx::path db_filename = "test-dbi";
 
@@ -191,12 +192,76 @@ bool case3() {
   return ok;
 }
 
+static int enum_count(void *ctx, const MDBX_txn *, const MDBX_val *, MDBX_db_flags_t, const struct MDBX_stat *,
+                      MDBX_dbi dbi) noexcept {
+  auto counters = static_cast<size_t *>(ctx);
+  counters[0] += 1;
+  counters[1] += dbi ? 1 : 0;
+  return MDBX_SUCCESS;
+}
+
+bool case4() {
+  // проверяем поиск хендлов по именам при большом количестве таблиц,
+  // в том числе после закрытия и переименования части из них
+  bool ok = true;
+  const unsigned n = 4000;
+  mdbx::env_managed::create_parameters createParameters;
+  mdbx::env::remove(db_filename);
+  mdbx::env::operate_parameters operateParameters(n, 10);
+  mdbx::env_managed env(db_filename, createParameters, operateParameters);
+  std::vector<MDBX_dbi> handles(n);
+  {
+    mdbx::txn_managed txn = env.start_write();
+    for (unsigned i = 0; i < n; ++i)
+      handles[i] = txn.create_map("table-" + std::to_string(i));
+    txn.commit();
+  }
+
+  for (int round = 0; round < 3; ++round) {
+    mdbx::txn_managed txn = env.start_write();
+    for (unsigned i = round; i < n; i += 3) {
+      env.close_map(handles[i]);
+      const std::string name = "table-" + std::to_string(i);
+      const std::string renamed = "renamed-" + std::to_string(i);
+      handles[i] = txn.open_map(name);
+      if (i % 2) {
+        mdbx::map_handle dbi(handles[i]);
+        txn.rename_map(dbi, renamed);
+        if (txn.open_map(renamed).dbi != handles[i] || !txn.rename_map(renamed, name)) {
+          std::cerr << "Unexpected handle for renamed table " << i << "\n";
+          ok = false;
+        }
+      }
+    }
+    txn.commit();
+  }
+
+  mdbx::txn_managed txn = env.start_read();
+  for (unsigned i = 0; i < n; ++i) {
+    MDBX_dbi dbi = 0;
+    int err = mdbx_dbi_open(txn, ("table-" + std::to_string(i)).c_str(), MDBX_DB_ACCEDE, &dbi);
+    if (err != MDBX_SUCCESS || dbi != handles[i]) {
+      std::cerr << "Unexpected err " << err << " or handle " << dbi << " for table " << i << "\n";
+      ok = false;
+    }
+  }
+
+  size_t counters[2] = {0, 0};
+  int err = mdbx_enumerate_tables(txn, enum_count, counters);
+  if (err != MDBX_SUCCESS || counters[0] != n || counters[1] != n) {
+    std::cerr << "Unexpected err " << err << " or tables " << counters[0] << "/" << counters[1] << "\n";
+    ok = false;
+  }
+  return ok;
+}
+
 int doit() {
 
   bool ok = true;
   ok = case1() && ok;
   ok = case2() && ok;
   ok = case3() && ok;
+  ok = case4() && ok;
 
   if (ok) {
     std::cout << "OK\n";
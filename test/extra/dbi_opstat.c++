@@ -0,0 +1,73 @@
+/// \author Леонид Юрьев aka Leonid Yuriev <leo@yuriev.ru> \date 2025
+/// \copyright SPDX-License-Identifier: Apache-2.0
+
+#include "mdbx.h++"
+#include <iostream>
+#include <string>
+
+static std::string make_key(unsigned n) {
+  char buf[16];
+  snprintf(buf, sizeof(buf), "k%06u", n);
+  return buf;
+}
+
+static bool expect(const char *caption, uint64_t got, bool condition) {
+  if (!condition)
+    std::cerr << caption << ": unexpected " << got << "\n";
+  return condition;
+}
+
+static bool doit() {
+  mdbx::path db_filename = "test-dbi-opstat";
+  mdbx::env::remove(db_filename);
+  mdbx::env_managed env(db_filename, mdbx::env_managed::create_parameters(), mdbx::env::operate_parameters(4));
+
+  const std::string big_value(env.get_pagesize() * 3, '#');
+  auto txn = env.start_write();
+  auto hot = txn.create_map("hot");
+  auto cold = txn.create_map("cold");
+  for (unsigned i = 0; i < 10000; ++i)
+    txn.upsert(hot, mdbx::slice(make_key(i)), mdbx::slice("value-of-hot-table"));
+  for (unsigned i = 0; i < 10; ++i)
+    txn.upsert(cold, mdbx::slice(make_key(i)), mdbx::slice(big_value));
+  for (unsigned i = 0; i < 5000; ++i)
+    txn.erase(hot, mdbx::slice(make_key(i)));
+  txn.commit();
+
+  txn = env.start_read();
+  for (unsigned i = 0; i < 100; ++i)
+    txn.get(hot, mdbx::slice(make_key(5000 + i * 7)));
+  auto cursor = txn.open_cursor(cold);
+  cursor.find(mdbx::slice(make_key(3)));
+  for (unsigned i = 0; i < 5; ++i)
+    cursor.to_next(false);
+  cursor.close();
+
+  const auto h = txn.get_map_opstat(hot);
+  const auto c = txn.get_map_opstat(cold, true);
+  const auto z = txn.get_map_opstat(cold);
+  txn.abort();
+
+  if (h.puts == 0 && c.puts == 0) {
+    std::cerr << "counters are not collected (MDBX_ENABLE_DBI_OPSTAT=0), skip checking\n";
+    return true;
+  }
+  return expect("hot.puts", h.puts, h.puts == 10000) && expect("hot.dels", h.dels, h.dels == 5000) &&
+         expect("hot.gets", h.gets, h.gets == 100) && expect("hot.split", h.split, h.split > 0) &&
+         expect("hot.merge", h.merge, h.merge > 0) && expect("hot.large", h.large, h.large == 0) &&
+         expect("cold.puts", c.puts, c.puts == 10) && expect("cold.large", c.large, c.large >= 30) &&
+         expect("cold.newly", c.newly, c.newly >= c.large) && expect("cold.seeks", c.seeks, c.seeks == 1) &&
+         expect("cold.steps", c.steps, c.steps == 5) && expect("cold.gets", c.gets, c.gets == 0) &&
+         expect("reset", z.puts + z.seeks + z.steps + z.newly, z.puts + z.seeks + z.steps + z.newly == 0);
+}
+
+int main(int argc, char *argv[]) {
+  (void)argc;
+  (void)argv;
+  try {
+    return doit() ? EXIT_SUCCESS : EXIT_FAILURE;
+  } catch (const std::exception &ex) {
+    std::cerr << "Exception: " << ex.what() << "\n";
+    return EXIT_FAILURE;
+  }
+}
@@ -0,0 +1,95 @@
+/// \author Леонид Юрьев aka Leonid Yuriev <leo@yuriev.ru> \date 2025
+/// \copyright SPDX-License-Identifier: Apache-2.0
+
+#include "mdbx.h++"
+#include <iostream>
+#include <string>
+
+static std::string make_key(unsigned n) {
+  char buf[16];
+  snprintf(buf, sizeof(buf), "k%06u", n);
+  return buf;
+}
+
+static bool expect(const char *caption, uint64_t got, bool condition) {
+  if (!condition)
+    std::cerr << caption << ": unexpected " << got << "\n";
+  return condition;
+}
+
+static MDBX_latency_hist hist(const mdbx::env &env, MDBX_latency_kind_t kind, bool aggregate) {
+  MDBX_latency_hist result;
+  mdbx::error::success_or_throw(mdbx_env_latency_hist(env, kind, aggregate, &result, sizeof(result)));
+  uint64_t sum = 0;
+  for (const auto bucket : result.buckets)
+    sum += bucket;
+  if (sum != result.count)
+    throw std::logic_error("sum of buckets mismatch count");
+  return result;
+}
+
+static bool doit() {
+  mdbx::path db_filename = "test-latency-hist";
+  mdbx::env::remove(db_filename);
+  mdbx::env_managed env(db_filename, mdbx::env_managed::create_parameters(), mdbx::env::operate_parameters(4));
+
+  MDBX_latency_hist probe;
+  int err = mdbx_env_set_option(env, MDBX_opt_latency_sampling, 1);
+  if (err == MDBX_ENOSYS) {
+    if (mdbx_env_latency_hist(env, MDBX_LATENCY_GET, true, &probe, sizeof(probe)) != MDBX_ENOSYS)
+      return expect("mdbx_env_latency_hist", 0, false);
+    std::cerr << "histograms are not supported (MDBX_ENABLE_LATENCY_HIST=0), skip checking\n";
+    return true;
+  }
+  mdbx::error::success_or_throw(err);
+
+  auto txn = env.start_write();
+  auto map = txn.create_map("latency");
+  for (unsigned i = 0; i < 1000; ++i)
+    txn.upsert(map, mdbx::slice(make_key(i)), mdbx::slice("value"));
+  txn.commit();
+
+  /* период округляется до степени двойки */
+  mdbx::error::success_or_throw(mdbx_env_set_option(env, MDBX_opt_latency_sampling, 3));
+  uint64_t period = 0;
+  mdbx::error::success_or_throw(mdbx_env_get_option(env, MDBX_opt_latency_sampling, &period));
+  if (!expect("period", period, period == 4))
+    return false;
+
+  for (unsigned n = 0; n < 8; ++n) {
+    txn = env.start_read();
+    for (unsigned i = 0; i < 100; ++i)
+      txn.get(map, mdbx::slice(make_key(i * 7)));
+    auto cursor = txn.open_cursor(map);
+    for (unsigned i = 0; i < 40; ++i) {
+      cursor.find(mdbx::slice(make_key(i * 13)));
+      cursor.to_next(false);
+    }
+    cursor.close();
+    txn.abort();
+  }
+
+  const auto begin = hist(env, MDBX_LATENCY_READ_BEGIN, false);
+  const auto get = hist(env, MDBX_LATENCY_GET, false);
+  const auto seek = hist(env, MDBX_LATENCY_SEEK, true);
+  const auto lock = hist(env, MDBX_LATENCY_WRITE_LOCK, true);
+  return expect("begin.count", begin.count, begin.count == 2) && expect("get.count", get.count, get.count == 200) &&
+         expect("seek.count", seek.count, seek.count == 80) &&
+         expect("get.total_ns", get.total_ns, get.total_ns > 0) &&
+#if !(defined(_WIN32) || defined(_WIN64))
+         expect("lock.count", lock.count, lock.count >= 1) &&
+#endif
+         expect("invalid kind", 0,
+                mdbx_env_latency_hist(env, MDBX_LATENCY_KINDS, true, &probe, sizeof(probe)) == MDBX_EINVAL);
+}
+
+int main(int argc, char *argv[]) {
+  (void)argc;
+  (void)argv;
+  try {
+    return doit() ? EXIT_SUCCESS : EXIT_FAILURE;
+  } catch (const std::exception &ex) {
+    std::cerr << "Exception: " << ex.what() << "\n";
+    return EXIT_FAILURE;
+  }
+}
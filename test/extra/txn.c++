@@ -367,6 +367,217 @@ bool case3(const mdbx::path &path, bool no_sticky_threads) {
   return ok;
 }
 
+bool case4(const mdbx::path &path, bool no_sticky_threads) {
+  mdbx::env::remove(path);
+  mdbx::env_managed::create_parameters createParameters;
+  createParameters.geometry.make_dynamic(21 * mdbx::env::geometry::MiB, 84 * mdbx::env::geometry::MiB);
+  /* views of a shared snapshot don't occupy reader slots,
+   * so the number of threads may exceed the max_readers */
+  mdbx::env::operate_parameters operateParameters(100, 4);
+  operateParameters.options.no_sticky_threads = no_sticky_threads;
+  mdbx::env_managed env(path, createParameters, operateParameters);
+
+  const mdbx::slice key("key"), val0("val0"), val1("val1");
+  auto txn = env.start_write();
+  txn.insert(1, key, val0);
+  txn.commit();
+
+  MDBX_snapshot *snapshot = nullptr;
+  int err = mdbx_snapshot_acquire(env, &snapshot);
+  if (err != MDBX_SUCCESS) {
+    std::cerr << "mdbx_snapshot_acquire() failed " << err << "\n";
+    return false;
+  }
+  const uint64_t snapshot_id = mdbx_snapshot_id(snapshot);
+
+  const auto N = std::thread::hardware_concurrency() * 2 + 5;
+  std::latch s0(N + 1), s1(N + 1);
+  std::vector<std::thread> l;
+
+  volatile bool ok = snapshot_id > 0;
+  for (size_t n = 0; n < N; ++n)
+    l.push_back(std::thread([&]() {
+      MDBX_txn *view = nullptr;
+      s0.arrive_and_wait();
+      int err = mdbx_snapshot_begin(snapshot, &view, nullptr);
+      mdbx::slice value;
+      if (err != MDBX_SUCCESS || mdbx_txn_id(view) != snapshot_id || mdbx_get(view, 1, key, &value) != MDBX_SUCCESS ||
+          value != val0) {
+        std::cerr << "Unexpected view state, err " << err << "\n";
+        ok = false;
+      }
+
+      s1.arrive_and_wait();
+      /* the snapshot may be released by now, but still retained by the view */
+      err = mdbx_snapshot_begin(snapshot, &view, nullptr);
+      if (err != MDBX_SUCCESS || mdbx_txn_id(view) != snapshot_id || mdbx_get(view, 1, key, &value) != MDBX_SUCCESS ||
+          value != val0) {
+        std::cerr << "Unexpected renewed view state, err " << err << "\n";
+        ok = false;
+      }
+      if (mdbx_txn_park(view, false) != MDBX_EINVAL)
+        ok = false;
+      mdbx_txn_abort(view);
+    }));
+
+  s0.arrive_and_wait();
+  txn = env.start_write();
+  txn.upsert(1, key, val1);
+  txn.commit();
+  s1.arrive_and_wait();
+  err = mdbx_snapshot_release(snapshot);
+  if (err != MDBX_SUCCESS)
+    ok = false;
+
+  for (auto &t : l)
+    t.join();
+
+  txn = env.start_read();
+  if (txn.get(1, key) != val1)
+    ok = false;
+  txn.abort();
+  return ok;
+}
+
+/* Состояние хендла сбрасывается при обычном старте транзакции и таблица
+ * требует повторного чтения из MainDB, а при повторном использовании
+ * MVCC-снимка состояние хендла сохраняется. */
+static bool is_stale(const mdbx::txn &txn, const mdbx::map_handle &map) {
+  unsigned flags, state;
+  return mdbx_dbi_flags_ex(txn, map.dbi, &flags, &state) == MDBX_SUCCESS && (state & MDBX_DBI_STALE) != 0;
+}
+
+bool case5(const mdbx::path &path) {
+  mdbx::env::remove(path);
+  mdbx::env_managed::create_parameters createParameters;
+  createParameters.geometry.make_dynamic(21 * mdbx::env::geometry::MiB, 84 * mdbx::env::geometry::MiB);
+  mdbx::env_managed env(path, createParameters, mdbx::env::operate_parameters(100, 10));
+
+  const mdbx::slice key("key"), val0("val0"), val1("val1");
+  auto txn = env.start_write();
+  auto map = txn.create_map("xyz");
+  txn.insert(map, key, val0);
+  txn.commit();
+
+  /* renewal of a reset txn while the snapshot is unchanged,
+   * which should reuse the previous state of DBI-handles */
+  bool ok = true;
+  auto rtxn = env.start_read();
+  const auto txnid = rtxn.id();
+  for (size_t i = 0; i < 1000; ++i) {
+    if (rtxn.get(map, key) != val0 || rtxn.id() != txnid)
+      ok = false;
+    rtxn.reset_reading();
+    rtxn.renew_reading();
+    /* the zero-work renewal was done, otherwise the table would be stale */
+    if (is_stale(rtxn, map))
+      ok = false;
+  }
+
+  /* reopen the handle while the txn is reset */
+  rtxn.reset_reading();
+  env.close_map(map);
+  txn = env.start_write();
+  map = txn.open_map("xyz");
+  txn.commit();
+  rtxn.renew_reading();
+  if (!is_stale(rtxn, map) || rtxn.get(map, key) != val0)
+    ok = false;
+
+  /* the snapshot was changed */
+  rtxn.reset_reading();
+  txn = env.start_write();
+  txn.upsert(map, key, val1);
+  txn.commit();
+  rtxn.renew_reading();
+  if (!is_stale(rtxn, map) || rtxn.get(map, key) != val1 || rtxn.id() <= txnid)
+    ok = false;
+  rtxn.abort();
+  return ok;
+}
+
+#if !defined(_WIN32) && !defined(_WIN64)
+#include <fcntl.h>
+#include <unistd.h>
+
+static std::string pageship_stream;
+static size_t pageship_deltas;
+static int pageship_failure;
+
+static int pageship_callback(const MDBX_env *env, uint64_t txnid, const void *data, size_t bytes) noexcept {
+  (void)env;
+  (void)txnid;
+  if (pageship_failure)
+    return pageship_failure;
+  if (data)
+    pageship_stream.append(static_cast<const char *>(data), bytes);
+  else
+    pageship_deltas += 1;
+  return MDBX_SUCCESS;
+}
+
+bool case6(const mdbx::path &path) {
+  const mdbx::path follower_path = "test-txn-follower", stream_path = "test-txn-pageship";
+  mdbx::env::remove(path);
+  mdbx::env::remove(follower_path);
+  mdbx::env_managed::create_parameters createParameters;
+  createParameters.geometry.make_dynamic(21 * mdbx::env::geometry::MiB, 84 * mdbx::env::geometry::MiB);
+  mdbx::env_managed env(path, createParameters, mdbx::env::operate_parameters(100, 10));
+
+  const mdbx::slice key("key"), val0("val0");
+  auto txn = env.start_write();
+  auto map = txn.create_map("xyz");
+  txn.insert(map, key, val0);
+  txn.commit();
+
+  /* the follower is a copy at the base of the stream */
+  bool ok = mdbx_env_set_pageship(env, pageship_callback) == MDBX_SUCCESS;
+  env.copy(follower_path, false);
+  for (size_t i = 0; i < 3; ++i) {
+    txn = env.start_write();
+    for (size_t n = 0; n < 1000; ++n)
+      txn.upsert(map, mdbx::pair(mdbx::slice::wrap(n), mdbx::slice::wrap(i)));
+    txn.upsert(map, key, mdbx::slice::wrap(i));
+    /* a failure of shipping doesn't fail the commit, the next delta covers the txn */
+    pageship_failure = (i == 1) ? MDBX_EIO : MDBX_SUCCESS;
+    txn.commit();
+    ok = ok && mdbx_env_get_pageship_status(env) == pageship_failure;
+  }
+  pageship_failure = MDBX_SUCCESS;
+  ok = ok && pageship_deltas == 2 && mdbx_env_set_pageship(env, nullptr) == MDBX_SUCCESS;
+
+  const int fd = open(stream_path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+  ok = ok && fd >= 0 && write(fd, pageship_stream.data(), pageship_stream.size()) == ssize_t(pageship_stream.size()) &&
+       lseek(fd, 0, SEEK_SET) == 0;
+
+  mdbx::env::operate_parameters operateParameters(100, 10);
+  /* allows to follow while a reader is active in this thread */
+  operateParameters.options.no_sticky_threads = true;
+  mdbx::env_managed follower(follower_path, operateParameters);
+  /* a reader of the current snapshot isn't disturbed by the next delta */
+  auto rtxn = follower.start_read();
+  auto rmap = rtxn.open_map("xyz");
+  ok = ok && mdbx_env_follow(follower, fd) == MDBX_SUCCESS && rtxn.get(rmap, key) == val0;
+  /* but a reader of an older snapshot blocks the follower */
+  ok = ok && mdbx_env_follow(follower, fd) == MDBX_BUSY && rtxn.get(rmap, key) == val0;
+  rtxn.abort();
+  int err;
+  while ((err = mdbx_env_follow(follower, fd)) == MDBX_SUCCESS)
+    ;
+  ok = ok && err == MDBX_ENODATA;
+  if (fd >= 0)
+    close(fd);
+
+  rtxn = follower.start_read();
+  ok = ok && rtxn.id() == env.start_read().id() && rtxn.get(rmap, key) == mdbx::slice::wrap(size_t(2));
+  for (size_t n = 0; n < 1000; ++n)
+    ok = ok && rtxn.get(rmap, mdbx::slice::wrap(n)) == mdbx::slice::wrap(size_t(2));
+  rtxn.abort();
+  unlink(stream_path.c_str());
+  return ok;
+}
+#endif /* Windows */
+
 int doit() {
   mdbx::path path = "test-txn";
   mdbx::env::remove(path);
@@ -378,6 +589,12 @@ int doit() {
   ok = case2(path, true) && ok;
   ok = case3(path, false) && ok;
   ok = case3(path, true) && ok;
+  ok = case4(path, false) && ok;
+  ok = case4(path, true) && ok;
+  ok = case5(path) && ok;
+#if !defined(_WIN32) && !defined(_WIN64)
+  ok = case6(path) && ok;
+#endif /* Windows */
 
   std::cout << (ok ? "OK\n" : "FAIL\n");
   return ok ? EXIT_SUCCESS : EXIT_FAILURE;
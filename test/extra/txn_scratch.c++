@@ -0,0 +1,90 @@
+/// \author Леонид Юрьев aka Leonid Yuriev <leo@yuriev.ru> \date 2025
+/// \copyright SPDX-License-Identifier: Apache-2.0
+
+#include "mdbx.h++"
+#include <iostream>
+#include <string>
+
+#if defined(__cpp_lib_memory_resource) && __cpp_lib_memory_resource >= 201603L && _GLIBCXX_USE_CXX11_ABI
+
+class counting_resource : public std::pmr::memory_resource {
+  std::pmr::memory_resource *const upstream_ = std::pmr::new_delete_resource();
+
+public:
+  size_t allocations = 0, outstanding = 0;
+
+private:
+  void *do_allocate(size_t bytes, size_t alignment) override {
+    ++allocations;
+    outstanding += bytes;
+    return upstream_->allocate(bytes, alignment);
+  }
+  void do_deallocate(void *ptr, size_t bytes, size_t alignment) override {
+    outstanding -= bytes;
+    upstream_->deallocate(ptr, bytes, alignment);
+  }
+  bool do_is_equal(const std::pmr::memory_resource &other) const noexcept override { return this == &other; }
+};
+
+static bool doit() {
+  mdbx::path db_filename = "test-txn-scratch";
+  mdbx::env::remove(db_filename);
+  mdbx::env_managed env(db_filename, mdbx::env_managed::create_parameters(), mdbx::env::operate_parameters(3));
+
+  auto txn = env.start_write();
+  auto map = txn.create_map("scratch");
+  for (unsigned i = 0; i < 100; ++i)
+    txn.insert(map, mdbx::pair(mdbx::slice(std::to_string(i)), mdbx::slice(std::string(100 + i, 'x'))));
+  txn.commit();
+
+  counting_resource counter;
+  std::pmr::memory_resource *const previous = std::pmr::set_default_resource(&counter);
+  txn = env.start_read();
+  if (counter.allocations != 0) {
+    std::cerr << "unexpected allocations before using the arena\n";
+    return false;
+  }
+
+  size_t total = 0;
+  for (unsigned i = 0; i < 100; ++i) {
+    const auto key = mdbx::default_buffer::key_from(std::to_string(i), false, txn.scratch_allocator());
+    const auto value = mdbx::default_buffer(txn.get(map, key), txn.scratch_allocator());
+    const auto hex = value.encode_hex(false, 0, txn.scratch_allocator());
+    total += key.length() + value.length() + hex.length();
+  }
+  if (total < 100 * 300 || counter.allocations > 8) {
+    std::cerr << "unexpected " << counter.allocations << " allocations for " << total << " bytes\n";
+    return false;
+  }
+
+  auto moved = std::move(txn);
+  moved.commit_embark_read();
+  if (counter.outstanding != 0) {
+    std::cerr << "the arena is not released at the end of transaction\n";
+    return false;
+  }
+  const auto copy = mdbx::default_buffer(moved.get(map, mdbx::slice("42")), moved.scratch_allocator());
+  moved.abort();
+  std::pmr::set_default_resource(previous);
+  return copy.length() == 142 && counter.outstanding == 0;
+}
+
+#else
+
+static bool doit() {
+  std::cout << "skipped since std::pmr is not available\n";
+  return true;
+}
+
+#endif /* __cpp_lib_memory_resource >= 201603L */
+
+int main(int argc, char *argv[]) {
+  (void)argc;
+  (void)argv;
+  try {
+    return doit() ? EXIT_SUCCESS : EXIT_FAILURE;
+  } catch (const std::exception &ex) {
+    std::cerr << "Exception: " << ex.what() << "\n";
+    return EXIT_FAILURE;
+  }
+}
@@ -0,0 +1,220 @@
+/// \author Леонид Юрьев aka Leonid Yuriev <leo@yuriev.ru> \date 2025
+/// \copyright SPDX-License-Identifier: Apache-2.0
+
+#include "mdbx.h++"
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <map>
+#include <string>
+#include <vector>
+
+struct point {
+  int32_t x, y;
+  double weight;
+};
+
+enum class color : uint8_t { red = 1, green = 2, blue = 3 };
+
+using numbers_t = mdbx::table<int64_t, double>;
+using samples_t = mdbx::multi_table<uint16_t, float>;
+using points_t = mdbx::table<std::string, point>;
+using palette_t = mdbx::table<color, mdbx::slice>;
+
+#if defined(__cpp_constexpr) && __cpp_constexpr >= 201304L
+static_assert(numbers_t::keys() == mdbx::key_mode::ordinal, "int64_t keys must be ordinal");
+static_assert(numbers_t::values() == mdbx::value_mode::single, "single-value table expected");
+static_assert(samples_t::values() == mdbx::value_mode::multi_ordinal, "float values must be ordinal");
+static_assert(points_t::keys() == mdbx::key_mode::usual, "string keys must be usual");
+static_assert(mdbx::multi_table<int, point>::values() == mdbx::value_mode::multi_samelength,
+              "trivially copyable values must be same-length");
+static_assert(palette_t::keys() == mdbx::key_mode::ordinal, "enum keys must be ordinal");
+static_assert(mdbx::key_transform::from_int64(-1) < mdbx::key_transform::from_int64(0) &&
+                  mdbx::key_transform::from_int32(INT32_MAX) > mdbx::key_transform::from_int32(INT32_MIN),
+              "order must be preserved");
+#endif /* __cpp_constexpr >= 201304L */
+#if defined(__cpp_lib_bit_cast) && __cpp_lib_bit_cast >= 201806L
+static_assert(mdbx::key_transform::from_double(-1.5) < mdbx::key_transform::from_double(-0.5) &&
+                  mdbx::key_transform::from_double(0.0) < mdbx::key_transform::from_double(1e-300),
+              "order must be preserved");
+static_assert(mdbx::key_transform::to_double(mdbx::key_transform::from_double(-42.25)) == -42.25,
+              "must be reversible");
+#endif /* __cpp_lib_bit_cast */
+#if defined(__cpp_lib_ranges) && __cpp_lib_ranges >= 201911L
+static_assert(std::ranges::input_range<numbers_t::range> && std::ranges::view<numbers_t::range>,
+              "typed range must be an input range and a view");
+#endif /* __cpp_lib_ranges */
+
+static bool check_transforms() {
+  static const double doubles[] = {0.0,
+                                   -0.0,
+                                   1.0,
+                                   -1.0,
+                                   3.14159,
+                                   -2.71828e100,
+                                   std::numeric_limits<double>::min(),
+                                   std::numeric_limits<double>::max(),
+                                   -std::numeric_limits<double>::infinity(),
+                                   std::numeric_limits<double>::infinity()};
+  for (const double value : doubles) {
+    const double back = mdbx::key_transform::to_double(mdbx_key_from_double(value));
+    if (mdbx::key_transform::from_double(value) != mdbx_key_from_double(value) ||
+        mdbx::key_transform::from_float(float(value)) != mdbx_key_from_float(float(value)) ||
+        std::memcmp(&value, &back, sizeof(double)) != 0) {
+      std::cerr << "transform: mismatch for " << value << "\n";
+      return false;
+    }
+  }
+
+  static const int64_t integers[] = {0,
+                                     1,
+                                     -1,
+                                     42,
+                                     -4242,
+                                     INT64_C(9007199254740993),
+                                     -INT64_C(9007199254740993),
+                                     INT64_C(0x7ffffffffffffe00),
+                                     INT64_MAX,
+                                     INT64_MIN + 1,
+                                     INT64_MIN};
+  for (const int64_t value : integers) {
+    const uint64_t key = mdbx::key_transform::from_json_integer(value);
+    const uint64_t reference = mdbx_key_from_jsonInteger(value);
+    MDBX_val val = {const_cast<uint64_t *>(&key), sizeof(key)};
+    /* the mdbx_jsonInteger_from_key() saturates the key of zero */
+    if (key != reference ||
+        mdbx::key_transform::to_json_integer(key) != (value ? mdbx_jsonInteger_from_key(val) : value) ||
+        mdbx::key_transform::from_int64(value) != mdbx_key_from_int64(value)) {
+      std::cerr << "transform: mismatch for integer " << value << "\n";
+      return false;
+    }
+  }
+  return true;
+}
+
+static bool doit() {
+  mdbx::path db_filename = "test-typed-table";
+  mdbx::env::remove(db_filename);
+  mdbx::env_managed env(db_filename, mdbx::env_managed::create_parameters(), mdbx::env::operate_parameters(8));
+
+  auto txn = env.start_write();
+  auto numbers = numbers_t::create(txn, "numbers");
+  auto samples = samples_t::create(txn, "samples");
+  auto points = points_t::create(txn, "points");
+  auto palette = palette_t::create(txn, "palette");
+
+  std::map<int64_t, double> numbers_ref;
+  for (int64_t i = -500; i < 500; ++i) {
+    const int64_t key = i * 1000003;
+    numbers.insert(txn, key, double(i) / 7);
+    numbers_ref[key] = double(i) / 7;
+  }
+  for (uint16_t key = 0; key < 100; ++key)
+    for (int j = -3; j <= 3; ++j)
+      samples.upsert(txn, key, float(j) * 0.5f + float(key));
+  for (int i = 0; i < 100; ++i)
+    points.insert(txn, "p" + std::to_string(i), point{i, -i, i * 0.25});
+  palette.insert(txn, color::blue, mdbx::slice("blue"));
+  palette.insert(txn, color::red, mdbx::slice("red"));
+  palette.insert(txn, color::green, mdbx::slice("green"));
+  if (numbers.try_insert(txn, 0, 42.0) || !numbers.try_update(txn, 0, 0.0) || numbers.try_update(txn, 1, 1.0)) {
+    std::cerr << "numbers: unexpected try_insert/try_update results\n";
+    return false;
+  }
+  txn.commit();
+
+  txn = env.start_read();
+  numbers = numbers_t::open(txn, "numbers");
+  if (numbers.size(txn) != numbers_ref.size() || numbers.get(txn, -1000003) != -1.0 / 7 ||
+      numbers.get(txn, 1, -1.0) != -1.0 || !numbers.contains(txn, 499 * INT64_C(1000003))) {
+    std::cerr << "numbers: unexpected get/contains results\n";
+    return false;
+  }
+
+  auto expected = numbers_ref.begin();
+  for (const auto &pair : numbers.scan(txn)) {
+    if (expected == numbers_ref.end() || pair.first != expected->first || pair.second != expected->second) {
+      std::cerr << "numbers: unexpected pair {" << pair.first << ", " << pair.second << "}\n";
+      return false;
+    }
+    ++expected;
+  }
+  if (expected != numbers_ref.end()) {
+    std::cerr << "numbers: scan is incomplete\n";
+    return false;
+  }
+
+  std::vector<int64_t> keys;
+  for (const auto &pair : numbers.scan(txn, -3 * INT64_C(1000003), 2 * INT64_C(1000003), true))
+    keys.push_back(pair.first);
+  if (keys != std::vector<int64_t>{1000003, 0, -1000003, -2 * INT64_C(1000003), -3 * INT64_C(1000003)}) {
+    std::cerr << "numbers: unexpected backward scan\n";
+    return false;
+  }
+  size_t tail = 0;
+  auto from = numbers.scan_from(txn, 490 * INT64_C(1000003) - 1);
+  auto moved = std::move(from);
+  for (auto it = moved.begin(); it != moved.end(); ++it)
+    ++tail;
+  if (tail != 10) {
+    std::cerr << "numbers: unexpected scan_from tail " << tail << "\n";
+    return false;
+  }
+
+  uint16_t previous_key = 0;
+  float previous = -1;
+  size_t count = 0;
+  for (const auto &pair : samples.scan(txn, 7, 9)) {
+    if ((pair.first == previous_key && pair.second <= previous) || pair.first < 7 || pair.first > 8) {
+      std::cerr << "samples: unexpected pair {" << pair.first << ", " << pair.second << "}\n";
+      return false;
+    }
+    previous_key = pair.first;
+    previous = pair.second;
+    ++count;
+  }
+  if (count != 14 || samples.get(txn, 42) != 40.5f) {
+    std::cerr << "samples: unexpected " << count << " values\n";
+    return false;
+  }
+
+  const mdbx::pod_view<point> p = points.get(txn, "p42");
+  const point copy = p;
+  if (copy.x != 42 || copy.y != -42 || copy.weight != 10.5 || (p.is_aligned() && p.address()->x != 42)) {
+    std::cerr << "points: unexpected point\n";
+    return false;
+  }
+
+  std::string names;
+  for (const auto &pair : palette.scan(txn))
+    names += pair.second.as_string() + ",";
+  if (names != "red,green,blue,") {
+    std::cerr << "palette: unexpected order " << names << "\n";
+    return false;
+  }
+
+  bool incompatible = false;
+  try {
+    numbers_t::open(txn, "points");
+  } catch (const mdbx::incompatible_operation &) {
+    incompatible = true;
+  }
+  if (!incompatible) {
+    std::cerr << "points: opening with mismatched key type must fail\n";
+    return false;
+  }
+
+  txn.abort();
+  return true;
+}
+
+int main(int argc, char *argv[]) {
+  (void)argc;
+  (void)argv;
+  try {
+    return check_transforms() && doit() ? EXIT_SUCCESS : EXIT_FAILURE;
+  } catch (const std::exception &ex) {
+    std::cerr << "Exception: " << ex.what() << "\n";
+    return EXIT_FAILURE;
+  }
+}
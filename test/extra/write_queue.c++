@@ -0,0 +1,129 @@
+/// \author Леонид Юрьев aka Leonid Yuriev <leo@yuriev.ru> \date 2025
+/// \copyright SPDX-License-Identifier: Apache-2.0
+
+#include "mdbx.h++"
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#if defined(__cpp_lib_coroutine) && __cpp_lib_coroutine >= 201902L
+/* a minimal eager fire-and-forget coroutine */
+struct detached {
+  struct promise_type {
+    detached get_return_object() noexcept { return {}; }
+    std::suspend_never initial_suspend() noexcept { return {}; }
+    std::suspend_never final_suspend() noexcept { return {}; }
+    void return_void() noexcept {}
+    void unhandled_exception() noexcept { std::terminate(); }
+  };
+};
+
+static detached coroutine(mdbx::write_queue &queue, mdbx::map_handle map, std::promise<std::string> &done) {
+  const auto count = co_await queue.async_write([map](mdbx::txn &txn) {
+    txn.upsert(map, mdbx::slice("coroutine"), mdbx::slice("done"));
+    return txn.get_map_stat(map).ms_entries;
+  });
+  std::string outcome = "entries " + std::to_string(count);
+  try {
+    co_await queue.async_write([](mdbx::txn &) { throw std::runtime_error("expected"); });
+    outcome += ", no exception";
+  } catch (const std::runtime_error &) {
+    outcome += ", exception";
+  }
+  done.set_value(outcome);
+}
+#endif /* __cpp_lib_coroutine */
+
+static bool doit() {
+  mdbx::path db_filename = "test-write-queue";
+  mdbx::env::remove(db_filename);
+  mdbx::env_managed env(db_filename, mdbx::env_managed::create_parameters(), mdbx::env::operate_parameters(3));
+
+  mdbx::map_handle map;
+  {
+    auto txn = env.start_write();
+    map = txn.create_map("queue");
+    txn.commit();
+  }
+
+  const auto txnid_before = env.get_info().mi_recent_txnid;
+  std::vector<std::future<bool>> futures;
+  {
+    mdbx::write_queue queue(env, mdbx::write_queue::options(64));
+
+    /* holds the writer thread until all closures are queued to check the group commit */
+    std::promise<void> gate;
+    auto opened = gate.get_future().share();
+    auto first = queue.write([opened](mdbx::txn &) { opened.wait(); });
+
+    for (unsigned i = 0; i < 1000; ++i)
+      futures.push_back(queue.write([map, i](mdbx::txn &txn) {
+        if (i % 100 == 42)
+          throw std::runtime_error("expected");
+        const std::string key = "k" + std::to_string(i);
+        return txn.try_insert(map, mdbx::slice(key), mdbx::slice(key)).done;
+      }));
+    gate.set_value();
+    first.get();
+
+    size_t failures = 0;
+    for (auto &future : futures)
+      try {
+        if (!future.get()) {
+          std::cerr << "unexpected result\n";
+          return false;
+        }
+      } catch (const std::runtime_error &) {
+        ++failures;
+      }
+    if (failures != 10) {
+      std::cerr << "unexpected " << failures << " failures\n";
+      return false;
+    }
+
+#if defined(__cpp_lib_coroutine) && __cpp_lib_coroutine >= 201902L
+    std::promise<std::string> done;
+    coroutine(queue, map, done);
+    const std::string outcome = done.get_future().get();
+    if (outcome != "entries 991, exception") {
+      std::cerr << "coroutine: unexpected " << outcome << "\n";
+      return false;
+    }
+#endif /* __cpp_lib_coroutine */
+  }
+
+  const auto commits = env.get_info().mi_recent_txnid - txnid_before;
+  if (commits > 100) {
+    std::cerr << "too many commits " << commits << " for group commit\n";
+    return false;
+  }
+
+  auto txn = env.start_read();
+  if (txn.get_map_stat(map).ms_entries < 990) {
+    std::cerr << "unexpected number of entries\n";
+    return false;
+  }
+  txn.abort();
+
+  mdbx::write_queue stopped(env);
+  stopped.stop();
+  try {
+    stopped.write([](mdbx::txn &) {}).get();
+    std::cerr << "stopped queue must reject closures\n";
+    return false;
+  } catch (const mdbx::exception &) {
+  }
+  return true;
+}
+
+int main(int argc, char *argv[]) {
+  (void)argc;
+  (void)argv;
+  try {
+    return doit() ? EXIT_SUCCESS : EXIT_FAILURE;
+  } catch (const std::exception &ex) {
+    std::cerr << "Exception: " << ex.what() << "\n";
+    return EXIT_FAILURE;
+  }
+}
@@ -251,6 +251,36 @@ bool maker::is_unordered() const {
 
 void maker::seek2end(serial_t &serial) const { serial = actor_params::serial_mask(mapping.width) - 1; }
 
+distribution maker::access(serial_t items) const {
+  distribution::params params;
+  switch (mapping.keycase) {
+  default:
+    params.what = distribution::uniform;
+    break;
+  case kc_zipfian:
+    params.what = distribution::zipfian;
+    break;
+  case kc_hotspot:
+    params.what = distribution::hotspot;
+    break;
+  case kc_sequential:
+    params.what = distribution::sequential;
+    break;
+  case kc_latest:
+    params.what = distribution::latest;
+    break;
+  case kc_prefix:
+    params.what = distribution::prefix;
+    break;
+  }
+  params.theta = mapping.skew / 100.0;
+  params.hot_ops = mapping.hot_ops / 100.0;
+  params.hot_items = mapping.hot_keys / 100.0;
+  params.jitter = mapping.jitter;
+  params.prefixes = mapping.prefixes;
+  return distribution(params, items);
+}
+
 bool maker::increment(serial_t &serial, int64_t delta) const {
   if (serial > actor_params::serial_mask(mapping.width)) {
     log_extra("keygen-increment: %" PRIu64 " > %" PRIu64 ", overflow", serial,
@@ -5,6 +5,7 @@
 
 #include "base.h++"
 #include "config.h++"
+#include "distribution.h++"
 #include "log.h++"
 #include "utils.h++"
 
@@ -110,6 +111,9 @@ public:
   void seek2end(serial_t &serial) const;
 
   bool increment(serial_t &serial, int64_t delta) const;
+  /* Распределение для выбора номеров уже существующих записей [0, items)
+   * согласно keycase, т.е. для kc_random и kc_dashes равномерное. */
+  distribution access(serial_t items) const;
   bool increment_key_part(serial_t &serial, int64_t delta, bool reset_value_part = true) const {
     if (reset_value_part) {
       serial_t value_part_bits = ((serial_t(1) << mapping.split) - 1);
@@ -0,0 +1,231 @@
+/// \author Леонид Юрьев aka Leonid Yuriev <leo@yuriev.ru> \date 2025
+/// \copyright SPDX-License-Identifier: Apache-2.0
+
+#include "latency.h++"
+#include "test.h++"
+
+namespace latency {
+
+slot *current;
+
+const char *op2str(op kind) {
+  switch (kind) {
+  case op_begin_ro:
+    return "begin.ro";
+  case op_begin_rw:
+    return "begin.rw";
+  case op_get:
+    return "get";
+  case op_put:
+    return "put";
+  case op_del:
+    return "del";
+  case op_commit:
+    return "commit";
+  case op_abort:
+    return "abort";
+  case op_commit_preparation:
+    return "commit.prep";
+  case op_commit_gc:
+    return "commit.gc";
+  case op_commit_audit:
+    return "commit.audit";
+  case op_commit_write:
+    return "commit.write";
+  case op_commit_sync:
+    return "commit.sync";
+  case op_commit_ending:
+    return "commit.end";
+  default:
+    return "?";
+  }
+}
+
+//-----------------------------------------------------------------------------
+
+static unsigned msb(uint64_t value) {
+  assert(value != 0);
+  unsigned result = 0;
+  for (unsigned shift = 32; shift; shift >>= 1)
+    if (value >> shift) {
+      value >>= shift;
+      result += shift;
+    }
+  return result;
+}
+
+unsigned histogram::index(uint64_t value) {
+  if (value < (2u << sub_bits))
+    return unsigned(value);
+  const unsigned shift = msb(value) - sub_bits;
+  return (shift << sub_bits) + unsigned(value >> shift);
+}
+
+uint64_t histogram::highest(unsigned index) {
+  if (index < (2u << sub_bits))
+    return index;
+  const unsigned shift = (index >> sub_bits) - 1;
+  const uint64_t mantissa = (index & ((1u << sub_bits) - 1)) + (1u << sub_bits);
+  return ((mantissa + 1) << shift) - 1;
+}
+
+void histogram::merge(const histogram &other) {
+  if (other.count == 0)
+    return;
+  if (count == 0 || min > other.min)
+    min = other.min;
+  if (max < other.max)
+    max = other.max;
+  count += other.count;
+  total += other.total;
+  for (unsigned i = 0; i < buckets; ++i)
+    bucket[i] += other.bucket[i];
+}
+
+uint64_t histogram::percentile(double percent) const {
+  if (count == 0)
+    return 0;
+  const uint64_t target = std::max(uint64_t(1), uint64_t(double(count) * percent / 100.0 + 0.5));
+  uint64_t accumulated = 0;
+  for (unsigned i = 0; i < buckets; ++i) {
+    accumulated += bucket[i];
+    if (accumulated >= target)
+      return std::max(min, std::min(max, highest(i)));
+  }
+  return max;
+}
+
+//-----------------------------------------------------------------------------
+
+uint64_t now_ns() {
+  const chrono::time now = chrono::now_monotonic();
+  return now.integer * UINT64_C(1000000000) + chrono::fractional2ns(now.fractional);
+}
+
+size_t area_size(size_t actors) { return sizeof(slot) * (actors + 1); }
+
+void setup(size_t actors) {
+  log_trace(">> latency::setup(%zu)", actors);
+  void *area = osal_stats_create(area_size(actors));
+  log_trace("<< latency::setup: %p", area);
+}
+
+void attach(unsigned actor_id) {
+  slot *area = static_cast<slot *>(osal_stats_area());
+  current = area ? area + actor_id : nullptr;
+}
+
+void started() {
+  if (current)
+    current->started_ns = now_ns();
+}
+
+void finished() {
+  if (current)
+    current->finished_ns = now_ns();
+}
+
+void commit_phases(const MDBX_commit_latency &phases) {
+  if (!current)
+    return;
+  /* в MDBX_commit_latency длительности в 1/65536 долях секунды */
+  const auto add = [](op kind, uint32_t value) {
+    current->ops[kind].add((uint64_t(value) * UINT64_C(1000000000)) >> 16);
+  };
+  add(op_commit_preparation, phases.preparation);
+  add(op_commit_gc, phases.gc_wallclock);
+  add(op_commit_audit, phases.audit);
+  add(op_commit_write, phases.write);
+  add(op_commit_sync, phases.sync);
+  add(op_commit_ending, phases.ending);
+}
+
+//-----------------------------------------------------------------------------
+
+static const double percentiles[] = {50, 90, 99, 99.9};
+
+static double rate(uint64_t count, uint64_t elapsed_ns) {
+  return elapsed_ns ? double(count) * 1e9 / double(elapsed_ns) : 0.0;
+}
+
+static void json_ops(FILE *out, const slot &item, uint64_t elapsed_ns) {
+  bool first = true;
+  for (unsigned i = 0; i < op_count; ++i) {
+    const histogram &h = item.ops[i];
+    if (h.count == 0)
+      continue;
+    fprintf(out,
+            "%s\n      \"%s\": {\"count\": %" PRIu64 ", \"min\": %" PRIu64 ", \"mean\": %.1f, \"p50\": %" PRIu64
+            ", \"p90\": %" PRIu64 ", \"p99\": %" PRIu64 ", \"p999\": %" PRIu64 ", \"max\": %" PRIu64
+            ", \"ops_per_sec\": %.1f}",
+            first ? "" : ",", op2str(op(i)), h.count, h.min, h.mean(), h.percentile(50), h.percentile(90),
+            h.percentile(99), h.percentile(99.9), h.max, rate(h.count, elapsed_ns));
+    first = false;
+  }
+}
+
+static void json_report(const std::string &pathname, const std::vector<actor_config> &actors, const slot *area,
+                        const slot &aggregate, uint64_t elapsed_ns) {
+  FILE *out = fopen(pathname.c_str(), "w");
+  if (!out)
+    failure_perror(pathname.c_str(), errno);
+
+  fprintf(out, "{\n  \"units\": \"ns\",\n  \"elapsed_ns\": %" PRIu64 ",\n  \"aggregate\": {", elapsed_ns);
+  json_ops(out, aggregate, elapsed_ns);
+  fprintf(out, "\n  },\n  \"actors\": [");
+  bool first = true;
+  for (const auto &actor : actors) {
+    const slot &item = area[actor.actor_id];
+    const uint64_t spent = (item.finished_ns > item.started_ns) ? item.finished_ns - item.started_ns : 0;
+    fprintf(out,
+            "%s\n    {\"actor_id\": %u, \"space_id\": %u, \"testcase\": \"%s\", \"elapsed_ns\": %" PRIu64
+            ",\n     \"ops\": {",
+            first ? "" : ",", actor.actor_id, actor.space_id, testcase2str(actor.testcase), spent);
+    json_ops(out, item, spent);
+    fprintf(out, "\n    }}");
+    first = false;
+  }
+  fprintf(out, "\n  ]\n}\n");
+
+  if (fclose(out))
+    failure_perror(pathname.c_str(), errno);
+  log_notice("latency: JSON saved to %s", pathname.c_str());
+}
+
+void report(const std::vector<actor_config> &actors, const std::string &json_pathname) {
+  const slot *area = static_cast<const slot *>(osal_stats_area());
+  if (!area)
+    return;
+
+  std::unique_ptr<slot> aggregate(new slot());
+  uint64_t started = UINT64_MAX, finished = 0;
+  for (const auto &actor : actors) {
+    const slot &item = area[actor.actor_id];
+    if (item.started_ns == 0)
+      continue;
+    started = std::min(started, item.started_ns);
+    finished = std::max(finished, item.finished_ns);
+    for (unsigned i = 0; i < op_count; ++i)
+      aggregate->ops[i].merge(item.ops[i]);
+  }
+  const uint64_t elapsed_ns = (finished > started) ? finished - started : 0;
+
+  log_notice("latency: %u actor(s), %.3f seconds, values in microseconds", unsigned(actors.size()), elapsed_ns * 1e-9);
+  log_notice("%-12s %10s %9s %9s %9s %9s %9s %9s %11s", "operation", "count", "min", "p50", "p90", "p99", "p99.9",
+             "max", "ops/s");
+  for (unsigned i = 0; i < op_count; ++i) {
+    const histogram &h = aggregate->ops[i];
+    if (h.count == 0)
+      continue;
+    double values[sizeof(percentiles) / sizeof(percentiles[0])];
+    for (size_t n = 0; n < sizeof(percentiles) / sizeof(percentiles[0]); ++n)
+      values[n] = h.percentile(percentiles[n]) * 1e-3;
+    log_notice("%-12s %10" PRIu64 " %9.1f %9.1f %9.1f %9.1f %9.1f %9.1f %11.1f", op2str(op(i)), h.count, h.min * 1e-3,
+               values[0], values[1], values[2], values[3], h.max * 1e-3, rate(h.count, elapsed_ns));
+  }
+
+  if (!json_pathname.empty())
+    json_report(json_pathname, actors, area, *aggregate, elapsed_ns);
+}
+
+} /* namespace latency */
@@ -0,0 +1,102 @@
+/// \author Леонид Юрьев aka Leonid Yuriev <leo@yuriev.ru> \date 2025
+/// \copyright SPDX-License-Identifier: Apache-2.0
+
+#pragma once
+
+#include "base.h++"
+#include "config.h++"
+
+namespace latency {
+
+/* Замер длительности операций тестовых акторов.
+ *
+ * Каждый актор накапливает HDR-подобные (логарифмически-линейные)
+ * гистограммы длительностей операций в своём слоте разделяемой области,
+ * которая создаётся "оверлордом" до запуска акторов посредством
+ * osal_stats_create() и наследуется процессами акторов. По завершению всех
+ * акторов "оверлорд" сливает гистограммы, выводит сводную таблицу и при
+ * необходимости сохраняет результаты в JSON.
+ *
+ * Слоты не требуют синхронизации, так как каждый актор пишет только в свой,
+ * а читаются они только после завершения всех процессов. */
+
+enum op : unsigned {
+  op_begin_ro,
+  op_begin_rw,
+  op_get,
+  op_put,
+  op_del,
+  op_commit,
+  op_abort,
+  /* фазы фиксации из MDBX_commit_latency */
+  op_commit_preparation,
+  op_commit_gc,
+  op_commit_audit,
+  op_commit_write,
+  op_commit_sync,
+  op_commit_ending,
+  op_count
+};
+
+const char *op2str(op kind);
+
+struct histogram {
+  /* Значения меньшие 2^(sub_bits+1) учитываются точно, а для бОльших
+   * сохраняются sub_bits значащих бит после старшего, т.е. относительная
+   * погрешность не превышает 1/16. */
+  enum : unsigned { sub_bits = 4, buckets = (65 - sub_bits) << sub_bits };
+
+  uint64_t count, total, min, max;
+  uint64_t bucket[buckets];
+
+  static unsigned index(uint64_t value);
+  static uint64_t highest(unsigned index);
+
+  void add(uint64_t value) {
+    if (count == 0 || min > value)
+      min = value;
+    if (max < value)
+      max = value;
+    count += 1;
+    total += value;
+    bucket[index(value)] += 1;
+  }
+
+  void merge(const histogram &other);
+  uint64_t percentile(double percent) const;
+  double mean() const { return count ? double(total) / double(count) : 0.0; }
+};
+
+struct slot {
+  uint64_t started_ns, finished_ns;
+  histogram ops[op_count];
+};
+
+extern slot *current;
+
+uint64_t now_ns();
+size_t area_size(size_t actors);
+
+/* Вызывается "оверлордом" перед запуском акторов. */
+void setup(size_t actors);
+/* Вызывается актором для привязки к своему слоту. */
+void attach(unsigned actor_id);
+void started();
+void finished();
+/* Сводка по завершению всех акторов. */
+void report(const std::vector<actor_config> &actors, const std::string &json_pathname);
+
+class probe {
+  uint64_t start_;
+
+public:
+  probe() : start_(current ? now_ns() : 0) {}
+  void done(op kind) const {
+    if (current)
+      current->ops[kind].add(now_ns() - start_);
+  }
+};
+
+void commit_phases(const MDBX_commit_latency &phases);
+
+} /* namespace latency */
@@ -15,7 +15,7 @@ MDBX_NORETURN void usage(void) {
        "  --loglevel=[0-7]|[fatal..extra]s"
        "  --pathname=...            Path and/or name of database files\n"
        "  --repeat=N                Set repeat counter\n"
-       "  --threads=N               Number of thread (unsupported for now)\n"
+       "  --threads=N               Number of threads (readers for --readscale)\n"
        "  --timeout=N[s|m|h|d]      Set timeout in seconds/minutes/hours/days\n"
        "  --failfast[=YES/no]       Lill all actors on first failure/error\n"
        "  --max-readers=N           See mdbx_env_set_maxreaders() description\n"
@@ -26,6 +26,8 @@ MDBX_NORETURN void usage(void) {
        "  --cleanup-before[=YES/no] Cleanup/remove and re-create database\n"
        "  --cleanup-after[=YES/no]  Cleanup/remove database after completion\n"
        "  --prng-seed=N             Seed PRNG\n"
+       "  --latency[=yes/NO]        Measure latency of operations\n"
+       "  --latency-json=FILE       Also save latency histograms to FILE\n"
        "Database size control:\n"
        "  --pagesize=...            Database page size: min, max, 256..65536\n"
        "  --size-lower=N[K|M|G|T]   Lower-bound of size in Kb/Mb/Gb/Tb\n"
@@ -47,6 +49,8 @@ MDBX_NORETURN void usage(void) {
        "  --try                         Try write-transaction, no more\n"
        "  --copy                        Online copy/backup\n"
        "  --append                      Append-mode insertions\n"
+       "  --readscale                   Read scalability with 1..N readers\n"
+       "                                against a concurrent writer\n"
        "  --dead.reader                 Dead-reader simulator\n"
        "  --dead.writer                 Dead-writer simulator\n"
 #if !defined(_WIN32) && !defined(_WIN64)
@@ -81,7 +85,13 @@ MDBX_NORETURN void usage(void) {
        "  --keygen.split=N              TBD (see the source code)\n"
        "  --keygen.rotate=N             TBD (see the source code)\n"
        "  --keygen.offset=N             TBD (see the source code)\n"
-       "  --keygen.case=random          Generator case (only `random` for now)\n"
+       "  --keygen.case=NAME            Generator case: random, dashes, zipfian,\n"
+       "                                hotspot, sequential, latest or prefix\n"
+       "  --keygen.skew=N               Skew for zipfian/latest/prefix, percents\n"
+       "  --keygen.hot-ops=N            Percent of operations for hotspot\n"
+       "  --keygen.hot-keys=N           Percent of hot keys for hotspot\n"
+       "  --keygen.jitter=N             Jitter for sequential\n"
+       "  --keygen.prefixes=N           Number of key prefixes for prefix\n"
        "Database operation mode:\n"
        "  --mode={[+-]FLAG}[,[+-]FLAG]...\n"
        "    nosubdir       == MDBX_NOSUBDIR\n"
@@ -144,6 +154,11 @@ void actor_params::set_defaults(const std::string &tmpdir) {
   keygen.split = keygen.width / 2;
   keygen.rotate = 3;
   keygen.offset = 41;
+  keygen.skew = 99;
+  keygen.hot_ops = 90;
+  keygen.hot_keys = 10;
+  keygen.jitter = 16;
+  keygen.prefixes = 16;
 
   test_duration = 0;
   test_nops = 1000;
@@ -178,6 +193,7 @@ void actor_params::set_defaults(const std::string &tmpdir) {
   global::config::progress_indicator = true;
   global::config::console_mode = osal_istty(STDERR_FILENO);
   global::config::geometry_jitter = true;
+  global::config::latency = false;
 }
 
 namespace global {
@@ -200,6 +216,8 @@ bool failfast;
 bool progress_indicator;
 bool console_mode;
 bool geometry_jitter;
+bool latency;
+std::string latency_json;
 } /* namespace config */
 
 } /* namespace global */
@@ -303,6 +321,12 @@ int main(int argc, char *const argv[]) {
       continue;
     if (config::parse_option(argc, argv, narg, "geometry-jitter", global::config::geometry_jitter))
       continue;
+    if (config::parse_option(argc, argv, narg, "latency-json", global::config::latency_json, false)) {
+      global::config::latency = true;
+      continue;
+    }
+    if (config::parse_option(argc, argv, narg, "latency", global::config::latency))
+      continue;
     if (config::parse_option(argc, argv, narg, "timeout", global::config::timeout_duration_seconds, config::duration,
                              1))
       continue;
@@ -420,6 +444,16 @@ int main(int argc, char *const argv[]) {
       keycase_setup(value, params);
       continue;
     }
+    if (config::parse_option(argc, argv, narg, "keygen.skew", params.keygen.skew, 1, 99))
+      continue;
+    if (config::parse_option(argc, argv, narg, "keygen.hot-ops", params.keygen.hot_ops, 0, 100))
+      continue;
+    if (config::parse_option(argc, argv, narg, "keygen.hot-keys", params.keygen.hot_keys, 1, 100))
+      continue;
+    if (config::parse_option(argc, argv, narg, "keygen.jitter", params.keygen.jitter, config::no_scale, 0))
+      continue;
+    if (config::parse_option(argc, argv, narg, "keygen.prefixes", params.keygen.prefixes, config::no_scale, 1))
+      continue;
     if (config::parse_option(argc, argv, narg, "keylen.min", params.keylen_min,
                              (params.table_flags & MDBX_INTEGERKEY) ? config::intkey : config::no_scale,
                              params.mdbx_keylen_min(), params.mdbx_keylen_max())) {
@@ -542,6 +576,11 @@ int main(int argc, char *const argv[]) {
       configure_actor(last_space_id, ac_nested, value, params);
       continue;
     }
+    if (config::parse_option(argc, argv, narg, "readscale", nullptr)) {
+      fixup4qemu(params);
+      configure_actor(last_space_id, ac_readscale, value, params);
+      continue;
+    }
 #if !defined(_WIN32) && !defined(_WIN64)
     if (config::parse_option(argc, argv, narg, "fork.reader", nullptr)) {
       fixup4qemu(params);
@@ -582,6 +621,8 @@ int main(int argc, char *const argv[]) {
 
   if (global::config::cleanup_before)
     cleanup();
+  if (global::config::latency)
+    latency::setup(global::actors.size());
 
   if (global::actors.size() == 1) {
     logging::setup("main");
@@ -671,6 +712,9 @@ int main(int argc, char *const argv[]) {
       failure_perror("mdbx_preopen_snapinfo()", err);
   }
 
+  if (!failed && global::config::latency)
+    latency::report(global::actors, global::config::latency_json);
+
   log_notice("RESULT: %s\n", failed ? "Failed" : "Successful");
   if (global::config::cleanup_after) {
     if (failed)
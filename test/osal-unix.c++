@@ -19,6 +19,13 @@
 #error "Oops, MDBX_LOCKING is undefined!"
 #endif
 
+#if MDBX_LOCKING == MDBX_LOCKING_FUTEX
+/* futex-блокировки есть только внутри libmdbx, для синхронизации
+ * процессов-актеров используем pthread-примитивы, которые есть в Linux */
+#undef MDBX_LOCKING
+#define MDBX_LOCKING MDBX_LOCKING_POSIX2008
+#endif /* MDBX_LOCKING_FUTEX */
+
 #if defined(__APPLE__) && (MDBX_LOCKING == MDBX_LOCKING_POSIX2001 || MDBX_LOCKING == MDBX_LOCKING_POSIX2008)
 #include "stub/pthread_barrier.c"
 #endif /* __APPLE__ && MDBX_LOCKING >= MDBX_LOCKING_POSIX2001 */
@@ -272,6 +279,20 @@ int osal_waitfor(unsigned id) {
 
 //-----------------------------------------------------------------------------
 
+static void *stats_area;
+
+void *osal_stats_create(size_t bytes) {
+  assert(stats_area == nullptr);
+  stats_area = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_ANONYMOUS, -1, 0);
+  if (MAP_FAILED == stats_area)
+    failure_perror("mmap(stats)", errno);
+  return stats_area;
+}
+
+void *osal_stats_area(void) { return stats_area; }
+
+//-----------------------------------------------------------------------------
+
 const std::string actor_config::osal_serialize(simple_checksum &checksum) const {
   (void)checksum;
   /* not used in workload, but just for testing */
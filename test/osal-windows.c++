@@ -8,6 +8,8 @@
 static std::unordered_map<unsigned, HANDLE> events;
 static HANDLE hBarrierSemaphore, hBarrierEvent;
 static HANDLE hProgressActiveEvent, hProgressPassiveEvent;
+static HANDLE hStatsMapping;
+static void *stats_area;
 
 static int waitstatus2errcode(DWORD result) {
   switch (result) {
@@ -86,6 +88,26 @@ void osal_setup(const std::vector<actor_config> &actors) {
   hProgressPassiveEvent = make_inheritable(hProgressPassiveEvent);
 }
 
+static void *stats_map(void) {
+  void *area = MapViewOfFile(hStatsMapping, FILE_MAP_ALL_ACCESS, 0, 0, 0);
+  if (!area)
+    failure_perror("MapViewOfFile(stats)", GetLastError());
+  return area;
+}
+
+void *osal_stats_create(size_t bytes) {
+  assert(hStatsMapping == 0 && stats_area == nullptr);
+  hStatsMapping =
+      CreateFileMappingW(INVALID_HANDLE_VALUE, NULL, PAGE_READWRITE, DWORD(uint64_t(bytes) >> 32), DWORD(bytes), NULL);
+  if (!hStatsMapping)
+    failure_perror("CreateFileMapping(stats)", GetLastError());
+  hStatsMapping = make_inheritable(hStatsMapping);
+  stats_area = stats_map();
+  return stats_area;
+}
+
+void *osal_stats_area(void) { return stats_area; }
+
 void osal_broadcast(unsigned id) {
   log_trace("osal_broadcast: event %u", id);
   if (!SetEvent(events.at(id)))
@@ -110,6 +132,7 @@ const std::string actor_config::osal_serialize(simple_checksum &checksum) const
   checksum.push(hBarrierEvent);
   checksum.push(hProgressActiveEvent);
   checksum.push(hProgressPassiveEvent);
+  checksum.push(hStatsMapping);
 
   HANDLE hWait = INVALID_HANDLE_VALUE;
   if (wait4id) {
@@ -123,8 +146,8 @@ const std::string actor_config::osal_serialize(simple_checksum &checksum) const
     checksum.push(hSignal);
   }
 
-  return format("%p.%p.%p.%p.%p.%p", hBarrierSemaphore, hBarrierEvent, hWait, hSignal, hProgressActiveEvent,
-                hProgressPassiveEvent);
+  return format("%p.%p.%p.%p.%p.%p.%p", hBarrierSemaphore, hBarrierEvent, hWait, hSignal, hProgressActiveEvent,
+                hProgressPassiveEvent, hStatsMapping);
 }
 
 bool actor_config::osal_deserialize(const char *str, const char *end, simple_checksum &checksum) {
@@ -136,11 +159,12 @@ bool actor_config::osal_deserialize(const char *str, const char *end, simple_che
   assert(hBarrierEvent == 0);
   assert(hProgressActiveEvent == 0);
   assert(hProgressPassiveEvent == 0);
+  assert(hStatsMapping == 0);
   assert(events.empty());
 
   HANDLE hWait, hSignal;
-  if (sscanf_s(copy.c_str(), "%p.%p.%p.%p.%p.%p", &hBarrierSemaphore, &hBarrierEvent, &hWait, &hSignal,
-               &hProgressActiveEvent, &hProgressPassiveEvent) != 6) {
+  if (sscanf_s(copy.c_str(), "%p.%p.%p.%p.%p.%p.%p", &hBarrierSemaphore, &hBarrierEvent, &hWait, &hSignal,
+               &hProgressActiveEvent, &hProgressPassiveEvent, &hStatsMapping) != 7) {
     TRACE("<< osal_deserialize: failed\n");
     return false;
   }
@@ -149,6 +173,9 @@ bool actor_config::osal_deserialize(const char *str, const char *end, simple_che
   checksum.push(hBarrierEvent);
   checksum.push(hProgressActiveEvent);
   checksum.push(hProgressPassiveEvent);
+  checksum.push(hStatsMapping);
+  if (hStatsMapping)
+    stats_area = stats_map();
 
   if (wait4id) {
     checksum.push(hWait);
@@ -15,6 +15,10 @@ void osal_killall_actors(void);
 int osal_actor_poll(mdbx_pid_t &pid, unsigned timeout);
 void osal_wait4barrier(void);
 
+/* Разделяемая между "оверлордом" и акторами область для сбора статистики. */
+void *osal_stats_create(size_t bytes);
+void *osal_stats_area(void);
+
 bool osal_progress_push(bool active);
 bool osal_multiactor_mode(void);
 
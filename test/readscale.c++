@@ -0,0 +1,271 @@
+/// \author Леонид Юрьев aka Leonid Yuriev <leo@yuriev.ru> \date 2025
+/// \copyright SPDX-License-Identifier: Apache-2.0
+
+#include "test.h++"
+#include <atomic>
+#include <thread>
+
+/* Тест масштабируемости чтения:
+ *  - таблица наполняется записями, после чего последовательно для 1, 2, 4
+ *    и далее до N читающих потоков (N задается опцией --threads)
+ *    выполняются точечные поиски и короткие просмотры курсором;
+ *  - одновременно основной поток непрерывно фиксирует небольшие пишущие
+ *    транзакции, обновляющие случайные записи;
+ *  - на каждом шаге замеряется стоимость старта читающих транзакций,
+ *    конкуренция за слоты в таблице читателей (повторы при MDBX_READERS_FULL),
+ *    затраты писателя на просмотр таблицы читателей (посредством
+ *    mdbx_txn_info() с scan_rlt, что аналогично поиску самого старого
+ *    используемого снимка), а также рост GC из-за удерживаемых читателями
+ *    снимков.
+ *
+ * Количество операций (--nops) распределяется между шагами и определяет
+ * количество точечных поисков, а при задании длительности (--duration)
+ * она также поровну делится между шагами. */
+
+class testcase_readscale : public testcase {
+  using inherited = testcase;
+
+  struct reader_stat {
+    latency::histogram begin;
+    uint64_t lookups, scans, full_retries;
+  };
+
+  struct writer_stat {
+    latency::histogram begin, rlt_scan, commit, gc;
+    uint64_t commits, max_lag;
+  };
+
+  enum { scan_length = 16 };
+  uint64_t population{0};
+  std::atomic<bool> stopping{false};
+  std::atomic<unsigned> finished{0};
+
+  void populate();
+  void gc_backlog(size_t &pages, uint64_t &entries);
+  void reader(unsigned number, uint64_t lookups, reader_stat &stat);
+  void writer(unsigned readers, unsigned seconds, writer_stat &stat);
+  void step(unsigned readers, uint64_t lookups, unsigned seconds);
+
+public:
+  testcase_readscale(const actor_config &config, const mdbx_pid_t pid) : inherited(config, pid) {}
+  bool run() override;
+};
+REGISTER_TESTCASE(readscale);
+
+void testcase_readscale::populate() {
+  const MDBX_put_flags_t flags = MDBX_UPSERT;
+  const uint64_t target =
+      config.params.test_nops ? std::min(std::max(config.params.test_nops / 4, 1024u), 1u << 20) : 65536;
+  keygen::serial_t serial = 0;
+  for (population = 0; population < target; ++population) {
+    generate_pair(serial, key, data, 0);
+    int err = mdbx_put(txn_guard.get(), dbi, &key->value, &data->value, flags);
+    if (unlikely(err != MDBX_SUCCESS))
+      failure_perror("mdbx_put(readscale.populate)", err);
+    if (population % 4096 == 4095)
+      txn_restart(false, false);
+    if (unlikely(!keyvalue_maker.increment(serial, 1))) {
+      log_notice("readscale: key-space is limited to %" PRIu64 " items", population + 1);
+      population += 1;
+      break;
+    }
+  }
+  txn_end(false);
+  log_verbose("readscale: %" PRIu64 " items populated", population);
+}
+
+void testcase_readscale::gc_backlog(size_t &pages, uint64_t &entries) {
+  MDBX_txn *txn = nullptr;
+  int err = mdbx_txn_begin(db_guard.get(), nullptr, MDBX_TXN_RDONLY, &txn);
+  if (unlikely(err != MDBX_SUCCESS))
+    failure_perror("mdbx_txn_begin(readscale.gc)", err);
+  scoped_txn_guard guard(txn);
+  MDBX_stat stat;
+  err = mdbx_dbi_stat(txn, FREE_DBI, &stat, sizeof(stat));
+  if (unlikely(err != MDBX_SUCCESS))
+    failure_perror("mdbx_dbi_stat(FREE_DBI)", err);
+  pages = size_t(stat.ms_branch_pages + stat.ms_leaf_pages + stat.ms_overflow_pages);
+  entries = stat.ms_entries;
+}
+
+void testcase_readscale::reader(unsigned number, uint64_t lookups, reader_stat &stat) {
+  keygen::buffer a_key = keygen::alloc(config.params.keylen_max);
+  keygen::buffer a_data = keygen::alloc(config.params.datalen_max);
+  uint64_t prng_state = bleach64(config.params.prng_seed + number);
+  keygen::distribution access = keyvalue_maker.access(population);
+  scoped_cursor_guard cursor(mdbx_cursor_create(nullptr));
+  if (unlikely(!cursor))
+    failure("mdbx_cursor_create(readscale)");
+
+  while (!stopping.load(std::memory_order_relaxed) && (lookups == 0 || stat.lookups < lookups)) {
+    MDBX_txn *txn = nullptr;
+    const uint64_t started = latency::now_ns();
+    int err = mdbx_txn_begin(db_guard.get(), nullptr, MDBX_TXN_RDONLY, &txn);
+    if (err == MDBX_READERS_FULL) {
+      stat.full_retries += 1;
+      std::this_thread::yield();
+      continue;
+    }
+    if (unlikely(err != MDBX_SUCCESS))
+      failure_perror("mdbx_txn_begin(readscale)", err);
+    stat.begin.add(latency::now_ns() - started);
+    scoped_txn_guard guard(txn);
+
+    for (unsigned n = 0; n < config.params.batch_read; ++n) {
+      keyvalue_maker.pair(access.next(prng_state), a_key, a_data, 0, false);
+      MDBX_val value;
+      err = mdbx_get(txn, dbi, &a_key->value, &value);
+      if (unlikely(err != MDBX_SUCCESS))
+        failure_perror("mdbx_get(readscale)", err);
+      stat.lookups += 1;
+    }
+
+    err = mdbx_cursor_bind(txn, cursor.get(), dbi);
+    if (unlikely(err != MDBX_SUCCESS))
+      failure_perror("mdbx_cursor_bind(readscale)", err);
+    keyvalue_maker.pair(access.next(prng_state), a_key, a_data, 0, false);
+    MDBX_val k = a_key->value, v;
+    err = mdbx_cursor_get(cursor.get(), &k, &v, MDBX_SET_RANGE);
+    for (unsigned n = 0; err == MDBX_SUCCESS && n < scan_length; ++n)
+      err = mdbx_cursor_get(cursor.get(), &k, &v, MDBX_NEXT);
+    if (unlikely(err != MDBX_SUCCESS && err != MDBX_NOTFOUND))
+      failure_perror("mdbx_cursor_get(readscale)", err);
+    stat.scans += 1;
+  }
+  finished.fetch_add(1);
+}
+
+void testcase_readscale::writer(unsigned readers, unsigned seconds, writer_stat &stat) {
+  const uint64_t deadline = seconds ? latency::now_ns() + seconds * UINT64_C(1000000000) : UINT64_MAX;
+  uint64_t prng_state = bleach64(config.params.prng_seed);
+  keygen::distribution access = keyvalue_maker.access(population);
+  while (finished.load() < readers) {
+    MDBX_txn *txn = nullptr;
+    uint64_t started = latency::now_ns();
+    int err = mdbx_txn_begin(db_guard.get(), nullptr, MDBX_TXN_READWRITE, &txn);
+    if (unlikely(err != MDBX_SUCCESS))
+      failure_perror("mdbx_txn_begin(readscale.writer)", err);
+    stat.begin.add(latency::now_ns() - started);
+
+    for (unsigned n = 0; n < config.params.batch_write; ++n) {
+      generate_pair(access.next(prng_state), key, data, stat.commits);
+      err = mdbx_del(txn, dbi, &key->value, nullptr);
+      if (unlikely(err != MDBX_SUCCESS && err != MDBX_NOTFOUND))
+        failure_perror("mdbx_del(readscale.writer)", err);
+      err = mdbx_put(txn, dbi, &key->value, &data->value, MDBX_UPSERT);
+      if (unlikely(err != MDBX_SUCCESS))
+        failure_perror("mdbx_put(readscale.writer)", err);
+    }
+
+    MDBX_txn_info info;
+    started = latency::now_ns();
+    err = mdbx_txn_info(txn, &info, true);
+    if (unlikely(err != MDBX_SUCCESS))
+      failure_perror("mdbx_txn_info(readscale.writer)", err);
+    stat.rlt_scan.add(latency::now_ns() - started);
+    stat.max_lag = std::max(stat.max_lag, info.txn_reader_lag);
+
+    MDBX_commit_latency phases;
+    started = latency::now_ns();
+    err = mdbx_txn_commit_ex(txn, &phases);
+    if (unlikely(err != MDBX_SUCCESS))
+      failure_perror("mdbx_txn_commit(readscale.writer)", err);
+    stat.commit.add(latency::now_ns() - started);
+    stat.gc.add((uint64_t(phases.gc_wallclock) * UINT64_C(1000000000)) >> 16);
+    latency::commit_phases(phases);
+    stat.commits += 1;
+
+    if (latency::now_ns() >= deadline || !should_continue(true))
+      stopping.store(true);
+  }
+}
+
+void testcase_readscale::step(unsigned readers, uint64_t lookups, unsigned seconds) {
+  size_t gc_pages_before, gc_pages_after;
+  uint64_t gc_entries_before, gc_entries_after;
+  gc_backlog(gc_pages_before, gc_entries_before);
+
+  std::vector<reader_stat> stats(readers);
+  std::unique_ptr<writer_stat> wstat(new writer_stat());
+  std::vector<std::thread> threads;
+  stopping.store(false);
+  finished.store(0);
+  const uint64_t started = latency::now_ns();
+  for (unsigned n = 0; n < readers; ++n)
+    threads.emplace_back(&testcase_readscale::reader, this, n, lookups, std::ref(stats[n]));
+  writer(readers, seconds, *wstat);
+  for (auto &thread : threads)
+    thread.join();
+  const uint64_t elapsed_ns = latency::now_ns() - started;
+
+  gc_backlog(gc_pages_after, gc_entries_after);
+
+  std::unique_ptr<reader_stat> total(new reader_stat());
+  for (const auto &stat : stats) {
+    total->begin.merge(stat.begin);
+    total->lookups += stat.lookups;
+    total->scans += stat.scans;
+    total->full_retries += stat.full_retries;
+  }
+  if (total->lookups)
+    report(size_t(total->lookups));
+
+  if (latency::current) {
+    latency::current->ops[latency::op_begin_ro].merge(total->begin);
+    latency::current->ops[latency::op_begin_rw].merge(wstat->begin);
+    latency::current->ops[latency::op_commit].merge(wstat->commit);
+  }
+
+  const double seconds_spent = elapsed_ns * 1e-9;
+  log_notice("readscale: readers %u, lookups %.0f/s, scans %.0f/s, begin p50/p99 %.1f/%.1f us, readers-full %" PRIu64,
+             readers, total->lookups / seconds_spent, total->scans / seconds_spent, total->begin.percentile(50) * 1e-3,
+             total->begin.percentile(99) * 1e-3, total->full_retries);
+  log_notice("readscale: readers %u, commits %.1f/s, writer-begin p99 %.1f us, rlt-scan p50/p99 %.1f/%.1f us, "
+             "commit.gc p99 %.1f us, reader-lag max %" PRIu64 ", gc pages %+" PRIi64 " entries %+" PRIi64,
+             readers, wstat->commits / seconds_spent, wstat->begin.percentile(99) * 1e-3,
+             wstat->rlt_scan.percentile(50) * 1e-3, wstat->rlt_scan.percentile(99) * 1e-3,
+             wstat->gc.percentile(99) * 1e-3, wstat->max_lag, int64_t(gc_pages_after - gc_pages_before),
+             int64_t(gc_entries_after - gc_entries_before));
+}
+
+bool testcase_readscale::run() {
+  int err = db_open__begin__table_create_open_clean(dbi);
+  if (unlikely(err != MDBX_SUCCESS)) {
+    log_notice("readscale: bailout-prepare due '%s'", mdbx_strerror(err));
+    return false;
+  }
+
+  keyvalue_maker.setup(config.params, 0 /* thread_number */);
+  key = keygen::alloc(config.params.keylen_max);
+  data = keygen::alloc(config.params.datalen_max);
+  populate();
+  /* наполнение не должно отъедать отведенную на замеры длительность */
+  start_timestamp = chrono::now_monotonic();
+
+  unsigned max_readers = (config.params.nthreads > 1) ? config.params.nthreads : 4;
+  max_readers = std::max(1u, std::min(max_readers, config.params.max_readers / 2));
+  std::vector<unsigned> steps;
+  for (unsigned readers = 1; readers < max_readers; readers <<= 1)
+    steps.push_back(readers);
+  steps.push_back(max_readers);
+
+  const uint64_t lookups = config.params.test_nops / steps.size();
+  const unsigned seconds = config.params.test_duration ? std::max(1u, unsigned(config.params.test_duration / steps.size()))
+                                                       : 0;
+  for (const unsigned readers : steps) {
+    if (!should_continue(true))
+      break;
+    step(readers, lookups ? std::max(uint64_t(config.params.batch_read), lookups / readers) : 0, seconds);
+  }
+
+  if (dbi && config.params.drop_table && !mode_readonly()) {
+    txn_begin(false);
+    db_table_drop(dbi);
+    err = breakable_commit();
+    if (unlikely(err != MDBX_SUCCESS)) {
+      log_notice("readscale: bailout-clean due '%s'", mdbx_strerror(err));
+      return false;
+    }
+  }
+  return true;
+}
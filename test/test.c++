@@ -28,6 +28,8 @@ const char *testcase2str(const actor_testcase testcase) {
     return "ttl";
   case ac_nested:
     return "nested";
+  case ac_readscale:
+    return "readscale";
 #if !defined(_WIN32) && !defined(_WIN64)
   case ac_forkread:
     return "fork.reader";
@@ -66,6 +68,16 @@ const char *keygencase2str(const keygen_case keycase) {
     return "random";
   case kc_dashes:
     return "dashes";
+  case kc_zipfian:
+    return "zipfian";
+  case kc_hotspot:
+    return "hotspot";
+  case kc_sequential:
+    return "sequential";
+  case kc_latest:
+    return "latest";
+  case kc_prefix:
+    return "prefix";
   case kc_custom:
     return "custom";
   }
@@ -182,9 +194,11 @@ void testcase::txn_begin(bool readonly, MDBX_txn_flags_t flags) {
   assert(!txn_guard);
 
   MDBX_txn *txn = nullptr;
+  const latency::probe probe;
   int rc = mdbx_txn_begin(db_guard.get(), nullptr, readonly ? flags | MDBX_TXN_RDONLY : flags, &txn);
   if (unlikely(rc != MDBX_SUCCESS))
     failure_perror("mdbx_txn_begin()", rc);
+  probe.done(readonly ? latency::op_begin_ro : latency::op_begin_rw);
   txn_guard.reset(txn);
   need_speculum_assign = config.params.speculum && !readonly;
 
@@ -221,9 +235,15 @@ int testcase::breakable_commit() {
 
   MDBX_txn *txn = txn_guard.release();
   txn_inject_writefault(txn);
-  int rc = mdbx_txn_commit(txn);
+  const latency::probe probe;
+  MDBX_commit_latency phases;
+  int rc = mdbx_txn_commit_ex(txn, &phases);
   if (unlikely(rc != MDBX_SUCCESS) && (rc != MDBX_MAP_FULL || !config.params.ignore_dbfull))
     failure_perror("mdbx_txn_commit()", rc);
+  if (rc == MDBX_SUCCESS) {
+    probe.done(latency::op_commit);
+    latency::commit_phases(phases);
+  }
 
   if (need_speculum_assign) {
     need_speculum_assign = false;
@@ -258,17 +278,22 @@ void testcase::txn_end(bool abort) {
     txn_probe_parking();
 
   MDBX_txn *txn = txn_guard.release();
+  const latency::probe probe;
   if (abort) {
     int err = mdbx_txn_abort(txn);
     if (unlikely(err != MDBX_SUCCESS))
       failure_perror("mdbx_txn_abort()", err);
+    probe.done(latency::op_abort);
     if (need_speculum_assign)
       speculum = speculum_committed;
   } else {
     txn_inject_writefault(txn);
-    int err = mdbx_txn_commit(txn);
+    MDBX_commit_latency phases;
+    int err = mdbx_txn_commit_ex(txn, &phases);
     if (unlikely(err != MDBX_SUCCESS))
       failure_perror("mdbx_txn_commit()", err);
+    probe.done(latency::op_commit);
+    latency::commit_phases(phases);
     if (need_speculum_assign)
       speculum_committed = speculum;
   }
@@ -581,7 +606,9 @@ void testcase::db_table_close(MDBX_dbi handle) {
 
 bool testcase::checkdata(const char *step, MDBX_dbi handle, MDBX_val key2check, MDBX_val expected_valued) {
   MDBX_val actual_value = expected_valued;
+  const latency::probe probe;
   int err = mdbx_get_equal_or_great(txn_guard.get(), handle, &key2check, &actual_value);
+  probe.done(latency::op_get);
   if (unlikely(err != MDBX_SUCCESS)) {
     if (!config.params.speculum || err != MDBX_RESULT_TRUE)
       failure_perror(step, (err == MDBX_RESULT_TRUE) ? MDBX_NOTFOUND : err);
@@ -765,6 +792,8 @@ static bool execute_thunk(const actor_config *const_config, const mdbx_pid_t pid
       osal_wait4barrier();
       log_trace("<< wait4barrier");
     }
+    latency::attach(config.actor_id);
+    latency::started();
 
     std::unique_ptr<testcase> test(registry::create_actor(config, pid));
     size_t iter = 0;
@@ -797,6 +826,7 @@ static bool execute_thunk(const actor_config *const_config, const mdbx_pid_t pid
       }
 
     } while (config.params.nrepeat == 0 || iter < config.params.nrepeat);
+    latency::finished();
     return true;
   } catch (const std::exception &pipets) {
     failure("***** Exception: %s *****", pipets.what());
@@ -1126,7 +1156,9 @@ int testcase::insert(const keygen::buffer &akey, const keygen::buffer &adata, MD
 #endif /* SPECULUM_CURSORS */
   }
 
+  const latency::probe probe;
   err = mdbx_put(txn_guard.get(), dbi, &akey->value, &adata->value, flags);
+  probe.done(latency::op_put);
   if (err != MDBX_SUCCESS && err != MDBX_KEYEXIST)
     return err;
 
@@ -1225,7 +1257,9 @@ int testcase::replace(const keygen::buffer &akey, const keygen::buffer &new_data
       expected_err = MDBX_KEYEXIST;
     }
   }
+  const latency::probe probe;
   int err = mdbx_replace(txn_guard.get(), dbi, &akey->value, &new_data->value, &old_data->value, flags);
+  probe.done(latency::op_put);
   if (err && err == expected_err && hush_keygen_mistakes) {
     log_notice("speculum-%s: %s %d", "replace", "hust keygen mistake", err);
     err = MDBX_SUCCESS;
@@ -1251,7 +1285,9 @@ int testcase::remove(const keygen::buffer &akey, const keygen::buffer &adata) {
 #endif /* SPECULUM_CURSORS */
   }
 
+  const latency::probe probe;
   err = mdbx_del(txn_guard.get(), dbi, &akey->value, &adata->value);
+  probe.done(latency::op_del);
   if (err != MDBX_NOTFOUND && err != MDBX_SUCCESS)
     return err;
 
@@ -7,6 +7,7 @@
 #include "chrono.h++"
 #include "config.h++"
 #include "keygen.h++"
+#include "latency.h++"
 #include "log.h++"
 #include "osal.h++"
 #include "utils.h++"
@@ -57,6 +58,8 @@ extern bool failfast;
 extern bool progress_indicator;
 extern bool console_mode;
 extern bool geometry_jitter;
+extern bool latency;
+extern std::string latency_json;
 } /* namespace config */
 
 } /* namespace global */